@@ -76,7 +76,8 @@ It is a backport of <a
 href="https://gforge.liris.cnrs.fr/projects/imagene">ImaGene</a>.
 
 @tparam TInteger any model of integer (CInteger), like \c int, \c long int,
-\c int64_t, \c BigInteger (when GMP is installed).
+\c int64_t, \c int128_t (GCC/Clang on 64-bit platforms), \c BigInteger
+(when GMP is installed).
    
    */
   template <typename TInteger>
@@ -42,6 +42,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <iterator>
 #include <list>
 #include <vector>
 #include <string>
@@ -77,6 +78,14 @@ namespace DGtal
 
      @tparam TSpace an arbitrary 2-dimensional model of CSpace.
      @tparam TSequence a model of boost::Sequence whose elements are points (TSpace::Point). Default is list of points.
+
+     @note With a contiguous sequence (e.g. std::vector of points), the
+     vertices of a cut are erased and inserted in place with at most
+     two block moves, and copying the polytope needs no allocation
+     once the capacity is reached. This is the best choice when the
+     polytope is copied and cut many times (see
+     COBANaivePlaneComputer). The resulting sequence of vertices is
+     the same as with a list.
    */
   template < typename TSpace, 
              typename TSequence = std::list< typename TSpace::Point > >
@@ -537,6 +546,7 @@ namespace DGtal
     mutable Point _A, _B, _A1, _B1, _A2, _B2;
     mutable Vector _N, _DV, _u, _v;
     mutable std::vector<Point> _inPts, _outPts;
+    mutable std::vector<Point> _border;
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -544,6 +554,24 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Cut for sequences that are not random access (e.g. lists):
+       vertices are erased and inserted one by one.
+       @param hs any half-space constraint.
+       @return 'true' if the polygon was modified, 'false' otherwise.
+    */
+    bool cut( const HalfSpace & hs, std::forward_iterator_tag );
+
+    /**
+       Cut for random access sequences (e.g. vectors): the new border
+       is computed in a buffer, then the outside vertices are replaced
+       in place (with wrap-around), so that no iterator is used
+       after an invalidation.
+       @param hs any half-space constraint.
+       @return 'true' if the polygon was modified, 'false' otherwise.
+    */
+    bool cut( const HalfSpace & hs, std::random_access_iterator_tag );
+
   }; // end of class LatticePolytope2D
 
 
@@ -44,6 +44,7 @@
 // Inclusions
 #include <cstdlib>
 #include <iostream>
+#include <string>
 #include <boost/cstdint.hpp>
 
 #ifdef WITH_GMP
@@ -79,6 +80,90 @@ namespace DGtal
   typedef mpz_class BigInteger;
 #endif
 
+#if defined(__SIZEOF_INT128__)
+  #define WITH_INT128
+  ///signed 128-bit integer (GCC/Clang extension, 64-bit platforms).
+  __extension__ typedef __int128 int128_t;
+  ///unsigned 128-bit integer (GCC/Clang extension, 64-bit platforms).
+  __extension__ typedef unsigned __int128 uint128_t;
+
+  /**
+   * Converts a 128-bit unsigned integer to a string in base 10 (the
+   * standard library has no conversion for it).
+   *
+   * @param aValue the integer to convert.
+   * @return its decimal representation.
+   */
+  inline
+  std::string
+  toString( uint128_t aValue )
+  {
+    char buffer[ 40 ];
+    char* ptr = buffer + sizeof( buffer );
+    *--ptr = 0;
+    do
+      {
+        *--ptr = static_cast<char>( '0' + static_cast<int>( aValue % 10 ) );
+        aValue /= 10;
+      }
+    while ( aValue != 0 );
+    return std::string( ptr );
+  }
+
+  /**
+   * Converts a 128-bit signed integer to a string in base 10.
+   *
+   * @param aValue the integer to convert.
+   * @return its decimal representation.
+   */
+  inline
+  std::string
+  toString( int128_t aValue )
+  {
+    if ( aValue < 0 )
+      return '-' + toString( uint128_t( 0 ) - static_cast<uint128_t>( aValue ) );
+    return toString( static_cast<uint128_t>( aValue ) );
+  }
+
+  /**
+   * Overloads 'operator<<' for displaying 128-bit unsigned integers
+   * in base 10.
+   *
+   * @note uint128_t is a built-in type: argument-dependent lookup
+   * does not find this operator outside of namespace DGtal. Bring it
+   * in scope with 'using namespace DGtal;' (or 'using
+   * DGtal::operator<<;'), or write DGtal::toString( aValue ).
+   *
+   * @param out the output stream where the integer is written.
+   * @param aValue the integer to display.
+   * @return the output stream after the writing.
+   */
+  inline
+  std::ostream &
+  operator<< ( std::ostream & out, uint128_t aValue )
+  {
+    return out << toString( aValue );
+  }
+
+  /**
+   * Overloads 'operator<<' for displaying 128-bit signed integers
+   * in base 10.
+   *
+   * @note As for uint128_t, this operator is not found by
+   * argument-dependent lookup outside of namespace DGtal.
+   *
+   * @param out the output stream where the integer is written.
+   * @param aValue the integer to display.
+   * @return the output stream after the writing.
+   */
+  inline
+  std::ostream &
+  operator<< ( std::ostream & out, int128_t aValue )
+  {
+    return out << toString( aValue );
+  }
+#endif
+
 } // namespace DGtal
 
 
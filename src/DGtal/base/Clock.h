@@ -44,23 +44,8 @@
 // Inclusions
 #include <iostream>
 #include <cstdlib>
-
-#if ( (defined(UNIX)||defined(unix)||defined(linux)) )
-#include <sys/time.h>
-#include <time.h>
-#endif
-
-#ifdef __MACH__
-#include <mach/clock.h>
-#include <mach/mach.h>
-#endif
-
-#ifdef WIN32
-#include <time.h>
-#endif
-
-
-
+#include <chrono>
+#include <ctime>
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -73,6 +58,9 @@ namespace DGtal
    * Aim: To provide functions to start and stop a timer. Is useful to get
    * performance of algorithms.
    *
+   * Times are measured with a monotonic clock (std::chrono::steady_clock),
+   * which is not affected by adjustments of the system time.
+   *
    * The following code snippet demonstrates how to use \p Clock
    *
    *  \code
@@ -90,6 +78,9 @@ namespace DGtal
    *   std::cout<< "Duration in ms. : "<< duration <<endl;
    *  \endcode
    *
+   * @note To instrument inner loops, use the lighter ScopedTimer and
+   * TimeAccumulator, which may also rely on the CPU cycle counter.
+   *
    * @see testClock.cpp
    */
   class Clock
@@ -143,12 +134,11 @@ namespace DGtal
     // ------------------------- Private Datas --------------------------------
   private:
 
+    ///Monotonic clock used for measurements.
+    typedef std::chrono::steady_clock SteadyClock;
+
     ///internal timer object;
-#ifdef WIN32
-    clock_t myFirstTick;
-#else
-    struct timespec myTimerStart;
-#endif
+    SteadyClock::time_point myTimerStart;
 
   }; // end of class Clock
 
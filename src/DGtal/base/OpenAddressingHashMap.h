@@ -0,0 +1,470 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OpenAddressingHashMap.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module OpenAddressingHashMap.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(OpenAddressingHashMap_RECURSES)
+#error Recursive header files inclusion detected in OpenAddressingHashMap.h
+#else // defined(OpenAddressingHashMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OpenAddressingHashMap_RECURSES
+
+#if !defined OpenAddressingHashMap_h
+/** Prevents repeated inclusion of headers. */
+#define OpenAddressingHashMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OpenAddressingHashMap
+  /**
+     Description of template class 'OpenAddressingHashMap' <p>
+     \brief Aim: Represents a map key -> data as a hash table with open
+     addressing (linear probing). The pairs are stored in a single
+     array, without any node or pointer, so that the memory overhead
+     per element is one byte plus the free slots of the table (at most
+     a fourth of the table after a growth, see maxLoadFactor).
+
+     Compared to std::map or std::unordered_map, which allocate one
+     node per element (two or three pointers and the allocator
+     overhead, i.e. 32 to 48 bytes), this is well suited to big maps
+     of small keys and values, e.g. the estimated quantities of all the
+     surfels of a digital surface (see EstimatorCache).
+
+     Erasing an element moves the following elements of its probing
+     sequence backwards (no tombstones), hence it invalidates the
+     iterators. Inserting may grow the table, which also invalidates
+     the iterators.
+
+     Model of boost::AssociativeContainer,
+     boost::PairAssociativeContainer,
+     boost::UniqueAssociativeContainer. As such, it is refinement of
+     boost::ForwardContainer and boost::Container. It is also a model
+     of boost::Assignable, boost::CopyConstructible. Since keys are
+     compared for equality only, key_compare is the equality
+     predicate.
+
+     @tparam TKey the type of keys (CopyConstructible).
+     @tparam TData the type of data (CopyConstructible).
+     @tparam THash the hash function on keys.
+     @tparam TKeyEqual the equality predicate on keys.
+
+     @see testOpenAddressingHashMap.cpp
+  */
+  template <typename TKey, typename TData,
+            typename THash = std::hash<TKey>,
+            typename TKeyEqual = std::equal_to<TKey> >
+  class OpenAddressingHashMap
+  {
+  public:
+    // ----------------------- Public types ------------------------------
+    typedef OpenAddressingHashMap<TKey, TData, THash, TKeyEqual> Self;
+    typedef TKey Key;
+    typedef TData Data;
+    typedef THash Hash;
+    typedef TKeyEqual KeyEqual;
+    typedef std::pair<const Key, Data> Value;
+    typedef std::ptrdiff_t DifferenceType;
+    typedef std::size_t SizeType;
+
+    /// Compares two values with their keys.
+    struct ValueCompare
+    {
+      ValueCompare( const KeyEqual & anEqual = KeyEqual() ) : myEqual( anEqual ) {}
+      bool operator()( const Value & v1, const Value & v2 ) const
+      {
+        return myEqual( v1.first, v2.first );
+      }
+      KeyEqual myEqual;
+    };
+
+    /**
+     * Forward iterator on the pairs of the map, in the order of the
+     * table.
+     * @tparam TValue Value or const Value.
+     */
+    template <typename TValue>
+    class IteratorT
+      : public std::iterator<std::forward_iterator_tag, TValue, DifferenceType>
+    {
+      friend class OpenAddressingHashMap<TKey, TData, THash, TKeyEqual>;
+      template <typename TOtherValue> friend class IteratorT;
+    public:
+      IteratorT() : myMap( 0 ), myIndex( 0 ) {}
+
+      /// Conversion from a mutable iterator.
+      IteratorT( const IteratorT<Value> & other )
+        : myMap( other.myMap ), myIndex( other.myIndex ) {}
+
+      TValue & operator*() const
+      {
+        return myMap->mySlots[ myIndex ];
+      }
+      TValue * operator->() const
+      {
+        return myMap->mySlots + myIndex;
+      }
+      IteratorT & operator++()
+      {
+        ++myIndex;
+        skipFreeSlots();
+        return *this;
+      }
+      IteratorT operator++( int )
+      {
+        IteratorT tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+      bool operator==( const IteratorT & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+      bool operator!=( const IteratorT & other ) const
+      {
+        return myIndex != other.myIndex;
+      }
+
+    private:
+      IteratorT( const Self * aMap, SizeType anIndex )
+        : myMap( aMap ), myIndex( anIndex )
+      {
+        skipFreeSlots();
+      }
+      void skipFreeSlots()
+      {
+        while ( myIndex < myMap->myCapacity && ! myMap->myUsed[ myIndex ] )
+          ++myIndex;
+      }
+
+      /// The map.
+      const Self * myMap;
+      /// The index of the current slot.
+      SizeType myIndex;
+    };
+
+    typedef IteratorT<Value> Iterator;
+    typedef IteratorT<const Value> ConstIterator;
+
+    // ----------------------- Standard types ------------------------------
+    typedef Key key_type;
+    typedef Value value_type;
+    typedef Data data_type;
+    typedef Data mapped_type;
+    typedef DifferenceType difference_type;
+    typedef Value & reference;
+    typedef Value * pointer;
+    typedef const Value & const_reference;
+    typedef const Value * const_pointer;
+    typedef SizeType size_type;
+    typedef Iterator iterator;
+    typedef ConstIterator const_iterator;
+    typedef Hash hasher;
+    typedef KeyEqual key_equal;
+    typedef KeyEqual key_compare;
+    typedef ValueCompare value_compare;
+
+    /// Maximal ratio size / capacity before the table grows.
+    static const double maxLoadFactor;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param anExpectedSize the number of elements that can be
+     * inserted without growing the table.
+     * @param aHash the hash function.
+     * @param anEqual the equality predicate on keys.
+     */
+    explicit OpenAddressingHashMap( SizeType anExpectedSize = 0,
+                                    const Hash & aHash = Hash(),
+                                    const KeyEqual & anEqual = KeyEqual() );
+
+    /**
+     * Constructor from a range of values.
+     * @param itb an iterator on the first value.
+     * @param ite an iterator after the last value.
+     */
+    template <typename InputIterator>
+    OpenAddressingHashMap( InputIterator itb, InputIterator ite );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    OpenAddressingHashMap( const Self & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator=( const Self & other );
+
+    /**
+     * Destructor.
+     */
+    ~OpenAddressingHashMap();
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /// @return the number of elements.
+    SizeType size() const;
+
+    /// @return 'true' if the map has no element.
+    bool empty() const;
+
+    /// @return the maximal number of elements.
+    SizeType max_size() const;
+
+    /// @return the number of slots of the table.
+    SizeType capacity() const;
+
+    /// @return the number of bytes used by the table.
+    SizeType memoryUsage() const;
+
+    /// @return the hash function.
+    Hash hash_function() const;
+
+    /// @return the equality predicate on keys.
+    KeyEqual key_eq() const;
+
+    /// @return the equality predicate on keys (key_compare).
+    key_compare key_comp() const;
+
+    /// @return the equality predicate on values (value_compare).
+    value_compare value_comp() const;
+
+    /**
+     * Swaps the content of two maps.
+     * @param other another map.
+     */
+    void swap( Self & other );
+
+    /// Removes all the elements (the table is kept).
+    void clear();
+
+    /**
+     * Grows the table so that \a anExpectedSize elements can be
+     * stored without growing.
+     * @param anExpectedSize a number of elements.
+     */
+    void reserve( SizeType anExpectedSize );
+
+    // ----------------------- Associative services ---------------------------
+  public:
+
+    /// @return an iterator on the first element.
+    ConstIterator begin() const;
+    /// @return an iterator after the last element.
+    ConstIterator end() const;
+    /// @return an iterator on the first element.
+    Iterator begin();
+    /// @return an iterator after the last element.
+    Iterator end();
+
+    /**
+     * @param key any key.
+     * @return an iterator on the element of key \a key, end() if none.
+     */
+    ConstIterator find( const Key & key ) const;
+
+    /**
+     * @param key any key.
+     * @return an iterator on the element of key \a key, end() if none.
+     */
+    Iterator find( const Key & key );
+
+    /**
+     * @param key any key.
+     * @return 1 if the key is in the map, 0 otherwise.
+     */
+    SizeType count( const Key & key ) const;
+
+    /**
+     * @param key any key.
+     * @return the range of the elements of key \a key (at most one).
+     */
+    std::pair<ConstIterator, ConstIterator> equal_range( const Key & key ) const;
+
+    /**
+     * @param key any key.
+     * @return the range of the elements of key \a key (at most one).
+     */
+    std::pair<Iterator, Iterator> equal_range( const Key & key );
+
+    /**
+     * Inserts a value if its key is not already in the map.
+     * @param aValue a pair (key, data).
+     * @return an iterator on the element of this key and 'true' if
+     * the value was inserted.
+     */
+    std::pair<Iterator, bool> insert( const Value & aValue );
+
+    /**
+     * Inserts a value if its key is not already in the map.
+     * @param aHint an iterator, ignored.
+     * @param aValue a pair (key, data).
+     * @return an iterator on the element of this key.
+     */
+    Iterator insert( Iterator aHint, const Value & aValue );
+
+    /**
+     * Inserts a range of values.
+     * @param itb an iterator on the first value.
+     * @param ite an iterator after the last value.
+     */
+    template <typename InputIterator>
+    void insert( InputIterator itb, InputIterator ite );
+
+    /**
+     * @param key any key.
+     * @return a reference on the data of key \a key, inserted with a
+     * default data if needed.
+     */
+    Data & operator[]( const Key & key );
+
+    /**
+     * Erases the element of a given key.
+     * @param key any key.
+     * @return the number of erased elements (0 or 1).
+     */
+    SizeType erase( const Key & key );
+
+    /**
+     * Erases an element. Invalidates the iterators.
+     * @param position an iterator on an element.
+     */
+    void erase( Iterator position );
+
+    /**
+     * Erases a range of elements. Invalidates the iterators.
+     * @param first an iterator on the first element to erase.
+     * @param last an iterator after the last element to erase.
+     */
+    void erase( Iterator first, Iterator last );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object (every element
+     * is reachable from its home slot).
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the home slot of a key.
+    SizeType homeSlot( const Key & key ) const;
+
+    /// @return the slot of a key, myCapacity if not found.
+    SizeType findSlot( const Key & key ) const;
+
+    /// Inserts a value known not to be in the map, without growing.
+    /// @return its slot.
+    SizeType insertNew( const Value & aValue );
+
+    /// Destroys the element at a slot and shifts the next elements
+    /// of its probing sequence backwards.
+    void eraseSlot( SizeType slot );
+
+    /// Reallocates the table with \a aCapacity slots (a power of two).
+    void rehash( SizeType aCapacity );
+
+    /// Destroys the elements and frees the table.
+    void deallocate();
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The slots (only the used ones are constructed).
+    Value * mySlots;
+    /// The slot states (1: used, 0: free).
+    std::vector<DGtal::uint8_t> myUsed;
+    /// The number of slots (0 or a power of two).
+    SizeType myCapacity;
+    /// The number of elements.
+    SizeType mySize;
+    /// 64 - log2( myCapacity ).
+    unsigned int myShift;
+    /// The hash function.
+    Hash myHash;
+    /// The equality predicate on keys.
+    KeyEqual myEqual;
+
+  }; // end of class OpenAddressingHashMap
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OpenAddressingHashMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OpenAddressingHashMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKey, typename TData, typename THash, typename TKeyEqual>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const OpenAddressingHashMap<TKey, TData, THash, TKeyEqual> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/OpenAddressingHashMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OpenAddressingHashMap_h
+
+#undef OpenAddressingHashMap_RECURSES
+#endif // else defined(OpenAddressingHashMap_RECURSES)
@@ -0,0 +1,330 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+/**
+ * @file Profiler.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module Profiler.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(Profiler_RECURSES)
+#error Recursive header files inclusion detected in Profiler.h
+#else // defined(Profiler_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define Profiler_RECURSES
+
+#if !defined Profiler_h
+/** Prevents repeated inclusion of headers. */
+#define Profiler_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <cstddef>
+#include <algorithm>
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class Profiler
+  /**
+   * Description of class 'Profiler' <p>
+   * Aim: @brief thread-safe hierarchical profiler aggregating timings of
+   * named (and nested) blocks.
+   *
+   * Each thread has its own stack of open blocks. A block is
+   * identified by its path, i.e. the names of the enclosing blocks of
+   * the same thread joined with '/'. For each path, the profiler
+   * stores the number of calls, the total, minimal and maximal
+   * elapsed times (measured with a monotonic clock) and, optionally,
+   * the peak resident set size of the process when the block ends.
+   *
+   * Optionally, every block execution can also be recorded as an
+   * event, and exported to the Chrome trace-event format (to be
+   * opened with chrome://tracing or Perfetto).
+   *
+   * The profiler can be fed directly, or through a Trace object
+   * (see Trace::attachProfiler) so that every
+   * Trace::beginBlock / Trace::endBlock pair is profiled.
+   *
+   * @code
+   * Profiler profiler;
+   * trace.attachProfiler( profiler );
+   * trace.beginBlock( "Computation" );
+   * ...
+   * trace.endBlock();
+   * profiler.saveJSON( "profile.json" );
+   * profiler.saveChromeTrace( "trace.json" );
+   * @endcode
+   *
+   * @see testProfiler.cpp
+   */
+  class Profiler
+  {
+    // ----------------------- Standard types ------------------------------
+  public:
+
+    /// Monotonic clock used for all measurements.
+    typedef std::chrono::steady_clock SteadyClock;
+
+    /// Aggregated statistics of a block (all times in milliseconds).
+    struct BlockStatistics
+    {
+      std::string name;        ///< Name of the block.
+      std::string path;        ///< Path of the block ('/' separated names).
+      std::size_t depth;       ///< Nesting level (0 for root blocks).
+      std::size_t count;       ///< Number of calls.
+      double total;            ///< Total elapsed time.
+      double min;              ///< Minimal elapsed time.
+      double max;              ///< Maximal elapsed time.
+      std::size_t peakRSS;     ///< Peak RSS (in kB) observed at the end of the block (0 if not recorded).
+
+      /// @return the mean elapsed time.
+      double mean() const { return count == 0 ? 0.0 : total / count; }
+    };
+
+    /// One execution of a block (times in microseconds since the profiler origin).
+    struct Event
+    {
+      std::string name;        ///< Name of the block.
+      std::size_t thread;      ///< Thread index (in order of first use).
+      double start;            ///< Start time.
+      double duration;         ///< Duration.
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param recordEvents if true, each block execution is stored as an event (see exportChromeTrace).
+     * @param recordMemory if true, the peak RSS is sampled at the end of each block.
+     */
+    Profiler( bool recordEvents = false, bool recordMemory = false );
+
+    /**
+     * Destructor.
+     */
+    ~Profiler() = default;
+
+    /**
+     * Clears all statistics, events and open blocks.
+     */
+    void reset();
+
+    /// @param enable if true, block executions are stored as events.
+    void setRecordEvents( bool enable );
+
+    /// @param enable if true, the peak RSS is sampled at the end of blocks.
+    void setRecordMemory( bool enable );
+
+    /**
+     * Enters a new block in the calling thread.
+     * @param name the name of the block.
+     */
+    void beginBlock( const std::string & name );
+
+    /**
+     * Leaves the current block of the calling thread.
+     * @return the elapsed time in the block in milliseconds (0 if no block was open).
+     */
+    double endBlock();
+
+    /**
+     * @return the statistics of all blocks, sorted by path.
+     */
+    std::vector<BlockStatistics> statistics() const;
+
+    /**
+     * @param path the path of a block ('/' separated names).
+     * @return the statistics of this block (with count 0 if unknown).
+     */
+    BlockStatistics statistics( const std::string & path ) const;
+
+    /// @return the recorded events (empty if events are not recorded).
+    std::vector<Event> events() const;
+
+    /**
+     * Writes the statistics as a JSON document.
+     * @param out the output stream.
+     */
+    void exportJSON( std::ostream & out ) const;
+
+    /**
+     * Writes the recorded events in the Chrome trace-event JSON format.
+     * @param out the output stream.
+     */
+    void exportChromeTrace( std::ostream & out ) const;
+
+    /**
+     * Writes the statistics as a JSON file.
+     * @param filename the output file name.
+     * @return true if the file was written.
+     */
+    bool saveJSON( const std::string & filename ) const;
+
+    /**
+     * Writes the recorded events as a Chrome trace-event file.
+     * @param filename the output file name.
+     * @return true if the file was written.
+     */
+    bool saveChromeTrace( const std::string & filename ) const;
+
+    /**
+     * @return the peak resident set size of the process in kB (0 if
+     * not available on this platform).
+     */
+    static std::size_t peakRSS();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream (indented table of
+     * block statistics).
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// An open block of a thread.
+    struct OpenBlock
+    {
+      std::string path;
+      std::string name;
+      SteadyClock::time_point start;
+    };
+
+    /// Orders paths so that a block comes right before its sub-blocks.
+    struct PathLess
+    {
+      bool operator()( const std::string & a, const std::string & b ) const
+      {
+        return std::lexicographical_compare
+          ( a.begin(), a.end(), b.begin(), b.end(),
+            [] ( char x, char y )
+            { return ( x == '/' ? '\0' : x ) < ( y == '/' ? '\0' : y ); } );
+      }
+    };
+
+    /// The open blocks of a thread.
+    struct ThreadState
+    {
+      std::size_t index;
+      std::vector<OpenBlock> stack;
+    };
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    Profiler( const Profiler & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    Profiler & operator=( const Profiler & other );
+
+    /**
+     * @return the state of the calling thread (created if needed).
+     * The mutex must be locked.
+     */
+    ThreadState & threadState();
+
+    /**
+     * Writes a JSON string literal.
+     * @param out the output stream.
+     * @param str the string to escape.
+     */
+    static void writeJSONString( std::ostream & out, const std::string & str );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Protects all the data below.
+    mutable std::mutex myMutex;
+
+    /// Origin of the event timestamps.
+    SteadyClock::time_point myOrigin;
+
+    /// True if events are recorded.
+    bool myRecordEvents;
+
+    /// True if the peak RSS is recorded.
+    bool myRecordMemory;
+
+    /// Open blocks per thread.
+    std::map<std::thread::id, ThreadState> myThreads;
+
+    /// Aggregated statistics per path.
+    std::map<std::string, BlockStatistics, PathLess> myStatistics;
+
+    /// Recorded events.
+    std::vector<Event> myEvents;
+
+  }; // end of class Profiler
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'Profiler'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'Profiler' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<<( std::ostream & out, const Profiler & object );
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions
+#include "DGtal/base/Profiler.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined Profiler_h
+
+#undef Profiler_RECURSES
+#endif // else defined(Profiler_RECURSES)
@@ -0,0 +1,320 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file TimeAccumulator.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module TimeAccumulator.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(TimeAccumulator_RECURSES)
+#error Recursive header files inclusion detected in TimeAccumulator.h
+#else // defined(TimeAccumulator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define TimeAccumulator_RECURSES
+
+#if !defined TimeAccumulator_h
+/** Prevents repeated inclusion of headers. */
+#define TimeAccumulator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct SteadyTickCounter
+  /**
+   * Description of struct 'SteadyTickCounter' <p>
+   * Aim: @brief tick source reading the monotonic clock
+   * (std::chrono::steady_clock), one tick being one nanosecond.
+   *
+   * @see TimeAccumulator, ScopedTimer
+   */
+  struct SteadyTickCounter
+  {
+    /// Tick type.
+    typedef std::uint64_t Tick;
+
+    /// @return the current tick.
+    static Tick now();
+
+    /// @return the number of ticks per millisecond.
+    static double ticksPerMillisecond();
+
+    /// @return false, ticks are not CPU cycles.
+    static bool isCycleCounter();
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct CycleTickCounter
+  /**
+   * Description of struct 'CycleTickCounter' <p>
+   * Aim: @brief tick source reading the CPU time-stamp counter
+   * (rdtsc) on x86 processors, which is much cheaper than a clock
+   * call. On other processors, it falls back to SteadyTickCounter.
+   *
+   * The tick frequency is calibrated once against the steady clock
+   * (first call to ticksPerMillisecond()). Modern x86 processors have
+   * an invariant time-stamp counter, but the counters of different
+   * cores may be slightly shifted: only measure durations between
+   * two ticks read by the same thread.
+   *
+   * @see TimeAccumulator, ScopedTimer
+   */
+  struct CycleTickCounter
+  {
+    /// Tick type.
+    typedef std::uint64_t Tick;
+
+    /// @return the current tick.
+    static Tick now();
+
+    /// @return the number of ticks per millisecond (calibrated once).
+    static double ticksPerMillisecond();
+
+    /// @return true if the time-stamp counter is used.
+    static bool isCycleCounter();
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class TimeAccumulator
+  /**
+   * Description of template class 'TimeAccumulator' <p>
+   * Aim: @brief accumulates the durations (in ticks) of many short
+   * measurements: count, total, minimum and maximum.
+   *
+   * An accumulator is not thread-safe. In parallel code, give each
+   * thread its own accumulator and merge them afterwards. The class
+   * is padded so that the accumulators of a std::vector never share
+   * a cache line.
+   *
+   * @code
+   * std::vector< TimeAccumulator<CycleTickCounter> > timers( omp_get_max_threads() );
+   * #pragma omp parallel for
+   * for ( int i = 0; i < n; ++i )
+   *   {
+   *     ScopedTimer<CycleTickCounter> timer( timers[ omp_get_thread_num() ] );
+   *     ...
+   *   }
+   * TimeAccumulator<CycleTickCounter> total;
+   * for ( const auto & t : timers ) total.merge( t );
+   * trace.info() << total << std::endl;
+   * @endcode
+   *
+   * @tparam TTickCounter the tick source, SteadyTickCounter or CycleTickCounter.
+   *
+   * @see ScopedTimer, testTimeAccumulator.cpp
+   */
+  template <typename TTickCounter = SteadyTickCounter>
+  class TimeAccumulator
+  {
+    // ----------------------- Standard types ------------------------------
+  public:
+    /// Tick source.
+    typedef TTickCounter TickCounter;
+    /// Tick type.
+    typedef typename TickCounter::Tick Tick;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The accumulator is empty.
+     */
+    TimeAccumulator();
+
+    /**
+     * Clears the accumulator.
+     */
+    void reset();
+
+    /**
+     * Adds a measurement.
+     * @param ticks the duration of the measurement in ticks.
+     */
+    void add( Tick ticks );
+
+    /**
+     * Adds the measurements of another accumulator.
+     * @param other any accumulator with the same tick source.
+     * @return a reference on 'this'.
+     */
+    TimeAccumulator & merge( const TimeAccumulator & other );
+
+    /// @return the number of measurements.
+    std::size_t count() const;
+
+    /// @return the total duration in ticks.
+    Tick totalTicks() const;
+
+    /// @return the minimal duration in ticks (0 if empty).
+    Tick minTicks() const;
+
+    /// @return the maximal duration in ticks.
+    Tick maxTicks() const;
+
+    /// @return the total duration in milliseconds.
+    double total() const;
+
+    /// @return the mean duration in milliseconds (0 if empty).
+    double mean() const;
+
+    /// @return the minimal duration in milliseconds (0 if empty).
+    double min() const;
+
+    /// @return the maximal duration in milliseconds.
+    double max() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Number of measurements.
+    std::size_t myCount;
+    /// Total duration.
+    Tick myTotal;
+    /// Minimal duration.
+    Tick myMin;
+    /// Maximal duration.
+    Tick myMax;
+    /// Keeps two accumulators of an array on distinct cache lines.
+    char myPadding[ 128 - sizeof( std::size_t ) - 3 * sizeof( Tick ) ];
+
+  }; // end of class TimeAccumulator
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ScopedTimer
+  /**
+   * Description of template class 'ScopedTimer' <p>
+   * Aim: @brief measures the lifetime of a scope and adds it to a
+   * TimeAccumulator when destroyed (RAII).
+   *
+   * Only two tick readings and one accumulator update are done per
+   * scope, which makes it suitable to instrument inner loops.
+   *
+   * @code
+   * TimeAccumulator<> timer;
+   * for ( auto s : surfels )
+   *   {
+   *     ScopedTimer<> t( timer );
+   *     ...
+   *   }
+   * trace.info() << "mean=" << timer.mean() << "ms" << std::endl;
+   * @endcode
+   *
+   * @tparam TTickCounter the tick source, SteadyTickCounter or CycleTickCounter.
+   */
+  template <typename TTickCounter = SteadyTickCounter>
+  class ScopedTimer
+  {
+    // ----------------------- Standard types ------------------------------
+  public:
+    /// Tick source.
+    typedef TTickCounter TickCounter;
+    /// Tick type.
+    typedef typename TickCounter::Tick Tick;
+    /// Accumulator type.
+    typedef TimeAccumulator<TickCounter> Accumulator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Starts the measurement.
+     * @param anAccumulator the accumulator receiving the measurement (aliased).
+     */
+    explicit ScopedTimer( Accumulator & anAccumulator );
+
+    /**
+     * Destructor. Stops the measurement and adds it to the accumulator.
+     */
+    ~ScopedTimer();
+
+    /// @return the ticks elapsed since the construction.
+    Tick elapsedTicks() const;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// Copy constructor (forbidden).
+    ScopedTimer( const ScopedTimer & other ) = delete;
+
+    /// Assignment (forbidden).
+    ScopedTimer & operator=( const ScopedTimer & other ) = delete;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The accumulator receiving the measurement.
+    Accumulator * myAccumulator;
+    /// The starting tick.
+    Tick myStart;
+
+  }; // end of class ScopedTimer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'TimeAccumulator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'TimeAccumulator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TTickCounter>
+  std::ostream&
+  operator<<( std::ostream & out, const TimeAccumulator<TTickCounter> & object );
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions
+#include "DGtal/base/TimeAccumulator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined TimeAccumulator_h
+
+#undef TimeAccumulator_RECURSES
+#endif // else defined(TimeAccumulator_RECURSES)
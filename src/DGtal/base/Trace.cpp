@@ -0,0 +1,51 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file Trace.cpp
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/19
+ *
+ * Implementation of methods defined in Trace.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include "DGtal/base/Trace.h"
+#include "DGtal/base/Profiler.h"
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// class Trace
+///////////////////////////////////////////////////////////////////////////////
+
+void
+DGtal::Trace::profilerBeginBlock( Profiler * aProfiler, const std::string & keyword )
+{
+  aProfiler->beginBlock( keyword );
+}
+
+void
+DGtal::Trace::profilerEndBlock( Profiler * aProfiler )
+{
+  aProfiler->endBlock();
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -53,6 +53,7 @@
 
 namespace DGtal
 {
+  class Profiler;
 
   /////////////////////////////////////////////////////////////////////////////
   // class Trace
@@ -64,6 +65,9 @@ namespace DGtal
    * Methods postfixed with "Debug" contain no code if the compilation flag DEBUG is not set.
    *
    *
+   * Blocks can also be forwarded to a Profiler (see attachProfiler)
+   * in order to aggregate timings and export them as JSON.
+   *
    * For usage examples, see the testtrace.cpp file.
    *
    * @see testTrace.cpp
@@ -116,6 +120,27 @@ namespace DGtal
      */
     double endBlock();
 
+    /**
+     * Attaches a profiler: each subsequent beginBlock / endBlock pair is
+     * also recorded by the profiler (which must outlive its use by the trace).
+     * A block is closed in the profiler that was attached when it was
+     * opened, so that attaching or detaching a profiler inside a block
+     * keeps the profilers balanced.
+     *
+     * @param aProfiler the profiler to feed.
+     */
+    void attachProfiler( Profiler & aProfiler );
+
+    /**
+     * Detaches the current profiler (if any).
+     */
+    void detachProfiler();
+
+    /**
+     * @return a pointer to the attached profiler, or nullptr if none.
+     */
+    Profiler * profiler() const;
+
     /**
      * Create a string with an indentation prefix for a normal trace.
      * @return the cerr output stream with the prefix
@@ -197,11 +222,31 @@ namespace DGtal
     ///True if the style has changed
     bool myStyle;
 
+    ///The profiler fed by the blocks (may be null)
+    Profiler * myProfiler;
+
+    ///A stack to store the profiler of each block (may be null)
+    std::stack<Profiler*> myProfilerStack;
+
     // ------------------------- Hidden services ------------------------------
   protected:
 
   private:
 
+    /**
+     * Enters a block of a profiler (defined in Trace.cpp, so that
+     * Profiler.h is not included by every file).
+     * @param aProfiler a profiler.
+     * @param keyword the label of the block.
+     */
+    static void profilerBeginBlock( Profiler * aProfiler, const std::string & keyword );
+
+    /**
+     * Leaves the current block of a profiler.
+     * @param aProfiler a profiler.
+     */
+    static void profilerEndBlock( Profiler * aProfiler );
+
     /**
      * Copy constructor.
      * @param other the object to clone.
@@ -0,0 +1,258 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FreemanDSSRecognizer.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module FreemanDSSRecognizer.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FreemanDSSRecognizer_RECURSES)
+#error Recursive header files inclusion detected in FreemanDSSRecognizer.h
+#else // defined(FreemanDSSRecognizer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FreemanDSSRecognizer_RECURSES
+
+#if !defined FreemanDSSRecognizer_h
+/** Prevents repeated inclusion of headers. */
+#define FreemanDSSRecognizer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FreemanDSSRecognizer
+  /**
+     Description of template class 'FreemanDSSRecognizer' <p>
+     \brief Aim: Recognition of standard DSSs along a string of
+     Freeman codes, i.e. the bulk counterpart of
+     ArithmeticalDSSComputer for 4-connected chains.
+
+     ArithmeticalDSSComputer extends an ArithmeticalDSS point by
+     point: each new point is compared to the last one to find its
+     step, its remainder is computed with two products in the
+     integer type of the DSS, and the steps of the DSS are compared
+     as vectors. Along a FreemanChain, the step is the code itself,
+     so that this recognizer runs the same update rules (see
+     ArithmeticalDSS::extendFront) directly on the codes:
+     - the two steps of the DSS are two codes, their compatibility
+       and the displacement of each code are read in tables;
+     - the remainder of the last point is updated by adding the
+       remainder of the step, tabulated per code each time the
+       slope changes, so that the inner loop has no product;
+     - coordinates are relative to the first point of the segment
+       and stored in 32-bit integers.
+
+     A segment of n codes has coordinates, slope and remainders
+     bounded by 2 n^2 in absolute value, so that the 32-bit
+     arithmetic cannot overflow below 32768 codes. Longer segments
+     are recognized again with 64-bit integers. The resulting DSSs
+     are expressed in the types TCoordinate and TInteger and are
+     equal to the ones computed by ArithmeticalDSSComputer<..., 4>
+     on the points of the chain.
+
+     @code
+     FreemanChain<int> fc( "0001000100010", 0, 0 );
+     std::vector< FreemanDSSRecognizer<int>::DSS > segments;
+     FreemanDSSRecognizer<int>::greedySegmentation( fc, std::back_inserter( segments ) );
+     @endcode
+
+     @tparam TCoordinate a model of integer for the coordinates.
+     @tparam TInteger a model of integer for the intercepts and the
+     remainders (TCoordinate by default), at least as large as TCoordinate.
+
+     @see ArithmeticalDSSComputer, FreemanChain, testFreemanDSSRecognizer.cpp
+  */
+  template <typename TCoordinate, typename TInteger = TCoordinate>
+  class FreemanDSSRecognizer
+  {
+  public:
+    // ----------------------- Public types ------------------------------
+    typedef TCoordinate Coordinate;
+    typedef TInteger Integer;
+    typedef ArithmeticalDSS<Coordinate, Integer, 4> DSS;
+    typedef typename DSS::Point Point;
+    typedef typename DSS::Vector Vector;
+    typedef FreemanChain<Coordinate> Chain;
+
+    /// Number of codes below which a segment is recognized with 32-bit integers.
+    static const DGtal::int32_t maxCodes32 = 32767;
+
+    /// Displacements along x and y of the Freeman codes 0 to 3.
+    static constexpr int codeDx[ 4 ] = { 1, 0, -1, 0 };
+    static constexpr int codeDy[ 4 ] = { 0, 1, 0, -1 };
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+     * Computes the longest DSS that starts at @a aStart and follows
+     * the codes of [@a itb, @a ite).
+     *
+     * @tparam TCodeIterator a model of forward iterator on the
+     * characters '0' to '3' (e.g. FreemanChain::CodesRange::ConstIterator).
+     * @param aStart the first point of the DSS.
+     * @param itb begin iterator on the codes.
+     * @param ite end iterator on the codes.
+     * @param aDSS (returns) the longest DSS.
+     * @return an iterator after the last code of @a aDSS.
+     * @throw InputException if a code read is not between '0' and '3'.
+     */
+    template <typename TCodeIterator>
+    static TCodeIterator longestDSS( const Point & aStart,
+                                     const TCodeIterator & itb,
+                                     const TCodeIterator & ite,
+                                     DSS & aDSS );
+
+    /**
+     * @tparam TCodeIterator a model of forward iterator on the
+     * characters '0' to '3'.
+     * @param itb begin iterator on the codes.
+     * @param ite end iterator on the codes.
+     * @return 'true' if the points following the codes of [@a itb,
+     * @a ite) form a standard DSS, 'false' otherwise.
+     * @throw InputException if a code read is not between '0' and '3'.
+     */
+    template <typename TCodeIterator>
+    static bool isDSS( const TCodeIterator & itb, const TCodeIterator & ite );
+
+    /**
+     * Greedy segmentation of the points following the codes of
+     * [@a itb, @a ite) from @a aStart: each DSS is the longest one
+     * that starts at the last point of the previous one (as
+     * GreedySegmentation does). A single DSS of one point is written
+     * if the range of codes is empty.
+     *
+     * @tparam TCodeIterator a model of forward iterator on the
+     * characters '0' to '3'.
+     * @tparam TOutputIterator a model of output iterator on DSS.
+     * @param aStart the first point of the chain.
+     * @param itb begin iterator on the codes.
+     * @param ite end iterator on the codes.
+     * @param out the output iterator where the DSSs are written.
+     * @return the number of DSSs.
+     * @throw InputException if a code is not between '0' and '3'.
+     */
+    template <typename TCodeIterator, typename TOutputIterator>
+    static std::size_t greedySegmentation( const Point & aStart,
+                                           const TCodeIterator & itb,
+                                           const TCodeIterator & ite,
+                                           TOutputIterator out );
+
+    /**
+     * Greedy segmentation of a Freeman chain.
+     *
+     * @tparam TOutputIterator a model of output iterator on DSS.
+     * @param aChain any 4-connected Freeman chain.
+     * @param out the output iterator where the DSSs are written.
+     * @return the number of DSSs.
+     */
+    template <typename TOutputIterator>
+    static std::size_t greedySegmentation( const Chain & aChain,
+                                           TOutputIterator out );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * The state of the recognition of a DSS, with coordinates
+     * relative to its first point. The members follow the ones of
+     * ArithmeticalDSS.
+     *
+     * @tparam TInternal the integer type of the computations.
+     */
+    template <typename TInternal>
+    struct Recognition
+    {
+      TInternal a, b, lowerBound, upperBound;
+      /// Remainder of the last point.
+      TInternal rL;
+      /// Remainder of the step of each code.
+      TInternal stepRemainder[ 4 ];
+      TInternal Lx, Ly, Ufx, Ufy, Ulx, Uly, Lfx, Lfy, Llx, Lly;
+      /// First and second steps (codes), -1 if not initialized.
+      int first, second;
+      /// Bit mask of the two steps, 0 while the second step is not initialized.
+      int stepMask;
+      /// Number of codes of the DSS.
+      TInternal nbCodes;
+
+      Recognition();
+
+      /**
+       * Extends the DSS with one code (see ArithmeticalDSS::extendFront).
+       * @param aCode a code between 0 and 3.
+       * @return 'true' if the DSS has been extended, 'false' otherwise.
+       */
+      bool extendFront( int aCode );
+
+      /**
+       * Recognizes the longest DSS from the first code of a range.
+       * @param itb begin iterator on the codes.
+       * @param ite end iterator on the codes.
+       * @param aMaxCodes the maximal number of codes of the DSS, which
+       * bounds the values computed with TInternal.
+       * @return an iterator after the last code of the DSS.
+       * @throw InputException if a code read is not between '0' and '3'.
+       */
+      template <typename TCodeIterator>
+      TCodeIterator run( TCodeIterator itb, const TCodeIterator & ite,
+                         TInternal aMaxCodes );
+
+      /**
+       * @param aStart the first point of the DSS.
+       * @return the recognized DSS, translated by @a aStart.
+       */
+      DSS toDSS( const Point & aStart ) const;
+
+    private:
+      /// Tabulates the remainder of the steps after a change of slope.
+      void updateStepRemainders();
+    };
+
+  }; // end of class FreemanDSSRecognizer
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/FreemanDSSRecognizer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FreemanDSSRecognizer_h
+
+#undef FreemanDSSRecognizer_RECURSES
+#endif // else defined(FreemanDSSRecognizer_RECURSES)
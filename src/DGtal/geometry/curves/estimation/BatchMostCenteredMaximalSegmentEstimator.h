@@ -0,0 +1,355 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchMostCenteredMaximalSegmentEstimator.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BatchMostCenteredMaximalSegmentEstimator.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BatchMostCenteredMaximalSegmentEstimator_RECURSES)
+#error Recursive header files inclusion detected in BatchMostCenteredMaximalSegmentEstimator.h
+#else // defined(BatchMostCenteredMaximalSegmentEstimator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchMostCenteredMaximalSegmentEstimator_RECURSES
+
+#if !defined BatchMostCenteredMaximalSegmentEstimator_h
+/** Prevents repeated inclusion of headers. */
+#define BatchMostCenteredMaximalSegmentEstimator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/base/IteratorCirculatorTraits.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/estimation/MostCenteredMaximalSegmentEstimator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BatchMostCenteredMaximalSegmentEstimator
+  /**
+     Description of template class 'BatchMostCenteredMaximalSegmentEstimator' <p>
+     \brief Aim: Computes the tangential covers of many curves (e.g.
+     GridCurve) and the estimations of MostCenteredMaximalSegmentEstimator
+     along them, the curves being processed in parallel.
+
+     The curves are independent: each one is processed by one thread
+     (OpenMP, WITH_OPENMP), with its own segment computer and
+     estimator, copied from the ones given at construction. The
+     results are stored in flat arrays, with the offsets of each curve
+     (nbCurves() + 1 offsets, as compressed rows):
+     - the estimated quantities of the elements of the i-th curve are
+       quantities()[ offsets()[ i ] ] to quantities()[ offsets()[ i + 1 ] - 1 ],
+       in the order of its range;
+     - the maximal segments of the i-th curve are segments()[
+       segmentOffsets()[ i ] ] to segments()[ segmentOffsets()[ i + 1 ] - 1 ],
+       each one given by the indices of its first element and of the
+       element after its last one in the range of the curve. For closed
+       curves (circulators), the second index is smaller than the first
+       one for the segments passing through the first element.
+
+     The results are the same as the ones of MostCenteredMaximalSegmentEstimator
+     and SaturatedSegmentation on each curve, whatever the number of threads.
+     Each curve is segmented once by eval(), which estimates the quantities
+     from its tangential cover and keeps this cover.
+
+     @note An exception thrown while a curve is processed (e.g. by the
+     segment computer or the estimator) cannot leave an OpenMP parallel
+     loop: with OpenMP, it terminates the program.
+
+     The range of each curve is given by a functor, and is processed
+     with circulators if the segment computer works on circulators, with
+     iterators otherwise:
+     @code
+     typedef GridCurve<Z2i::KSpace> Curve;
+     typedef Curve::PointsRange::ConstCirculator ConstCirculator;
+     typedef ArithmeticalDSSComputer<ConstCirculator, int, 4> SegmentComputer;
+     typedef TangentFromDSSEstimator<SegmentComputer> SCEstimator;
+
+     std::vector<Curve> curves = ...;
+     BatchMostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator>
+       batch( SegmentComputer(), SCEstimator() );
+     batch.eval( 1.0, curves.begin(), curves.end(),
+                 [] ( const Curve & c ) { return c.getPointsRange(); } );
+     // batch.quantities() and batch.offsets()
+     @endcode
+
+     @tparam TSegmentComputer at least a model of CForwardSegmentComputer.
+     @tparam TSCEstimator a model of CSegmentComputerEstimator.
+
+     @see MostCenteredMaximalSegmentEstimator, SaturatedSegmentation,
+     testBatchMostCenteredMaximalSegmentEstimator.cpp
+  */
+  template <typename TSegmentComputer, typename TSCEstimator>
+  class BatchMostCenteredMaximalSegmentEstimator
+  {
+  public:
+    // ----------------------- Public types ------------------------------
+    typedef TSegmentComputer SegmentComputer;
+    typedef TSCEstimator SCEstimator;
+    typedef typename SegmentComputer::ConstIterator ConstIterator;
+    typedef typename SCEstimator::Quantity Quantity;
+    typedef MostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Estimator;
+    typedef SaturatedSegmentation<SegmentComputer> Segmentation;
+    typedef std::size_t Size;
+    /// A maximal segment: indices of its first element and after its last one.
+    typedef std::pair<Size, Size> SegmentIndices;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aSegmentComputer the segment computer copied for each curve.
+     * @param aSCEstimator the estimator copied for each curve.
+     */
+    BatchMostCenteredMaximalSegmentEstimator( const SegmentComputer & aSegmentComputer,
+                                              const SCEstimator & aSCEstimator );
+
+    /**
+     * Computes the tangential cover (all the maximal segments) of each
+     * curve of [@a itb, @a ite), forgetting the previous covers.
+     *
+     * @tparam TCurveIterator a model of forward iterator on curves.
+     * @tparam TRangeFunctor a functor returning the range of a curve,
+     * whose iterators or circulators are ConstIterator.
+     * @param itb begin iterator on the curves.
+     * @param ite end iterator on the curves.
+     * @param rangeOf the functor giving the range of each curve.
+     * @param nbThreads the number of threads (0: all available),
+     * used only with OpenMP (WITH_OPENMP).
+     * @return the total number of maximal segments.
+     */
+    template <typename TCurveIterator, typename TRangeFunctor>
+    Size computeTangentialCovers( const TCurveIterator & itb, const TCurveIterator & ite,
+                                  const TRangeFunctor & rangeOf, int nbThreads = 0 );
+
+    /**
+     * Estimates the quantity at each element of each curve of [@a
+     * itb, @a ite) from its most centered maximal segment, forgetting
+     * the previous estimations. Nothing is estimated on empty curves.
+     * The tangential covers computed along are kept, as with
+     * computeTangentialCovers().
+     *
+     * @tparam TCurveIterator a model of forward iterator on curves.
+     * @tparam TRangeFunctor a functor returning the range of a curve,
+     * whose iterators or circulators are ConstIterator.
+     * @param h the grid step (must be > 0).
+     * @param itb begin iterator on the curves.
+     * @param ite end iterator on the curves.
+     * @param rangeOf the functor giving the range of each curve.
+     * @param nbThreads the number of threads (0: all available),
+     * used only with OpenMP (WITH_OPENMP).
+     * @return the total number of estimated quantities.
+     * @throw InputException if @a h is not positive.
+     */
+    template <typename TCurveIterator, typename TRangeFunctor>
+    Size eval( double h, const TCurveIterator & itb, const TCurveIterator & ite,
+               const TRangeFunctor & rangeOf, int nbThreads = 0 );
+
+    // ----------------------- Accessors ------------------------------
+  public:
+
+    /// @return the number of curves of the last call to eval or computeTangentialCovers.
+    Size nbCurves() const;
+
+    /// @return the estimated quantities of all the curves.
+    const std::vector<Quantity> & quantities() const;
+
+    /// @return the offsets of the quantities of each curve (nbCurves() + 1 values).
+    const std::vector<Size> & offsets() const;
+
+    /// @return the maximal segments of all the curves.
+    const std::vector<SegmentIndices> & segments() const;
+
+    /// @return the offsets of the maximal segments of each curve (nbCurves() + 1 values).
+    const std::vector<Size> & segmentOffsets() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The segment computer copied for each curve.
+    SegmentComputer mySC;
+    /// The estimator copied for each curve.
+    SCEstimator mySCEstimator;
+    /// The estimated quantities of all the curves.
+    std::vector<Quantity> myQuantities;
+    /// The offsets of the quantities of each curve.
+    std::vector<Size> myOffsets;
+    /// The maximal segments of all the curves.
+    std::vector<SegmentIndices> mySegments;
+    /// The offsets of the maximal segments of each curve.
+    std::vector<Size> mySegmentOffsets;
+    /// The number of curves of the last call.
+    Size myNbCurves;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the number of threads to use for @a nbThreads (0: all available).
+    static int threads( int nbThreads );
+
+    /**
+     * @param range any range.
+     * @param[out] itb the begin iterator (or circulator) of @a range.
+     * @param[out] ite the end iterator (or circulator) of @a range.
+     * @return the number of elements of @a range.
+     */
+    template <typename TRange>
+    static Size bounds( const TRange & range, ConstIterator & itb, ConstIterator & ite,
+                        IteratorType );
+    template <typename TRange>
+    static Size bounds( const TRange & range, ConstIterator & itb, ConstIterator & ite,
+                        CirculatorType );
+
+    /**
+     * @param range the range of a curve.
+     * @param it any iterator (or circulator) on @a range.
+     * @return the index of the element pointed by @a it in @a range,
+     * or the number of elements if @a it is the end of @a range.
+     */
+    template <typename TRange>
+    static Size index( const TRange & range, const ConstIterator & it, IteratorType );
+    template <typename TRange>
+    static Size index( const TRange & range, const ConstIterator & it, CirculatorType );
+
+    /**
+     * @tparam TCurveIterator a model of forward iterator on curves.
+     * @param itb begin iterator on the curves.
+     * @param ite end iterator on the curves.
+     * @return the addresses of the curves of [@a itb, @a ite).
+     */
+    template <typename TCurveIterator>
+    static std::vector<const typename std::iterator_traits<TCurveIterator>::value_type *>
+    curvesOf( const TCurveIterator & itb, const TCurveIterator & ite );
+
+    /**
+     * Computes the maximal segments of a non empty curve, in the
+     * order of the segmentation of MostCenteredMaximalSegmentEstimator.
+     *
+     * @param range the range of the curve.
+     * @param itb the begin iterator (or circulator) of @a range.
+     * @param ite the end iterator (or circulator) of @a range.
+     * @param[out] cover the indices of the maximal segments.
+     * @param[out] segments if not null, the maximal segments.
+     * @return 'true' if the first and last maximal segments intersect.
+     */
+    template <typename TRange>
+    bool segment( const TRange & range, const ConstIterator & itb, const ConstIterator & ite,
+                  std::vector<SegmentIndices> & cover,
+                  std::vector<SegmentComputer> * segments ) const;
+
+    /**
+     * Estimates the quantities along a non empty curve from its
+     * maximal segments, as MostCenteredMaximalSegmentEstimator::eval.
+     *
+     * @param scEstimator the (initialized) estimator of the curve.
+     * @param itb the begin iterator (or circulator) of the curve.
+     * @param ite the end iterator (or circulator) of the curve.
+     * @param segments the maximal segments of the curve (at least one).
+     * @param isIntersecting 'true' if the first and last maximal segments intersect.
+     * @param result the output iterator on the quantities.
+     * @return the output iterator after the last quantity.
+     */
+    template <typename OutputIterator>
+    static OutputIterator estimate( SCEstimator & scEstimator,
+                                    const ConstIterator & itb, const ConstIterator & ite,
+                                    const std::vector<SegmentComputer> & segments,
+                                    bool isIntersecting, OutputIterator result );
+
+    /// Estimates the quantities after the middle of the last two
+    /// maximal segments (see MostCenteredMaximalSegmentEstimator::endEval).
+    template <typename OutputIterator>
+    static OutputIterator estimateEnd( SCEstimator & scEstimator, ConstIterator itCurrent,
+                                       const ConstIterator & itb, const ConstIterator & ite,
+                                       const std::vector<SegmentComputer> & segments,
+                                       bool isIntersecting, OutputIterator result,
+                                       IteratorType );
+    template <typename OutputIterator>
+    static OutputIterator estimateEnd( SCEstimator & scEstimator, ConstIterator itCurrent,
+                                       const ConstIterator & itb, const ConstIterator & ite,
+                                       const std::vector<SegmentComputer> & segments,
+                                       bool isIntersecting, OutputIterator result,
+                                       CirculatorType );
+
+    /**
+     * Concatenates the covers of the curves in mySegments.
+     * @param covers the cover of each curve.
+     * @param nbThreads the number of threads.
+     */
+    void storeCovers( const std::vector< std::vector<SegmentIndices> > & covers, int nbThreads );
+
+  }; // end of class BatchMostCenteredMaximalSegmentEstimator
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BatchMostCenteredMaximalSegmentEstimator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BatchMostCenteredMaximalSegmentEstimator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSegmentComputer, typename TSCEstimator>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const BatchMostCenteredMaximalSegmentEstimator<TSegmentComputer, TSCEstimator> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/estimation/BatchMostCenteredMaximalSegmentEstimator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchMostCenteredMaximalSegmentEstimator_h
+
+#undef BatchMostCenteredMaximalSegmentEstimator_RECURSES
+#endif // else defined(BatchMostCenteredMaximalSegmentEstimator_RECURSES)
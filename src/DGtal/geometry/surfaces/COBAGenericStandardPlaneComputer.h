@@ -87,7 +87,10 @@ namespace DGtal
    * Note on execution times: The user should favor int64_t instead of
    * BigInteger whenever possible (diameter smaller than 500). The
    * speed-up is between 10 and 20 for these diameters. For greater
-   * diameters, it is necessary to use BigInteger (see below).
+   * diameters, DGtal::int128_t (when available, see WITH_INT128) is
+   * about 10 times faster than BigInteger up to a diameter of
+   * approximately 500000. Beyond, it is necessary to use BigInteger
+   * (see below).
 
    * @tparam TSpace specifies the type of digital space in which lies
    * input digital points. A model of CSpace.
@@ -96,9 +99,9 @@ namespace DGtal
    * internal computations. The type should be able to hold integers
    * of order (2*D^3)^2 if D is the diameter of the set of digital
    * points. In practice, diameter is limited to 20 for int32_t,
-   * diameter is approximately 500 for int64_t, and whatever with
-   * BigInteger/GMP integers. For huge diameters, the slow-down is
-   * polylogarithmic with the diameter.
+   * diameter is approximately 500 for int64_t, approximately 500000
+   * for int128_t, and whatever with BigInteger/GMP integers. For huge
+   * diameters, the slow-down is polylogarithmic with the diameter.
 
    *   @code
    *   typedef SpaceND<3,int> Z3;
@@ -44,11 +44,14 @@
 // Inclusions
 #include <iostream>
 #include <set>
+#include <unordered_set>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/CSpace.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/PointHashFunctions.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
 #include "DGtal/arithmetic/LatticePolytope2D.h"
 #include "DGtal/geometry/surfaces/ParallelStrip.h"
@@ -57,6 +60,106 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /////////////////////////////////////////////////////////////////////////////
+    // template class COBAPointStorage
+    /**
+     * Description of template class 'COBAPointStorage' <p> \brief Aim:
+     * Stores the distinct points of a COBANaivePlaneComputer in a
+     * sorted associative container (e.g. std::set).
+     *
+     * @tparam TPointSet the type of the container.
+     */
+    template <typename TPointSet>
+    class COBAPointStorage
+    {
+    public:
+      typedef TPointSet PointSet;
+      typedef typename PointSet::value_type Point;
+      typedef typename PointSet::size_type Size;
+      typedef typename PointSet::const_iterator ConstIterator;
+
+      ConstIterator begin() const { return myPoints.begin(); }
+      ConstIterator end() const   { return myPoints.end(); }
+      Size size() const           { return myPoints.size(); }
+      Size max_size() const       { return myPoints.max_size(); }
+      bool empty() const          { return myPoints.empty(); }
+      void clear()                { myPoints.clear(); }
+
+      /// @return 'true' iff \a p is stored.
+      bool contains( const Point & p ) const
+      {
+        return myPoints.find( p ) != myPoints.end();
+      }
+
+      /// Stores \a p, if not already stored.
+      void insert( const Point & p )
+      {
+        myPoints.insert( p );
+      }
+
+      /// Stores the points of [\a it, \a itE) not already stored.
+      template <typename TInputIterator>
+      void insert( TInputIterator it, TInputIterator itE )
+      {
+        for ( ; it != itE; ++it )
+          myPoints.insert( *it );
+      }
+
+    private:
+      PointSet myPoints;
+    };
+
+    /**
+     * Specialization of COBAPointStorage for std::vector: the points
+     * are stored contiguously in insertion order, and a hashed set of
+     * the points answers the membership tests, so that a point is
+     * inserted in constant time.
+     */
+    template <typename TPoint, typename TAllocator>
+    class COBAPointStorage< std::vector< TPoint, TAllocator > >
+    {
+    public:
+      typedef std::vector< TPoint, TAllocator > PointSet;
+      typedef TPoint Point;
+      typedef typename PointSet::size_type Size;
+      typedef typename PointSet::const_iterator ConstIterator;
+
+      ConstIterator begin() const { return myPoints.begin(); }
+      ConstIterator end() const   { return myPoints.end(); }
+      Size size() const           { return myPoints.size(); }
+      Size max_size() const       { return myPoints.max_size(); }
+      bool empty() const          { return myPoints.empty(); }
+      void clear()                { myPoints.clear(); myMembers.clear(); }
+
+      /// @return 'true' iff \a p is stored.
+      bool contains( const Point & p ) const
+      {
+        return myMembers.count( p ) != 0;
+      }
+
+      /// Stores \a p, if not already stored.
+      void insert( const Point & p )
+      {
+        if ( myMembers.insert( p ).second )
+          myPoints.push_back( p );
+      }
+
+      /// Stores the points of [\a it, \a itE) not already stored.
+      template <typename TInputIterator>
+      void insert( TInputIterator it, TInputIterator itE )
+      {
+        for ( ; it != itE; ++it )
+          insert( *it );
+      }
+
+    private:
+      PointSet myPoints;
+      std::unordered_set< Point > myMembers;
+    };
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class COBANaivePlaneComputer
   /**
@@ -91,10 +194,21 @@ namespace DGtal
    * the number of times \a K where the normal should be updated is
    * rather limited to some \f$ O(\log(D)) \f$.
    *
+   * Note on storage: the points are kept in a std::set by
+   * default. With TPointSet = std::vector<Point>, they are kept
+   * contiguously in insertion order, with a hashed set for the
+   * membership tests: a point is then inserted in constant time and
+   * the points are scanned faster when the normal changes, at the
+   * cost of more memory. The polygon of solutions is a
+   * LatticePolytope2D stored in a vector and cut in place.
+   *
    * Note on execution times: The user should favor int64_t instead of
    * BigInteger whenever possible (diameter smaller than 500). The
    * speed-up is between 10 and 20 for these diameters. For greater
-   * diameters, it is necessary to use BigInteger (see below).
+   * diameters, DGtal::int128_t (when available, see WITH_INT128) is
+   * about 10 times faster than BigInteger up to a diameter of
+   * approximately 500000. Beyond, it is necessary to use BigInteger
+   * (see below).
    *
    * @tparam TSpace specifies the type of digital space in which lies
    * input digital points. A model of CSpace.
@@ -103,9 +217,14 @@ namespace DGtal
    * internal computations. The type should be able to hold integers
    * of order (2*D^3)^2 if D is the diameter of the set of digital
    * points. In practice, diameter is limited to 20 for int32_t,
-   * diameter is approximately 500 for int64_t, and whatever with
-   * BigInteger/GMP integers. For huge diameters, the slow-down is
-   * polylogarithmic with respect to the diameter.
+   * diameter is approximately 500 for int64_t, approximately 500000
+   * for int128_t, and whatever with BigInteger/GMP integers. For
+   * huge diameters, the slow-down is polylogarithmic with respect
+   * to the diameter.
+   *
+   * @tparam TPointSet the container of the points, either a sorted
+   * associative container (std::set, the default) or std::vector
+   * (see the note on storage).
    *
    * Essentially a backport from [ImaGene](https://gforge.liris.cnrs.fr/projects/imagene).
    *
@@ -125,7 +244,8 @@ namespace DGtal
    * boost::Assignable, boost::ForwardContainer, concepts::CAdditivePrimitiveComputer, concepts::CPointPredicate.
    */
   template < typename TSpace, 
-             typename TInternalInteger >
+             typename TInternalInteger,
+             typename TPointSet = std::set< typename TSpace::Point > >
   class COBANaivePlaneComputer
   {
 
@@ -137,7 +257,7 @@ namespace DGtal
   public:
     typedef TSpace Space;
     typedef typename Space::Point Point;
-    typedef std::set< Point > PointSet;
+    typedef TPointSet PointSet;
     typedef typename PointSet::size_type Size;
     typedef typename PointSet::const_iterator ConstIterator;
     typedef typename PointSet::iterator Iterator;
@@ -160,7 +280,7 @@ namespace DGtal
     typedef PointVector< 3, InternalInteger > InternalPoint3;
     typedef SpaceND< 2, InternalInteger > InternalSpace2;
     typedef typename InternalSpace2::Point InternalPoint2;
-    typedef LatticePolytope2D< InternalSpace2 > ConvexPolygonZ2;
+    typedef LatticePolytope2D< InternalSpace2, std::vector< InternalPoint2 > > ConvexPolygonZ2;
     typedef typename ConvexPolygonZ2::HalfSpace HalfSpace;
 
     /**
@@ -455,7 +575,7 @@ namespace DGtal
     Dimension myAxis;          /**< the main axis used in all subsequent computations. */
     InternalInteger myG;       /**< the grid step used in all subsequent computations. */
     InternalPoint2 myWidth;    /**< the plane width as a positive rational number myWidth[0]/myWidth[1] */
-    PointSet myPointSet;       /**< the set of points within the plane. */ 
+    detail::COBAPointStorage< PointSet > myPointSet; /**< the set of points within the plane. */ 
     State myState;             /**< the current state that defines the plane being recognized. */
     InternalInteger myCst1;    /**<  ( (int) ceil( get_si( myG ) * myWidth ) + 1 ). */
     InternalInteger myCst2;    /**<  ( (int) floor( get_si( myG ) * myWidth ) - 1 ). */
@@ -559,9 +679,9 @@ namespace DGtal
    * @param object the object of class 'COBANaivePlaneComputer' to write.
    * @return the output stream after the writing.
    */
-  template <typename TSpace, typename TInternalInteger>
+  template <typename TSpace, typename TInternalInteger, typename TPointSet>
   std::ostream&
-  operator<< ( std::ostream & out, const COBANaivePlaneComputer<TSpace, TInternalInteger> & object );
+  operator<< ( std::ostream & out, const COBANaivePlaneComputer<TSpace, TInternalInteger, TPointSet> & object );
 
 } // namespace DGtal
 
@@ -0,0 +1,368 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalPlaneSegmentation.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DigitalPlaneSegmentation.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalPlaneSegmentation_RECURSES)
+#error Recursive header files inclusion detected in DigitalPlaneSegmentation.h
+#else // defined(DigitalPlaneSegmentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalPlaneSegmentation_RECURSES
+
+#if !defined DigitalPlaneSegmentation_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalPlaneSegmentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/base/OpenAddressingHashMap.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+#include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/COBAGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/COBAGenericStandardPlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordGenericStandardPlaneComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalPlaneSegmentation
+  /**
+     Description of template class 'DigitalPlaneSegmentation' <p>
+     \brief Aim: Segments a whole digital surface into pieces of
+     digital planes (patches) with a greedy region growing, as in
+     greedy-plane-segmentation.cpp, optionally with several threads.
+
+     Each surfel is represented by the inner voxel along its
+     orthogonal direction. A patch is grown from a seed surfel by a
+     breadth-first traversal of the surface: a surfel joins the patch
+     if the plane computer can be extended with its point, and only
+     the surfels of the patch are expanded. Surfels belonging to a
+     patch are never considered again. The constructor numbers the
+     vertices of the surface and stores their points and their
+     adjacencies (compressed rows), so that the segmentation itself
+     only works on indices.
+
+     The segmentation proceeds by rounds. The vertices are split into
+     \a batchSize contiguous blocks of the surface order (which is
+     spatially coherent for the usual containers). In each round, the
+     first unlabelled vertex of each block is a seed and all seeds
+     grow their patch concurrently against the patches of the
+     previous rounds. Then the patches are committed in block order:
+     a patch sharing a surfel with a patch committed before it in the
+     same round is a conflict, it is discarded and its seed is grown
+     again in the next round. The first patch of a round is always
+     committed, hence the segmentation terminates.
+
+     The result only depends on \a batchSize, not on the number of
+     threads. With a batch of size 1, this is exactly the sequential
+     greedy segmentation visiting the vertices in the surface order.
+
+     @code
+     typedef DigitalSurface< DigitalSetBoundary< KSpace, DigitalSet > > MySurface;
+     typedef COBANaivePlaneComputer< Z3, DGtal::int64_t > PlaneComputer;
+     DigitalPlaneSegmentation< MySurface, PlaneComputer > segmentation( surface );
+     segmentation.segment( 500, 1, 1, 4, 64 ); // 4 threads, batch of 64
+     for ( auto v : surface )
+       std::cout << segmentation.patch( v ) << std::endl;
+     @endcode
+
+     @tparam TDigitalSurface either a DigitalSurface or an
+     IndexedDigitalSurface of dimension 3.
+
+     @tparam TPlaneComputer any of COBANaivePlaneComputer,
+     ChordNaivePlaneComputer (axis of the seed surfel),
+     COBAGenericNaivePlaneComputer, COBAGenericStandardPlaneComputer,
+     ChordGenericNaivePlaneComputer or ChordGenericStandardPlaneComputer.
+
+     @see testDigitalPlaneSegmentation.cpp
+  */
+  template <typename TDigitalSurface, typename TPlaneComputer>
+  class DigitalPlaneSegmentation
+  {
+    // ----------------------- public types ------------------------------
+  public:
+    typedef DigitalPlaneSegmentation<TDigitalSurface, TPlaneComputer> Self;
+    typedef TDigitalSurface Surface;
+    typedef TPlaneComputer PlaneComputer;
+    typedef typename Surface::Vertex Vertex;
+    typedef typename Surface::KSpace KSpace;
+    typedef typename KSpace::SCell Surfel;
+    typedef typename KSpace::Point Point;
+    typedef std::size_t Size;
+    /// Index of a vertex in vertices().
+    typedef std::size_t Index;
+    /// Index of a patch in [0,nbPatches()).
+    typedef std::size_t PatchId;
+
+    BOOST_STATIC_ASSERT(( KSpace::dimension == 3 ));
+
+    /// The patch id of vertices not segmented yet.
+    static const PatchId INVALID_PATCH = static_cast<PatchId>( -1 );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalPlaneSegmentation() {}
+
+    /**
+     * Constructor. Numbers the vertices of the surface and stores
+     * their points and adjacencies.
+     *
+     * @param surface the digital surface to segment (aliased).
+     */
+    DigitalPlaneSegmentation( ConstAlias<Surface> surface );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalPlaneSegmentation( const DigitalPlaneSegmentation & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalPlaneSegmentation & operator=( const DigitalPlaneSegmentation & other ) = default;
+
+    /**
+     * Segments the surface into patches, forgetting any previous
+     * segmentation.
+     *
+     * @param diameter the diameter given to the plane computers
+     * (ignored by the Chord computers).
+     * @param widthNumerator the numerator of the plane width.
+     * @param widthDenominator the denominator of the plane width.
+     * @param nbThreads the number of threads (0: all available),
+     * used only with OpenMP (WITH_OPENMP).
+     * @param batchSize the number of patches grown in each round
+     * (0: 1 with one thread, 4 x nbThreads otherwise).
+     * @return the number of patches.
+     */
+    Size segment( DGtal::int64_t diameter,
+                  DGtal::int64_t widthNumerator = 1,
+                  DGtal::int64_t widthDenominator = 1,
+                  int nbThreads = 1, Size batchSize = 0 );
+
+    // ----------------------- Accessors ------------------------------
+  public:
+
+    /// @return the segmented surface.
+    const Surface & surface() const;
+
+    /// @return the number of vertices of the surface.
+    Size size() const;
+
+    /// @return the vertices of the surface, in the surface order.
+    const std::vector<Vertex> & vertices() const;
+
+    /// @param v any vertex of the surface.
+    /// @return its index in vertices().
+    Index index( const Vertex & v ) const;
+
+    /// @param i any vertex index.
+    /// @return the point (inner voxel) representing this vertex.
+    const Point & point( Index i ) const;
+
+    /// @return the number of patches of the last segmentation.
+    Size nbPatches() const;
+
+    /// @return the patch ids of the vertices, by vertex index.
+    const std::vector<PatchId> & patches() const;
+
+    /// @param v any vertex of the surface.
+    /// @return the patch containing \a v (or INVALID_PATCH before segment()).
+    PatchId patch( const Vertex & v ) const;
+
+    /// @param id any patch id.
+    /// @return the plane computer recognizing this patch.
+    const PlaneComputer & plane( PatchId id ) const;
+
+    /// @param id any patch id.
+    /// @return the number of surfels of this patch.
+    Size patchSize( PatchId id ) const;
+
+    /// @return the number of rounds of the last segmentation.
+    Size nbRounds() const;
+
+    /// @return the number of patches discarded because of a conflict.
+    Size nbConflicts() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The segmented surface.
+    const Surface* mySurface;
+    /// The vertices, by index.
+    std::vector<Vertex> myVertices;
+    /// The index of each vertex.
+    OpenAddressingHashMap<Vertex, Index> myIndices;
+    /// The point representing each vertex.
+    std::vector<Point> myPoints;
+    /// The orthogonal direction of each vertex.
+    std::vector<Dimension> myAxes;
+    /// The neighbors of vertex i are myNeighbors[myNeighborStarts[i]..myNeighborStarts[i+1]).
+    std::vector<Index> myNeighborStarts;
+    /// The neighbors of all vertices.
+    std::vector<Index> myNeighbors;
+    /// The patch of each vertex.
+    std::vector<PatchId> myPatches;
+    /// The plane computer of each patch.
+    std::vector<PlaneComputer> myPlanes;
+    /// The size of each patch.
+    std::vector<Size> myPatchSizes;
+    /// The number of rounds of the last segmentation.
+    Size myNbRounds;
+    /// The number of discarded patches of the last segmentation.
+    Size myNbConflicts;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Grows a patch from a seed against the committed patches.
+     *
+     * @param seed the index of the seed vertex.
+     * @param diameter the diameter given to the plane computer.
+     * @param widthNumerator the numerator of the plane width.
+     * @param widthDenominator the denominator of the plane width.
+     * @param[out] plane the plane computer of the patch.
+     * @param[out] members the vertices of the patch.
+     * @param queue a buffer for the breadth-first traversal.
+     * @param stamps the visit marks of the calling thread.
+     * @param stamp the mark of this traversal.
+     */
+    void growPatch( Index seed, DGtal::int64_t diameter,
+                    DGtal::int64_t widthNumerator, DGtal::int64_t widthDenominator,
+                    PlaneComputer & plane, std::vector<Index> & members,
+                    std::vector<Index> & queue,
+                    std::vector<unsigned int> & stamps, unsigned int stamp ) const;
+
+    /// @return the surfel of a vertex of a DigitalSurface.
+    template <typename TContainer>
+    static Surfel surfelOf( const DigitalSurface<TContainer> & surface, const Surfel & v );
+
+    /// @return the surfel of a vertex of an IndexedDigitalSurface.
+    template <typename TContainer>
+    static Surfel surfelOf( const IndexedDigitalSurface<TContainer> & surface,
+                            const typename IndexedDigitalSurface<TContainer>::Vertex & v );
+
+    /// Initializes a COBANaivePlaneComputer along the seed axis.
+    template <typename TSpace, typename TInternalInteger>
+    static void initPlane( COBANaivePlaneComputer<TSpace, TInternalInteger> & plane,
+                           Dimension axis, DGtal::int64_t diameter,
+                           DGtal::int64_t widthNumerator, DGtal::int64_t widthDenominator );
+
+    /// Initializes a COBAGenericNaivePlaneComputer.
+    template <typename TSpace, typename TInternalInteger>
+    static void initPlane( COBAGenericNaivePlaneComputer<TSpace, TInternalInteger> & plane,
+                           Dimension axis, DGtal::int64_t diameter,
+                           DGtal::int64_t widthNumerator, DGtal::int64_t widthDenominator );
+
+    /// Initializes a COBAGenericStandardPlaneComputer.
+    template <typename TSpace, typename TInternalInteger>
+    static void initPlane( COBAGenericStandardPlaneComputer<TSpace, TInternalInteger> & plane,
+                           Dimension axis, DGtal::int64_t diameter,
+                           DGtal::int64_t widthNumerator, DGtal::int64_t widthDenominator );
+
+    /// Initializes a ChordNaivePlaneComputer along the seed axis.
+    template <typename TSpace, typename TInputPoint, typename TInternalScalar>
+    static void initPlane( ChordNaivePlaneComputer<TSpace, TInputPoint, TInternalScalar> & plane,
+                           Dimension axis, DGtal::int64_t diameter,
+                           DGtal::int64_t widthNumerator, DGtal::int64_t widthDenominator );
+
+    /// Initializes a ChordGenericNaivePlaneComputer.
+    template <typename TSpace, typename TInputPoint, typename TInternalScalar>
+    static void initPlane( ChordGenericNaivePlaneComputer<TSpace, TInputPoint, TInternalScalar> & plane,
+                           Dimension axis, DGtal::int64_t diameter,
+                           DGtal::int64_t widthNumerator, DGtal::int64_t widthDenominator );
+
+    /// Initializes a ChordGenericStandardPlaneComputer.
+    template <typename TSpace, typename TInputPoint, typename TInternalScalar>
+    static void initPlane( ChordGenericStandardPlaneComputer<TSpace, TInputPoint, TInternalScalar> & plane,
+                           Dimension axis, DGtal::int64_t diameter,
+                           DGtal::int64_t widthNumerator, DGtal::int64_t widthDenominator );
+
+  }; // end of class DigitalPlaneSegmentation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalPlaneSegmentation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalPlaneSegmentation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurface, typename TPlaneComputer>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalPlaneSegmentation<TDigitalSurface, TPlaneComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/DigitalPlaneSegmentation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalPlaneSegmentation_h
+
+#undef DigitalPlaneSegmentation_RECURSES
+#endif // else defined(DigitalPlaneSegmentation_RECURSES)
@@ -41,7 +41,13 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
+#include <cstring>
 #include <map>
+#include <vector>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Alias.h"
 #include "DGtal/geometry/surfaces/estimation/CSurfelLocalEstimator.h"
@@ -66,10 +72,32 @@ namespace DGtal
    *
    * This class is also a model of concepts::CSurfelLocalEstimator
    *
+   * The default container is a std::map, which costs a node (about
+   * 48 bytes) per surfel. For big surfaces, an OpenAddressingHashMap
+   * stores the pairs (Surfel, Quantity) in a single array with one
+   * byte of overhead per surfel plus its free slots, and has faster
+   * lookups:
+   *
+   * @code
+   * #include "DGtal/base/OpenAddressingHashMap.h"
+   * #include "DGtal/topology/KhalimskyCellHashFunctions.h"
+   * typedef OpenAddressingHashMap< Surfel, Estimator::Quantity > Map;
+   * typedef EstimatorCache< Estimator, Map > Cache;
+   * Cache cache( estimator );
+   * cache.init( h, surfels.begin(), surfels.end(), 4 ); // 4 threads
+   * std::ofstream out( "curvatures.cache", std::ios::binary );
+   * cache.save( out );
+   * @endcode
+   *
+   * The cached quantities can be saved and loaded afterwards (see
+   * save() and load()), to reuse them in another run without the
+   * estimator.
+   *
    * @see testEstimatorCache.cpp
 
    * @tparam TEstimator any model of CSurfelLocalEstimator
-   * @tparam TContainer the associative container to use (default type: std::map<Surfel,Quantity>)
+   * @tparam TContainer the associative container to use (default
+   * type: std::map<Surfel,Quantity>, see also OpenAddressingHashMap)
    */
   template <typename TEstimator,
             typename TContainer = std::map<typename TEstimator::Surfel,
@@ -102,7 +130,7 @@ namespace DGtal
     /**
      * Default constructor.
      */
-    EstimatorCache(): myInit(false)
+    EstimatorCache(): myEstimator(0), myH(0.0), myInit(false)
     {}
     
     /**
@@ -110,6 +138,7 @@ namespace DGtal
      *
      */
     EstimatorCache( Alias<Estimator> anEstimator): myEstimator(&anEstimator),
+                                                   myH(0.0),
                                                    myInit(false)
     {}
     
@@ -124,6 +153,7 @@ namespace DGtal
      */
     EstimatorCache(const Self &other): myContainer(other.myContainer),
                                        myEstimator(other.myEstimator),
+                                       myH(other.myH),
                                        myInit(other.myInit)
     {}
    
@@ -137,6 +167,7 @@ namespace DGtal
     {
       myContainer = other.myContainer;
       myEstimator = other.myEstimator;
+      myH = other.myH;
       myInit = other.myInit;
       
       return *this;
@@ -167,6 +198,68 @@ namespace DGtal
       for(SurfelConstIterator it = itb; it != ite; ++it)
         myContainer.insert( std::pair<Surfel, Quantity>(*it, myEstimator->eval(it) ) );
       
+      myH = aH;
+      myInit = true;
+    }
+
+    /**
+     * Estimator initialization with a parallel evaluation. The
+     * surfels are copied in a vector and split into @a nbThreads
+     * contiguous chunks. Each chunk is evaluated concurrently by its
+     * own copy of the (initialized) estimator, since estimators may
+     * have mutable evaluation state (e.g. the eigen decomposition
+     * buffers of the integral invariant functors), with the range
+     * evaluation of the estimator. The quantities are then inserted
+     * in the container in the order of the surfels. The cached values
+     * do not depend on @a nbThreads.
+     *
+     * @note Without OpenMP (WITH_OPENMP), the chunks are evaluated
+     * sequentially.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param[in] aH the gridstep
+     * @param[in] itb iterator on the first surfel of the surface.
+     * @param[in] ite iterator after the last surfel of the surface.
+     * @param[in] nbThreads the number of threads (0: all available).
+     */
+    template <typename SurfelConstIterator>
+    void init(const double aH, SurfelConstIterator itb, SurfelConstIterator ite,
+              int nbThreads)
+    {
+      ASSERT(myEstimator);
+      myEstimator->init(aH,itb,ite);
+      myContainer.clear();
+
+      const std::vector<Surfel> surfels( itb, ite );
+#ifdef WITH_OPENMP
+      if ( nbThreads <= 0 ) nbThreads = omp_get_max_threads();
+#endif
+      const std::ptrdiff_t nb       = surfels.size();
+      const std::ptrdiff_t nbChunks = std::max( std::ptrdiff_t( 1 ),
+                                                std::min( nb, std::ptrdiff_t( nbThreads ) ) );
+      std::vector<Quantity> quantities( surfels.size() );
+      // Copied before the parallel loop (the copies may share
+      // non thread-safe reference counted data).
+      std::vector<Estimator> estimators( nbChunks, *myEstimator );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static,1) num_threads(nbChunks)
+#endif
+      for ( std::ptrdiff_t c = 0; c < nbChunks; ++c )
+        {
+          const Estimator & estimator = estimators[ c ];
+          const std::ptrdiff_t first = ( c * nb ) / nbChunks;
+          const std::ptrdiff_t last  = ( ( c + 1 ) * nb ) / nbChunks;
+          // The range evaluation keeps its state in local variables,
+          // whereas the evaluation at one surfel may write in shared
+          // buffers (e.g. the static default arguments of
+          // DigitalSurfaceConvolver::core_eval).
+          estimator.eval( surfels.begin() + first, surfels.begin() + last,
+                          quantities.begin() + first );
+        }
+      for ( std::size_t i = 0; i < surfels.size(); ++i )
+        myContainer.insert( std::pair<Surfel, Quantity>( surfels[ i ], quantities[ i ] ) );
+
+      myH = aH;
       myInit = true;
     }
     
@@ -235,7 +328,7 @@ namespace DGtal
      */
     double h() const
     {
-      return myEstimator->h();
+      return myEstimator ? myEstimator->h() : myH;
     }
     
     // ----------------------- Interface --------------------------------------
@@ -251,6 +344,85 @@ namespace DGtal
       return myContainer.size();
     }
 
+    /**
+     * Writes the cached quantities on a binary stream (e.g. a
+     * std::ofstream opened with std::ios::binary), to load them in
+     * another run with load().
+     *
+     * The pairs (Surfel, Quantity) are written as raw bytes, hence
+     * both types must be bitwise copyable (e.g. Khalimsky cells,
+     * numbers, PointVector) and the file is only readable on the
+     * same architecture.
+     *
+     * @pre init() method must have been called first.
+     * @param out the output stream.
+     * @return 'true' if the stream is still good after writing.
+     */
+    bool save( std::ostream & out ) const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      const DGtal::uint32_t header[ 3 ] = { cacheFileVersion,
+                                            DGtal::uint32_t( sizeof( Surfel ) ),
+                                            DGtal::uint32_t( sizeof( Quantity ) ) };
+      const DGtal::uint64_t nb = myContainer.size();
+      out.write( cacheFileMagic, 8 );
+      out.write( reinterpret_cast<const char*>( header ), sizeof( header ) );
+      out.write( reinterpret_cast<const char*>( &myH ), sizeof( myH ) );
+      out.write( reinterpret_cast<const char*>( &nb ), sizeof( nb ) );
+      for ( typename Container::const_iterator it = myContainer.begin();
+            it != myContainer.end(); ++it )
+        {
+          out.write( reinterpret_cast<const char*>( &it->first ), sizeof( Surfel ) );
+          out.write( reinterpret_cast<const char*>( &it->second ), sizeof( Quantity ) );
+        }
+      return out.good();
+    }
+
+    /**
+     * Reads cached quantities written by save(). The cache is then
+     * initialized (eval() may be called) and h() returns the saved
+     * gridstep if there is no estimator. The estimator is not used.
+     *
+     * @param in the input stream.
+     * @return 'true' if the cache was read, 'false' if the stream is
+     * not a cache of the same Surfel and Quantity types (the cache is
+     * then left uninitialized).
+     */
+    bool load( std::istream & in )
+    {
+      myContainer.clear();
+      myInit = false;
+      char magic[ 8 ];
+      DGtal::uint32_t header[ 3 ];
+      DGtal::uint64_t nb = 0;
+      double h = 0.0;
+      in.read( magic, 8 );
+      in.read( reinterpret_cast<char*>( header ), sizeof( header ) );
+      in.read( reinterpret_cast<char*>( &h ), sizeof( h ) );
+      in.read( reinterpret_cast<char*>( &nb ), sizeof( nb ) );
+      if ( ! in.good() || std::memcmp( magic, cacheFileMagic, 8 ) != 0
+           || header[ 0 ] != cacheFileVersion
+           || header[ 1 ] != sizeof( Surfel ) || header[ 2 ] != sizeof( Quantity ) )
+        return false;
+      std::vector<char> buffer( sizeof( Surfel ) + sizeof( Quantity ) );
+      for ( DGtal::uint64_t i = 0; i < nb; ++i )
+        {
+          if ( ! in.read( &buffer[ 0 ], buffer.size() ) )
+            {
+              myContainer.clear();
+              return false;
+            }
+          Surfel s;
+          Quantity q;
+          std::memcpy( static_cast<void*>( &s ), &buffer[ 0 ], sizeof( Surfel ) );
+          std::memcpy( static_cast<void*>( &q ), &buffer[ sizeof( Surfel ) ], sizeof( Quantity ) );
+          myContainer.insert( std::pair<Surfel, Quantity>( s, q ) );
+        }
+      myH = h;
+      myInit = true;
+      return true;
+    }
+
     /**
      * Writes/Displays the object on an output stream.
      * @param out the output stream where the object is written.
@@ -266,7 +438,7 @@ namespace DGtal
      */
     bool isValid() const
     {
-      return myEstimator && myEstimator->isValid();
+      return ( myEstimator && myEstimator->isValid() ) || ( ! myEstimator && myInit );
     }
     
     // ------------------------- Protected Datas ------------------------------
@@ -281,6 +453,15 @@ namespace DGtal
     ///Alias of the estimator
     Estimator *myEstimator;
 
+    ///Gridstep of the cached quantities
+    double myH;
+
+    ///Magic string of the files written by save()
+    static const char cacheFileMagic[ 9 ];
+
+    ///Version of the file format written by save()
+    static const DGtal::uint32_t cacheFileVersion = 1;
+
     ///Init flag
     bool myInit;
     
@@ -288,6 +469,9 @@ namespace DGtal
   private:
     
   }; // end of class EstimatorCache
+
+  template <typename TEstimator, typename TContainer>
+  const char EstimatorCache<TEstimator, TContainer>::cacheFileMagic[ 9 ] = "DGtalEC\0";
   
   
   /**
@@ -0,0 +1,293 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file LightKanungoNoise.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module LightKanungoNoise.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(LightKanungoNoise_RECURSES)
+#error Recursive header files inclusion detected in LightKanungoNoise.h
+#else // defined(LightKanungoNoise_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define LightKanungoNoise_RECURSES
+
+#if !defined LightKanungoNoise_h
+/** Prevents repeated inclusion of headers. */
+#define LightKanungoNoise_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstdint>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/kernel/CPointPredicate.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class LightKanungoNoise
+  /**
+   * Description of template class 'LightKanungoNoise' <p>
+   * \brief Aim: From a point predicate (model of concepts::CPointPredicate), this class
+   * constructs another point predicate as a noisy version of the input one,
+   * following the Kanungo noise model (see KanungoNoise), but without storing
+   * the noisy object.
+   *
+   * Contrary to KanungoNoise, the random value associated to a point
+   * is not drawn from a sequential random generator: it is obtained
+   * from a counter-based generator, i.e. a 64-bit mixing function of
+   * a seed and of the linearized index of the point in the
+   * domain. Hence:
+   * - the noisy predicate can be evaluated lazily at any point, in any order;
+   * - the result only depends on the seed, the input predicate and the
+   *   domain, and not on the evaluation order or the number of threads;
+   * - the whole noisy object can be written into a dense (binary) image in
+   *   parallel with fill() (OpenMP is used when DGtal is built with
+   *   WITH_OPENMP).
+   *
+   * Only the two distance transformations (inside and outside the
+   * input object) are stored.
+   *
+   * @code
+   * LightKanungoNoise<Z3i::DigitalSet, Z3i::Domain> noisy( set, domain, 0.5, 42 );
+   * ImageContainerBySTLVector<Z3i::Domain, bool> image( domain );
+   * noisy.fill( image );
+   * @endcode
+   *
+   * @tparam TPointPredicate any model of point predicate concept (concepts::CPointPredicate)
+   * @tparam TDomain any HyperRectDomain
+   *
+   * @see KanungoNoise
+   */
+  template <typename TPointPredicate, typename TDomain>
+  class LightKanungoNoise
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    ///Concept checks
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain< TDomain > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+
+    ///Object type
+    typedef TPointPredicate PointPredicate;
+
+    ///Domain type
+    typedef TDomain Domain;
+
+    ///Space type
+    typedef typename Domain::Space Space;
+
+    ///Point type
+    typedef typename Domain::Point Point;
+
+    ///Size type
+    typedef typename Domain::Size Size;
+
+    ///Linearizer used to key the random generator
+    typedef Linearizer<Domain, ColMajorStorage> DomainLinearizer;
+
+    ///Metric used for the distance transformations
+    typedef ExactPredicateLpSeparableMetric<Space, 2> L2Metric;
+
+    ///Complement of the input predicate
+    typedef functors::NotPointPredicate<PointPredicate> NotPredicate;
+
+    ///Distance transformation of the input object
+    typedef DistanceTransformation<Space, PointPredicate, L2Metric> DTPredicate;
+
+    ///Distance transformation of the complement of the input object
+    typedef DistanceTransformation<Space, NotPredicate, L2Metric> DTNotPredicate;
+
+    /**
+     * Constructor.
+     * This constructor computes the distance transformations of the
+     * object and of its complement.
+     *
+     * @param aPredicate input point predicate defining the input objects.
+     * @param aDomain domain used for the distance transformation computation.
+     * @param anAlpha noise parameter between ]0,1[.
+     * @param aSeed seed of the counter-based random generator.
+     */
+    LightKanungoNoise( ConstAlias<PointPredicate> aPredicate,
+                       ConstAlias<Domain> aDomain,
+                       const double anAlpha,
+                       const std::uint64_t aSeed = 0 );
+
+    /**
+     * Destructor.
+     */
+    ~LightKanungoNoise() = default;
+
+    /**
+     * Copy constructor. The distance transformations are shared.
+     * @param other the object to clone.
+     */
+    LightKanungoNoise ( const LightKanungoNoise & other ) = default;
+
+    /**
+     * Assignment. The distance transformations are shared.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    LightKanungoNoise & operator= ( const LightKanungoNoise & other ) = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * PointPredicate concept method.
+     *
+     * @param aPoint point to probe the predicate at (must be in the domain).
+     * @return true if the point is inside the noisified object.
+     */
+    bool operator()( const Point & aPoint ) const;
+
+    /**
+     * Uniform random value in [0,1) associated to a point. This value
+     * only depends on the seed and on the position of the point in
+     * the domain.
+     *
+     * @param aPoint a point of the domain.
+     * @return the random value associated to @a aPoint.
+     */
+    double uniform( const Point & aPoint ) const;
+
+    /**
+     * Writes the noisified object into an image defined on the same
+     * domain (e.g. ImageContainerBySTLVector<Domain,bool>). Points
+     * are processed by blocks of consecutive linearized indices
+     * (multiple of 64), so that images backed by a packed bit vector
+     * can be filled from several threads.
+     *
+     * @tparam TImage a model of concepts::CImage with boolean (or convertible) values.
+     * @param[in,out] anImage the image to fill, whose domain must be the noise domain.
+     */
+    template <typename TImage>
+    void fill( TImage & anImage ) const;
+
+    /**
+     * Counts the points of the noisified object (in parallel if
+     * OpenMP is available).
+     *
+     * @return the number of points of the domain in the noisified object.
+     */
+    Size count() const;
+
+    /// @return the domain.
+    const Domain & domain() const;
+
+    /// @return the noise parameter.
+    double alpha() const;
+
+    /// @return the seed of the random generator.
+    std::uint64_t seed() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Number of consecutive points processed by a thread in fill() and count().
+    static const std::int64_t BLOCK_SIZE = 4096;
+
+    /**
+     * 64-bit mixing function (SplitMix64 finalizer).
+     * @param x any value.
+     * @return the mixed value.
+     */
+    static std::uint64_t mix( std::uint64_t x );
+
+    ///Alias to the input predicate
+    const PointPredicate * myPredicate;
+
+    ///Copy of the domain
+    CountedPtr<Domain> myDomain;
+
+    ///Noise parameter
+    double myAlpha;
+
+    ///Seed of the counter-based generator
+    std::uint64_t mySeed;
+
+    ///Euclidean metric
+    CountedPtr<L2Metric> myMetric;
+
+    ///Complement of the input predicate
+    CountedPtr<NotPredicate> myNotPredicate;
+
+    ///Distance transformation of the object
+    CountedPtr<DTPredicate> myDTin;
+
+    ///Distance transformation of the complement
+    CountedPtr<DTNotPredicate> myDTout;
+
+  }; // end of class LightKanungoNoise
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'LightKanungoNoise'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'LightKanungoNoise' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TP, typename TD>
+  std::ostream&
+  operator<< ( std::ostream & out, const LightKanungoNoise<TP,TD> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/LightKanungoNoise.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined LightKanungoNoise_h
+
+#undef LightKanungoNoise_RECURSES
+#endif // else defined(LightKanungoNoise_RECURSES)
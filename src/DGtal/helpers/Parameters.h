@@ -43,6 +43,7 @@
 #include <iostream>
 #include <string>
 #include <sstream>
+#include <map>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
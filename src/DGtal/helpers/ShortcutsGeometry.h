@@ -39,6 +39,7 @@
 #define ShortcutsGeometry_h
 
 //////////////////////////////////////////////////////////////////////////////
+#include <memory>
 #include "DGtal/helpers/Shortcuts.h"
 #include "DGtal/geometry/volumes/distance/LpMetric.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
@@ -48,6 +49,9 @@
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
 #include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeEstimator.h"
 #include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -145,6 +149,7 @@ namespace DGtal
       typedef typename IdxDigitalSurface::ArcRange                IdxArcRange;
       typedef std::set< IdxSurfel >                               IdxSurfelSet;
       typedef std::vector< Surfel >                               SurfelRange;
+      typedef typename SurfelRange::const_iterator                SurfelConstIterator;
       typedef std::vector< Cell >                                 CellRange;
       typedef std::vector< IdxSurfel >                            IdxSurfelRange;
       typedef std::vector< Scalar >                               Scalars;
@@ -191,13 +196,15 @@ namespace DGtal
       ///   - projectionAccuracy[0.0001]: the zero-proximity stop criterion during projection.
       ///   - projectionGamma   [   0.5]: the damping coefficient of the projection.
       ///   - gridstep [  1.0]: the gridstep that defines the digitization (often called h).
+      ///   - threads           [     1]: the number of threads used by estimators (0: all available, only effective WITH_OPENMP).
       static Parameters parametersShapeGeometry()
       {
         return Parameters
           ( "projectionMaxIter", 20 )
           ( "projectionAccuracy", 0.0001 )
           ( "projectionGamma",    0.5 )
-          ( "gridstep",           1.0 );
+          ( "gridstep",           1.0 )
+          ( "threads",              1 );
       }
     
       /// Given a space \a K, an implicit \a shape, a sequence of \a
@@ -215,6 +222,7 @@ namespace DGtal
       ///   - projectionAccuracy[0.0001]: the zero-proximity stop criterion during projection.
       ///   - projectionGamma   [   0.5]: the damping coefficient of the projection.
       ///   - gridstep [  1.0]: the gridstep that defines the digitization (often called h).
+      ///   - threads           [     1]: the number of threads used by the estimator (0: all available).
       ///
       /// @return the vector containing the true normals, in the same
       /// order as \a surfels.
@@ -225,18 +233,21 @@ namespace DGtal
           const SurfelRange&          surfels,
           const Parameters&           params = parametersShapeGeometry() )
       {
-        RealVectors         n_true_estimations;
-        TruePositionEstimator true_estimator;
         int     maxIter = params[ "projectionMaxIter"  ].as<int>();
         double accuracy = params[ "projectionAccuracy" ].as<double>();
         double    gamma = params[ "projectionGamma"    ].as<double>();
         Scalar gridstep = params[ "gridstep"           ].as<Scalar>();
-        true_estimator.attach( *shape );
-        true_estimator.setParams( K, PositionFunctor(), maxIter, accuracy, gamma );
-        true_estimator.init( gridstep, surfels.begin(), surfels.end() );
-        true_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( n_true_estimations ) );
-        return n_true_estimations;
+        return estimateByChunks< RealPoints >
+          ( surfels, getThreadCount( params ),
+            [&] ( SurfelConstIterator itb, SurfelConstIterator ite,
+                  RealPoints& chunk_estimations )
+            {
+              TruePositionEstimator true_estimator;
+              true_estimator.attach( *shape );
+              true_estimator.setParams( K, PositionFunctor(), maxIter, accuracy, gamma );
+              true_estimator.init( gridstep, itb, ite );
+              true_estimator.eval( itb, ite, std::back_inserter( chunk_estimations ) );
+            } );
       }
 
       /// Given an implicit \a shape and a sequence of \a points,
@@ -283,6 +294,7 @@ namespace DGtal
       ///   - projectionAccuracy[0.0001]: the zero-proximity stop criterion during projection.
       ///   - projectionGamma   [   0.5]: the damping coefficient of the projection.
       ///   - gridstep [  1.0]: the gridstep that defines the digitization (often called h).
+      ///   - threads           [     1]: the number of threads used by the estimator (0: all available).
       ///
       /// @return the vector containing the true normals, in the same
       /// order as \a surfels.
@@ -293,18 +305,21 @@ namespace DGtal
           const SurfelRange&          surfels,
           const Parameters&           params = parametersShapeGeometry() )
       {
-        RealVectors         n_true_estimations;
-        TrueNormalEstimator true_estimator;
         int     maxIter = params[ "projectionMaxIter"  ].as<int>();
         double accuracy = params[ "projectionAccuracy" ].as<double>();
         double    gamma = params[ "projectionGamma"    ].as<double>();
         Scalar gridstep = params[ "gridstep"           ].as<Scalar>();
-        true_estimator.attach( *shape );
-        true_estimator.setParams( K, NormalFunctor(), maxIter, accuracy, gamma );
-        true_estimator.init( gridstep, surfels.begin(), surfels.end() );
-        true_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( n_true_estimations ) );
-        return n_true_estimations;
+        return estimateByChunks< RealVectors >
+          ( surfels, getThreadCount( params ),
+            [&] ( SurfelConstIterator itb, SurfelConstIterator ite,
+                  RealVectors& chunk_estimations )
+            {
+              TrueNormalEstimator true_estimator;
+              true_estimator.attach( *shape );
+              true_estimator.setParams( K, NormalFunctor(), maxIter, accuracy, gamma );
+              true_estimator.init( gridstep, itb, ite );
+              true_estimator.eval( itb, ite, std::back_inserter( chunk_estimations ) );
+            } );
       }
     
       /// Given a space \a K, an implicit \a shape, a sequence of \a
@@ -322,6 +337,7 @@ namespace DGtal
       ///   - projectionAccuracy[0.0001]: the zero-proximity stop criterion during projection.
       ///   - projectionGamma   [   0.5]: the damping coefficient of the projection.
       ///   - gridstep [  1.0]: the gridstep that defines the digitization (often called h).
+      ///   - threads           [     1]: the number of threads used by the estimator (0: all available).
       ///
       /// @return the vector containing the mean curvatures, in the same
       /// order as \a surfels.
@@ -332,18 +348,21 @@ namespace DGtal
           const SurfelRange&          surfels,
           const Parameters&           params = parametersShapeGeometry() )
       {
-        Scalars                n_true_estimations;
-        TrueMeanCurvatureEstimator true_estimator;
         int     maxIter = params[ "projectionMaxIter"  ].as<int>();
         double accuracy = params[ "projectionAccuracy" ].as<double>();
         double    gamma = params[ "projectionGamma"    ].as<double>();
         Scalar gridstep = params[ "gridstep"           ].as<Scalar>();
-        true_estimator.attach( *shape );
-        true_estimator.setParams( K, MeanCurvatureFunctor(), maxIter, accuracy, gamma );
-        true_estimator.init( gridstep, surfels.begin(), surfels.end() );
-        true_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( n_true_estimations ) );
-        return n_true_estimations;
+        return estimateByChunks< Scalars >
+          ( surfels, getThreadCount( params ),
+            [&] ( SurfelConstIterator itb, SurfelConstIterator ite,
+                  Scalars& chunk_estimations )
+            {
+              TrueMeanCurvatureEstimator true_estimator;
+              true_estimator.attach( *shape );
+              true_estimator.setParams( K, MeanCurvatureFunctor(), maxIter, accuracy, gamma );
+              true_estimator.init( gridstep, itb, ite );
+              true_estimator.eval( itb, ite, std::back_inserter( chunk_estimations ) );
+            } );
       }
     
       /// Given a space \a K, an implicit \a shape, a sequence of \a
@@ -362,6 +381,7 @@ namespace DGtal
       ///   - projectionAccuracy[0.0001]: the zero-proximity stop criterion during projection.
       ///   - projectionGamma   [   0.5]: the damping coefficient of the projection.
       ///   - gridstep [  1.0]: the gridstep that defines the digitization (often called h).
+      ///   - threads           [     1]: the number of threads used by the estimator (0: all available).
       ///
       /// @return the vector containing the gaussian curvatures, in the same
       /// order as \a surfels.
@@ -372,18 +392,21 @@ namespace DGtal
           const SurfelRange&          surfels,
           const Parameters&           params = parametersShapeGeometry() )
       {
-        Scalars                n_true_estimations;
-        TrueGaussianCurvatureEstimator true_estimator;
         int     maxIter = params[ "projectionMaxIter"  ].as<int>();
         double accuracy = params[ "projectionAccuracy" ].as<double>();
         double    gamma = params[ "projectionGamma"    ].as<double>();
         Scalar gridstep = params[ "gridstep"           ].as<Scalar>();
-        true_estimator.attach( *shape );
-        true_estimator.setParams( K, GaussianCurvatureFunctor(), maxIter, accuracy, gamma );
-        true_estimator.init( gridstep, surfels.begin(), surfels.end() );
-        true_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( n_true_estimations ) );
-        return n_true_estimations;
+        return estimateByChunks< Scalars >
+          ( surfels, getThreadCount( params ),
+            [&] ( SurfelConstIterator itb, SurfelConstIterator ite,
+                  Scalars& chunk_estimations )
+            {
+              TrueGaussianCurvatureEstimator true_estimator;
+              true_estimator.attach( *shape );
+              true_estimator.setParams( K, GaussianCurvatureFunctor(), maxIter, accuracy, gamma );
+              true_estimator.init( gridstep, itb, ite );
+              true_estimator.eval( itb, ite, std::back_inserter( chunk_estimations ) );
+            } );
       }
     
     
@@ -400,6 +423,7 @@ namespace DGtal
       ///   - kernel          [ "hat"]: the kernel integration function chi_r, either "hat" or "ball". )
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - surfelEmbedding [     0]: the surfel -> point embedding for VCM estimator: 0: Pointels, 1: InnerSpel, 2: OuterSpel.
+      ///   - threads         [     1]: the number of threads used by estimators (0: all available, only effective WITH_OPENMP).
       static Parameters parametersGeometryEstimation()
       {
         return Parameters
@@ -409,7 +433,8 @@ namespace DGtal
           ( "R-radius",       10.0 )
           ( "r-radius",        3.0 )
           ( "alpha",          0.33 )
-          ( "surfelEmbedding",   0 );
+          ( "surfelEmbedding",   0 )
+          ( "threads",           1 );
       }
     
       /// Given a digital space \a K and a vector of \a surfels,
@@ -449,6 +474,7 @@ namespace DGtal
       /// @param[in] params the parameters:
       ///   - verbose         [     1]: verbose trace mode 0: silent, 1: verbose.
       ///   - t-ring          [   3.0]: the radius used when computing convolved trivial normals (it is a graph distance, not related to the grid step).
+      ///   - threads         [     1]: the number of threads used by the estimator (0: all available).
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -472,16 +498,30 @@ namespace DGtal
             trace.info() << " CTrivial normal t=" << t << " (discrete)" << std::endl;
           const Functor fct( 1.0, t );
           const KSpace &  K = surface->container().space();
-          Metric    aMetric( 2.0 );
-          CanonicSCellEmbedder<KSpace> canonic_embedder( K );
-          std::vector< RealVector >    n_estimations;
-          SurfelFunctor                surfelFct( canonic_embedder, 1.0 );
-          NormalEstimator              estimator;
-          estimator.attach( *surface);
-          estimator.setParams( aMetric, surfelFct, fct, t );
-          estimator.init( 1.0, surfels.begin(), surfels.end());
-          estimator.eval( surfels.begin(), surfels.end(),
-                          std::back_inserter( n_estimations ) );
+          const Metric    aMetric( 2.0 );
+          const CanonicSCellEmbedder<KSpace> canonic_embedder( K );
+          // The surfel functor accumulates the convolved normal and the
+          // surface tracks its neighbors, hence each chunk has its own
+          // estimator, surfel functor and, with several threads, copy of
+          // the surface.
+          const int nbThreads = getThreadCount( params );
+          RealVectors n_estimations = estimateByChunks< RealVectors >
+            ( surfels, nbThreads,
+              [&] ( SurfelConstIterator itb, SurfelConstIterator ite,
+                    RealVectors& chunk_estimations )
+              {
+                std::unique_ptr<TAnyDigitalSurface> surface_copy;
+                if ( nbThreads > 1 )
+                  surface_copy.reset( new TAnyDigitalSurface( *surface ) );
+                const TAnyDigitalSurface&    chunk_surface
+                  = surface_copy ? *surface_copy : *surface;
+                SurfelFunctor                surfelFct( canonic_embedder, 1.0 );
+                NormalEstimator              estimator;
+                estimator.attach( chunk_surface );
+                estimator.setParams( aMetric, surfelFct, fct, t );
+                estimator.init( 1.0, itb, ite );
+                estimator.eval( itb, ite, std::back_inserter( chunk_estimations ) );
+              } );
           std::transform( n_estimations.cbegin(), n_estimations.cend(), n_estimations.begin(),
                           [] ( RealVector v ) { return -v; } );
           return n_estimations;
@@ -505,9 +545,13 @@ namespace DGtal
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - surfelEmbedding [     0]: the surfel -> point embedding for VCM estimator: 0: Pointels, 1: InnerSpel, 2: OuterSpel.
       ///   - gridstep [  1.0]: the gridstep that defines the digitization (often called h).
+      ///   - threads         [     1]: the number of threads used to evaluate the estimator (0: all available).
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
+      ///
+      /// @note The VCM is computed once for the whole surface, only
+      /// the evaluations at \a surfels are distributed among threads.
       template <typename TAnyDigitalSurface>
         static RealVectors
         getVCMNormalVectors
@@ -526,6 +570,7 @@ namespace DGtal
           Scalar      t      = params[ "t-ring"    ].as<Scalar>();
           Scalar      alpha  = params[ "alpha"     ].as<Scalar>();
           int      embedding = params[ "embedding" ].as<int>();
+          int      nbThreads = getThreadCount( params );
           // Adjust parameters according to gridstep if specified.
           if ( alpha != 1.0 ) R *= pow( h, alpha-1.0 );
           if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
@@ -554,8 +599,13 @@ namespace DGtal
               estimator.attach( *surface );
               estimator.setParams( embType, R, r, chi_r, t, Metric(), verbose > 0 );
               estimator.init( h, surfels.begin(), surfels.end() );
-              estimator.eval( surfels.begin(), surfels.end(),
-                              std::back_inserter( n_estimations ) );
+              n_estimations = estimateByChunks< RealVectors >
+                ( surfels, nbThreads,
+                  [&] ( SurfelConstIterator itb, SurfelConstIterator ite,
+                        RealVectors& chunk_estimations )
+                  {
+                    estimator.eval( itb, ite, std::back_inserter( chunk_estimations ) );
+                  } );
             }
           else if ( kernel == "ball" )
             {
@@ -570,8 +620,13 @@ namespace DGtal
               estimator.attach( *surface );
               estimator.setParams( embType, R, r, chi_r, t, Metric(), verbose > 0 );
               estimator.init( h, surfels.begin(), surfels.end() );
-              estimator.eval( surfels.begin(), surfels.end(),
-                              std::back_inserter( n_estimations ) );
+              n_estimations = estimateByChunks< RealVectors >
+                ( surfels, nbThreads,
+                  [&] ( SurfelConstIterator itb, SurfelConstIterator ite,
+                        RealVectors& chunk_estimations )
+                  {
+                    estimator.eval( itb, ite, std::back_inserter( chunk_estimations ) );
+                  } );
             }
           else
             {
@@ -593,6 +648,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads used by the estimator (0: all available).
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -628,6 +684,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads used by the estimator (0: all available).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -669,6 +726,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads used by the estimator (0: all available).
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -704,14 +762,19 @@ namespace DGtal
               trace.info() << "- II normal r=" << (r*h)  << " (continuous) "
                            << r << " (discrete)" << std::endl;
             }
-          IINormalFunctor     functor;
-          functor.init( h, r*h );
-          IINormalEstimator   ii_estimator( functor );
-          ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
-          ii_estimator.init( h, surfels.begin(), surfels.end() );
-          ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( n_estimations ) );
+          n_estimations = estimateByChunks< RealVectors >
+            ( surfels, getThreadCount( params ),
+              [&] ( SurfelConstIterator itb, SurfelConstIterator ite,
+                    RealVectors& chunk_estimations )
+              {
+                IINormalFunctor     functor;
+                functor.init( h, r*h );
+                IINormalEstimator   ii_estimator( functor );
+                ii_estimator.attach( K, shape );
+                ii_estimator.setParams( r );
+                ii_estimator.init( h, itb, ite );
+                ii_estimator.eval( itb, ite, std::back_inserter( chunk_estimations ) );
+              } );
           const RealVectors n_trivial = getTrivialNormalVectors( K, surfels );
           orientVectors( n_estimations, n_trivial );
           return n_estimations;
@@ -730,6 +793,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads used by the estimator (0: all available).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
@@ -761,6 +825,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads used by the estimator (0: all available).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -800,6 +865,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads used by the estimator (0: all available).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
@@ -819,7 +885,6 @@ namespace DGtal
           typedef IntegralInvariantVolumeEstimator
             <KSpace, TPointPredicate, IIMeanCurvFunctor>    IIMeanCurvEstimator;
 
-          Scalars  mc_estimations;
           int      verbose = params[ "verbose"   ].as<int>();
           Scalar   h       = params[ "gridstep"  ].as<Scalar>();
           Scalar   r       = params[ "r-radius"  ].as<Scalar>();
@@ -831,15 +896,19 @@ namespace DGtal
               trace.info() << "- II mean curvature r=" << (r*h)  << " (continuous) "
                            << r << " (discrete)" << std::endl;
             }
-          IIMeanCurvFunctor   functor;
-          functor.init( h, r*h );
-          IIMeanCurvEstimator ii_estimator( functor );
-          ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
-          ii_estimator.init( h, surfels.begin(), surfels.end() );
-          ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( mc_estimations ) );
-          return mc_estimations;
+          return estimateByChunks< Scalars >
+            ( surfels, getThreadCount( params ),
+              [&] ( SurfelConstIterator itb, SurfelConstIterator ite,
+                    Scalars& chunk_estimations )
+              {
+                IIMeanCurvFunctor   functor;
+                functor.init( h, r*h );
+                IIMeanCurvEstimator ii_estimator( functor );
+                ii_estimator.attach( K, shape );
+                ii_estimator.setParams( r );
+                ii_estimator.init( h, itb, ite );
+                ii_estimator.eval( itb, ite, std::back_inserter( chunk_estimations ) );
+              } );
         }
 
       /// Given a digital shape \a bimage, a sequence of \a surfels,
@@ -854,6 +923,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads used by the estimator (0: all available).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -885,6 +955,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads used by the estimator (0: all available).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -924,6 +995,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - threads         [     1]: the number of threads used by the estimator (0: all available).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -943,7 +1015,6 @@ namespace DGtal
           typedef IntegralInvariantCovarianceEstimator
             <KSpace, TPointPredicate, IIGaussianCurvFunctor>    IIGaussianCurvEstimator;
 
-          Scalars  mc_estimations;
           int      verbose = params[ "verbose"   ].as<int>();
           Scalar   h       = params[ "gridstep"  ].as<Scalar>();
           Scalar   r       = params[ "r-radius"  ].as<Scalar>();
@@ -955,15 +1026,19 @@ namespace DGtal
               trace.info() << "- II Gaussian curvature r=" << (r*h)  << " (continuous) "
                            << r << " (discrete)" << std::endl;
             }
-          IIGaussianCurvFunctor   functor;
-          functor.init( h, r*h );
-          IIGaussianCurvEstimator ii_estimator( functor );
-          ii_estimator.attach( K, shape );
-          ii_estimator.setParams( r );
-          ii_estimator.init( h, surfels.begin(), surfels.end() );
-          ii_estimator.eval( surfels.begin(), surfels.end(),
-                             std::back_inserter( mc_estimations ) );
-          return mc_estimations;
+          return estimateByChunks< Scalars >
+            ( surfels, getThreadCount( params ),
+              [&] ( SurfelConstIterator itb, SurfelConstIterator ite,
+                    Scalars& chunk_estimations )
+              {
+                IIGaussianCurvFunctor   functor;
+                functor.init( h, r*h );
+                IIGaussianCurvEstimator ii_estimator( functor );
+                ii_estimator.attach( K, shape );
+                ii_estimator.setParams( r );
+                ii_estimator.init( h, itb, ite );
+                ii_estimator.eval( itb, ite, std::back_inserter( chunk_estimations ) );
+              } );
         }
     
 
@@ -1141,6 +1216,73 @@ namespace DGtal
       // ------------------------- Hidden services ------------------------------
     protected:
 
+      /// @param[in] params the parameters:
+      ///   - threads [ 1]: the number of threads (0: all available).
+      ///
+      /// @return the number of threads used by estimators. When DGtal
+      /// is not built WITH_OPENMP, "threads" only sets the number of
+      /// chunks, which are then processed sequentially.
+      static int
+        getThreadCount( const Parameters& params )
+      {
+        int nb = params.count( "threads" ) ? params[ "threads" ].as<int>() : 1;
+#ifdef WITH_OPENMP
+        if ( nb <= 0 ) nb = omp_get_max_threads();
+#endif
+        return std::max( nb, 1 );
+      }
+
+      /// Splits \a surfels into \a nbThreads contiguous chunks,
+      /// estimates each chunk in parallel and concatenates the chunk
+      /// estimations in the order of \a surfels.
+      ///
+      /// Chunks are kept contiguous since some estimators (e.g. II)
+      /// are faster on consecutive surfels. Every chunk must build its
+      /// own estimator, so that the result does not depend on the
+      /// number of threads.
+      ///
+      /// @tparam TValues the type of the output vector (Scalars, RealVectors, ...).
+      /// @tparam TChunkEstimation the type of a function
+      /// (SurfelConstIterator itb, SurfelConstIterator ite, TValues& out)
+      /// that appends to \a out the estimations at [itb,ite).
+      ///
+      /// @param[in] surfels the sequence of surfels.
+      /// @param[in] nbThreads the number of threads (and chunks).
+      /// @param[in] estimateChunk the estimation of one chunk.
+      /// @return the estimations, in the same order as \a surfels.
+      template <typename TValues, typename TChunkEstimation>
+        static TValues
+        estimateByChunks( const SurfelRange&      surfels,
+                          int                     nbThreads,
+                          const TChunkEstimation& estimateChunk )
+        {
+          if ( nbThreads <= 1 || surfels.size() < 2 )
+            {
+              TValues result;
+              result.reserve( surfels.size() );
+              estimateChunk( surfels.cbegin(), surfels.cend(), result );
+              return result;
+            }
+          const std::int64_t nb       = surfels.size();
+          const std::int64_t nbChunks = std::min( nb, std::int64_t( nbThreads ) );
+          std::vector< TValues > chunks( nbChunks );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static,1) num_threads(nbThreads)
+#endif
+          for ( std::int64_t c = 0; c < nbChunks; ++c )
+            {
+              SurfelConstIterator itb = surfels.cbegin() + ( c * nb ) / nbChunks;
+              SurfelConstIterator ite = surfels.cbegin() + ( ( c + 1 ) * nb ) / nbChunks;
+              chunks[ c ].reserve( ite - itb );
+              estimateChunk( itb, ite, chunks[ c ] );
+            }
+          TValues result;
+          result.reserve( surfels.size() );
+          for ( const TValues& chunk : chunks )
+            result.insert( result.end(), chunk.cbegin(), chunk.cend() );
+          return result;
+        }
+
       // ------------------------- Internals ------------------------------------
     private:
 
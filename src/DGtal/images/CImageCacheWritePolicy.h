@@ -77,6 +77,8 @@ Description of \b concept '\b CImageCacheWritePolicy' <p>
 |---------------------|-------------------------|------------------------------------------------------------|-------------------|--------------|-------------------------------------------------------------|----------------|------------|
 | Write in page       | x.writeInPage(i,p,v)    | i of type ImageContainer, p of type Point, v of type Value |                   |              | set a value v on an image i at a given position p           |                |            |
 | Flush page          | x.flushPage(i)          | i of type ImageContainer                                   |                   |              | flush the image i on disk according to the cache policy     |                |            |
+| Mark page dirty     | x.markPageDirty(i)      | i of type ImageContainer                                   |                   |              | tell that the image i was modified directly                 |                |            |
+| Clear cache         | x.clearCache()          |                                                            |                   |              | forget the modified images (the cache is cleared)           |                |            |
 
 ### Invariants
 
@@ -99,6 +101,8 @@ public:
     {
         myT.writeInPage(myIC, myPoint, myValue);
         myT.flushPage(myIC);
+        myT.markPageDirty(myIC);
+        myT.clearCache();
 
         // check const methods.
         checkConstConstraints();
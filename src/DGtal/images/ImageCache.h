@@ -41,6 +41,14 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -72,6 +80,34 @@ namespace DGtal
  *  - read :    for getting the value of an image from cache at a given position given by a point only if that point belongs to an image from cache
  *  - write :   for setting a   value on an image from cache at a given position given by a point only if that point belongs to an image from cache
  *  - update :  for updating the cache according to the read cache policy
+ * 
+ * The cache is thread-safe. A hit only looks up the pages in the
+ * cache: hits of several threads do not lock each other out, and
+ * their accesses are reported to the read policy at the next update.
+ * Only a miss (an update of the cache) and the pinning of pages lock
+ * the whole cache, waiting for the pending hits. Writes call the write
+ * policy and are serialized, but do not block the reads. Since another
+ * thread may update the cache between a failed read() and the
+ * following update(), concurrent code should rather use the compound
+ * functions fetch(), store() and fetchPage(), which check, load and
+ * access a page atomically.
+ * 
+ * Pages can also be loaded in advance by a background thread with
+ * prefetch(), e.g. the next tiles of a TiledImage traversal. The
+ * worker thread is started by the first call to prefetch() and is
+ * stopped by the destructor.
+ * 
+ * @note An alias on a page (see getPage() and fetchPage()) remains
+ * valid until the page is detached, i.e. until the next update of
+ * the cache: it should not be kept by a thread while other threads
+ * or the prefetch thread may load pages, unless the read policy keeps
+ * enough pages (ImageCacheReadPolicyCLOCK never detaches the page
+ * accessed last).
+ * 
+ * To work on a page directly without such a constraint, a thread can
+ * pin it with acquirePage(): a pinned page selected by the read policy
+ * to be detached leaves the cache but remains valid, and is flushed
+ * and detached by the last releasePage().
  */
 template <typename TImageContainer, typename TImageFactory, typename TReadPolicy, typename TWritePolicy>
 class ImageCache
@@ -110,21 +146,22 @@ public:
      * @param aWritePolicy a write policy.
      */
     ImageCache(Alias<ImageFactory> anImageFactory, Alias<ReadPolicy> aReadPolicy, Alias<WritePolicy> aWritePolicy):
-      myImageFactoryPtr(&anImageFactory), myReadPolicy(&aReadPolicy), myWritePolicy(&aWritePolicy)
+      myImageFactoryPtr(&anImageFactory), myReadPolicy(&aReadPolicy), myWritePolicy(&aWritePolicy),
+      myReaders(0), myIsUpdating(false), myLastHit(NULL),
+      myPrefetchStop(false), myPrefetchBusy(false)
     {
       myReadPolicy->clearCache();
       
       cacheMissRead = 0;
       cacheMissWrite = 0;
+      prefetchLoads = 0;
     }
     
     /**
      * Destructor.
-     * Does nothing
+     * Stops the prefetch thread (pending prefetches are discarded).
      */
-    ~ImageCache()
-    {
-    }
+    ~ImageCache();
     
 private:
     
@@ -169,6 +206,19 @@ public:
     */
     bool read(const Point & aPoint, Value &aValue) const;
     
+    /**
+     * Get the value of an image at a given position given by aPoint,
+     * loading the page aDomain (and counting a read cache miss) if
+     * aPoint does not belong to an image from cache. The check, the
+     * load and the read are done atomically.
+     *
+     * @param aPoint the point.
+     * @param aDomain the domain of the page containing aPoint.
+     * 
+     * @return the value at aPoint.
+     */
+    Value fetch(const Point & aPoint, const Domain & aDomain);
+    
     /**
      * Get the alias on the image that matchs the domain aDomain
      * or NULL if no image in the cache matchs the domain aDomain.
@@ -190,6 +240,66 @@ public:
      */
     bool write(const Point & aPoint, const Value &aValue);
     
+    /**
+     * Set a value on an image at a given position given by aPoint,
+     * loading the page aDomain (and counting a write cache miss) if
+     * aPoint does not belong to an image from cache. The check, the
+     * load and the write are done atomically.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     * @param aDomain the domain of the page containing aPoint.
+     */
+    void store(const Point & aPoint, const Value &aValue, const Domain & aDomain);
+    
+    /**
+     * Get the alias on the image that matchs the domain aDomain,
+     * loading it (and counting a read cache miss) if it is not in
+     * the cache.
+     * 
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container.
+     */
+    ImageContainer * fetchPage(const Domain & aDomain);
+    
+    /**
+     * Get the alias on the image that matchs the domain aDomain,
+     * loading it if needed (see fetchPage), and pin it: the image
+     * remains valid until releasePage is called, even if the read
+     * policy detaches it from the cache in the meantime. A pinned
+     * image detached from the cache is returned again by acquirePage
+     * until it is released.
+     * 
+     * @note While a pinned image is out of the cache, accessing its
+     * domain through the other functions of the cache loads another
+     * copy: a pinned image should not be modified while its values
+     * are accessed with read/write or fetch/store by other threads.
+     * 
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container.
+     */
+    ImageContainer * acquirePage(const Domain & aDomain);
+    
+    /**
+     * Unpin an image pinned by acquirePage.
+     * 
+     * @param anImageContainer the image.
+     * @param isModified 'true' if the image was modified directly
+     * (it is then marked dirty, see markPageDirty).
+     */
+    void releasePage(ImageContainer * anImageContainer, bool isModified);
+    
+    /**
+     * Tell the write policy that an image from cache was modified
+     * directly (not with write or store), so that it is written when
+     * flushed.
+     * 
+     * @param anImageContainer the image.
+     */
+    void markPageDirty(ImageContainer * anImageContainer);
+    
     /**
      * Update the cache according to the read cache policy.
      * 
@@ -197,6 +307,34 @@ public:
      */
     void update(const Domain &aDomain);
     
+    /**
+     * Asks the prefetch thread to load the page aDomain if it is not
+     * in the cache. Returns immediately.
+     * 
+     * @param aDomain the domain.
+     */
+    void prefetch(const Domain &aDomain);
+    
+    /**
+     * Discards the pending prefetches (the page being loaded, if any,
+     * is still loaded).
+     */
+    void cancelPrefetches();
+    
+    /**
+     * Waits until the prefetch thread has processed all the pending
+     * prefetches.
+     */
+    void waitPrefetches();
+    
+    /**
+     * Get the number of pages loaded by the prefetch thread.
+     */
+    unsigned int getPrefetchLoads()
+    {
+        return prefetchLoads;
+    }
+    
     /**
      * Get the cacheMissRead value.
      */
@@ -232,13 +370,7 @@ public:
     /**
      * Clear the cache and reset the cache misses
      */
-    void clearCacheAndResetCacheMisses()
-    {
-      myReadPolicy->clearCache();
-      
-      cacheMissRead = 0;
-      cacheMissWrite = 0;
-    }
+    void clearCacheAndResetCacheMisses();
 
     // ------------------------- Protected Datas ------------------------------
 private:
@@ -260,11 +392,140 @@ protected:
 private:
     
     /// cache miss values
-    unsigned int cacheMissRead;
-    unsigned int cacheMissWrite;
+    std::atomic<unsigned int> cacheMissRead;
+    std::atomic<unsigned int> cacheMissWrite;
+    
+    /// number of pages loaded by the prefetch thread
+    std::atomic<unsigned int> prefetchLoads;
+    
+    /// A page in the cache, found without the read policy on a hit.
+    struct CachedPage
+    {
+      CachedPage(ImageContainer * aPage): page(aPage), isAccessed(false) {}
+      
+      ImageContainer * page;
+      
+      /// 'true' if the page was hit since the last update.
+      mutable std::atomic<bool> isAccessed;
+    };
+    
+    /// Serializes the updates of the cache (the accesses to the read
+    /// policy and to the factory).
+    mutable std::mutex myMutex;
+    
+    /// Serializes the accesses to the write policy.
+    mutable std::mutex myWriteMutex;
+    
+    /// Number of threads looking up the pages in the cache.
+    mutable std::atomic<unsigned int> myReaders;
+    
+    /// 'true' while the cache is updated.
+    mutable std::atomic<bool> myIsUpdating;
+    
+    /// The pages in the cache (modified only while updating).
+    std::list<CachedPage> myCachedPages;
+    
+    /// The page hit last, looked up first.
+    mutable std::atomic<const CachedPage *> myLastHit;
+    
+    /// Pin counts of the pages pinned by acquirePage.
+    std::map<ImageContainer *, unsigned int> myPinnedPages;
+    
+    /// Pinned pages detached from the read policy, released later.
+    std::set<ImageContainer *> myEvictedPinnedPages;
+    
+    /// Prefetch thread, its queue and its synchronization.
+    std::thread myPrefetchThread;
+    std::deque<Domain> myPrefetchQueue;
+    std::mutex myPrefetchMutex;
+    std::condition_variable myPrefetchCondition;
+    std::condition_variable myPrefetchDoneCondition;
+    bool myPrefetchStop;
+    bool myPrefetchBusy;
 
     // ------------------------- Internals ------------------------------------
 private:
+    
+    /**
+     * Locks the cache for a lookup: several threads may look up the
+     * pages at the same time, but not while the cache is updated.
+     */
+    void lockShared() const;
+    
+    /**
+     * Unlocks the cache after a lookup.
+     */
+    void unlockShared() const;
+    
+    /**
+     * Locks the cache for an update: waits for the pending lookups
+     * and prevents the new ones.
+     */
+    void lockExclusive() const;
+    
+    /**
+     * Unlocks the cache after an update.
+     */
+    void unlockExclusive() const;
+    
+    /**
+     * Locks the cache for a lookup (see lockShared) during its lifetime.
+     */
+    class SharedLock
+    {
+    public:
+      SharedLock(const Self & aCache): myCache(aCache) { myCache.lockShared(); }
+      ~SharedLock() { myCache.unlockShared(); }
+    private:
+      const Self & myCache;
+    };
+    
+    /**
+     * Locks the cache for an update (see lockExclusive) during its
+     * lifetime.
+     */
+    class ExclusiveLock
+    {
+    public:
+      ExclusiveLock(const Self & aCache): myCache(aCache) { myCache.lockExclusive(); }
+      ~ExclusiveLock() { myCache.unlockExclusive(); }
+    private:
+      const Self & myCache;
+    };
+    
+    /**
+     * Get the page of the cache containing aPoint, the cache being
+     * locked, and mark it as hit.
+     * 
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * hitPage(const Point & aPoint) const;
+    
+    /**
+     * Get the page of the cache that matchs the domain aDomain, the
+     * cache being locked.
+     * 
+     * @param aDomain the domain.
+     * @param isHit 'true' to mark the page as hit.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * findPage(const Domain & aDomain, bool isHit) const;
+    
+    /**
+     * Same as update, the cache being locked for an update. The hits
+     * since the last update are first reported to the read policy.
+     * 
+     * @param aDomain the domain.
+     */
+    void updateUnlocked(const Domain &aDomain);
+    
+    /**
+     * Loop of the prefetch thread.
+     */
+    void prefetchLoop();
 
 }; // end of class ImageCache
 
@@ -41,6 +41,9 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <deque>
+#include <set>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -266,6 +269,182 @@ protected:
     
 }; // end of class ImageCacheReadPolicyFIFO
 
+/////////////////////////////////////////////////////////////////////////////
+// Template class ImageCacheReadPolicyCLOCK
+/**
+ * Description of template class 'ImageCacheReadPolicyCLOCK' <p>
+ * \brief Aim: implements a 'CLOCK' read policy cache bounded by a
+ * memory budget (in bytes) instead of a number of pages.
+ * 
+ * CLOCK approximates LRU: each page has a 'referenced' bit, set when
+ * the page is accessed. When a page needs to be replaced, a hand
+ * sweeps the pages circularly, clearing the bits on its way, and
+ * selects the first page whose bit is already cleared. The page
+ * accessed last is never selected, so that a tile being traversed
+ * is not detached by a prefetch (see ImageCache::prefetch).
+ * 
+ * A page is detached when loading a page as large as the largest
+ * page seen so far would exceed the budget. Since only one page is
+ * detached per update, the budget may be exceeded by less than one
+ * page when the pages have different sizes (e.g. border tiles).
+ * 
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory.
+ * 
+ * The policy is done with 5 functions:
+ * 
+ *  - getPage :                 for getting the alias on the image that contains a point or NULL if no image in the cache contains that point
+ *  - getPage :                 for getting the alias on the image that contains a domain or NULL if no image in the cache contains that domain
+ *  - getPageToDetach :         for getting the alias on the image that we have to detach or NULL if no image have to be detached
+ *  - updateCache :             for updating the cache according to the cache policy
+ *  - clearCache :              for clearing the cache
+ */
+template <typename TImageContainer, typename TImageFactory>
+class ImageCacheReadPolicyCLOCK
+{
+public:
+  
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CImageFactory<TImageFactory> ));    
+    
+    typedef TImageFactory ImageFactory;
+    
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+    
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory.
+     * @param aByteBudget the memory budget of the cache (in bytes),
+     * at least one page is always kept.
+     */
+    ImageCacheReadPolicyCLOCK(Alias<ImageFactory> anImageFactory, std::size_t aByteBudget):
+      myHand(0), myLastPage(NULL), myBytes(0), myMaxPageBytes(0),
+      myByteBudget(aByteBudget), myImageFactory(&anImageFactory)
+    {
+    }
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageCacheReadPolicyCLOCK() {}
+    
+private:
+    
+    ImageCacheReadPolicyCLOCK( const ImageCacheReadPolicyCLOCK & other );
+    
+    ImageCacheReadPolicyCLOCK & operator=( const ImageCacheReadPolicyCLOCK & other );
+    
+public:
+    
+    /**
+     * Get the alias on the image that contains the point aPoint
+     * or NULL if no image in the cache contains the point aPoint.
+     * 
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Point & aPoint);
+    
+    /**
+     * Get the alias on the image that matchs the domain aDomain
+     * or NULL if no image in the cache matchs the domain aDomain.
+     * 
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Domain & aDomain);
+    
+    /**
+     * Get the alias on the image that we have to detach
+     * or NULL if no image have to be detached.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach();
+    
+    /**
+     * Update the cache according to the cache policy.
+     *
+     * @param aDomain the domain.
+     */
+    void updateCache(const Domain &aDomain);
+    
+    /**
+     * Clear the cache.
+     */
+    void clearCache();
+    
+    /**
+     * @return the number of pages in the cache.
+     */
+    std::size_t size() const
+    {
+      return mySlots.size();
+    }
+    
+    /**
+     * @return the memory used by the pages in the cache (in bytes).
+     */
+    std::size_t bytes() const
+    {
+      return myBytes;
+    }
+    
+    /**
+     * @return the memory budget of the cache (in bytes).
+     */
+    std::size_t byteBudget() const
+    {
+      return myByteBudget;
+    }
+    
+protected:
+    
+    /// A page in the cache with its size and its 'referenced' bit.
+    struct Slot
+    {
+      ImageContainer * page;
+      std::size_t bytes;
+      bool referenced;
+    };
+    
+    /**
+     * Marks a page as accessed.
+     * @param anIndex the index of the page in mySlots.
+     * @return the alias on the image container.
+     */
+    ImageContainer * touch(std::size_t anIndex);
+    
+    /// The pages in the cache, in the order swept by the hand.
+    std::vector<Slot> mySlots;
+    
+    /// Position of the hand in mySlots.
+    std::size_t myHand;
+    
+    /// Alias on the page accessed last.
+    ImageContainer * myLastPage;
+    
+    /// Memory used by the pages in the cache (in bytes).
+    std::size_t myBytes;
+    
+    /// Size of the largest page loaded so far (in bytes).
+    std::size_t myMaxPageBytes;
+    
+    /// Memory budget of the cache (in bytes).
+    std::size_t myByteBudget;
+    
+    /// Alias on the image factory
+    ImageFactory * myImageFactory;
+    
+}; // end of class ImageCacheReadPolicyCLOCK
+
 /////////////////////////////////////////////////////////////////////////////
 // Template class ImageCacheWritePolicyWT
 /**
@@ -281,6 +460,11 @@ protected:
  * 
  *  - writeInPage :     for setting a value on an image at a given position given by a point
  *  - flushPage :       for flushing the image on disk according to the cache policy
+ *  - markPageDirty :   for telling that an image was modified directly
+ *  - clearCache :      for forgetting the modified images
+ * 
+ * Pages modified directly (e.g. through a TiledImage iterator or a
+ * tile view) are marked dirty and are written when detached.
  */
 template <typename TImageContainer, typename TImageFactory>
 class ImageCacheWritePolicyWT
@@ -299,7 +483,7 @@ public:
     typedef typename TImageContainer::Value Value;
     
     ImageCacheWritePolicyWT(Alias<ImageFactory> anImageFactory):
-      myImageFactory(&anImageFactory)
+      myImageFactory(&anImageFactory), myFlushCount(0)
     {
     }
 
@@ -334,11 +518,38 @@ public:
     */
     void flushPage(ImageContainer * anImageContainer);
     
+    /**
+    * Tell that the image was modified directly (not with
+    * writeInPage), so that it is written when flushed.
+    *
+    * @param anImageContainer the image.
+    */
+    void markPageDirty(ImageContainer * anImageContainer);
+    
+    /**
+    * Forget the pages to write, when the cache is cleared.
+    */
+    void clearCache();
+    
+    /**
+    * Get the number of pages written by flushPage.
+    */
+    unsigned int getFlushCount() const
+    {
+      return myFlushCount;
+    }
+    
 protected:
     
     /// Alias on the image factory
     ImageFactory * myImageFactory;
     
+    /// Pages to write when flushed
+    std::set<ImageContainer *> myDirtyPages;
+    
+    /// Number of pages written by flushPage
+    unsigned int myFlushCount;
+    
 }; // end of class ImageCacheWritePolicyWT
 
 /////////////////////////////////////////////////////////////////////////////
@@ -357,6 +568,11 @@ protected:
  * 
  *  - writeInPage :     for setting a value on an image at a given position given by a point
  *  - flushPage :       for flushing the image on disk according to the cache policy
+ *  - markPageDirty :   for telling that an image was modified directly
+ *  - clearCache :      for forgetting the modified images
+ * 
+ * Only dirty pages, i.e. pages modified since they were loaded, are
+ * written when detached.
  */
 template <typename TImageContainer, typename TImageFactory>
 class ImageCacheWritePolicyWB
@@ -375,7 +591,7 @@ public:
     typedef typename TImageContainer::Value Value;
     
     ImageCacheWritePolicyWB(Alias<ImageFactory> anImageFactory):
-      myImageFactory(&anImageFactory)
+      myImageFactory(&anImageFactory), myLastDirtyPage(NULL), myFlushCount(0)
     {
     }
 
@@ -410,11 +626,41 @@ public:
     */
     void flushPage(ImageContainer * anImageContainer);
     
+    /**
+    * Tell that the image was modified directly (not with
+    * writeInPage), so that it is written when flushed.
+    *
+    * @param anImageContainer the image.
+    */
+    void markPageDirty(ImageContainer * anImageContainer);
+    
+    /**
+    * Forget the pages to write, when the cache is cleared.
+    */
+    void clearCache();
+    
+    /**
+    * Get the number of pages written by flushPage.
+    */
+    unsigned int getFlushCount() const
+    {
+      return myFlushCount;
+    }
+    
 protected:
     
     /// Alias on the image factory
     ImageFactory * myImageFactory;
     
+    /// Pages to write when flushed
+    std::set<ImageContainer *> myDirtyPages;
+    
+    /// Dirty page written last (the writes in it skip myDirtyPages)
+    ImageContainer * myLastDirtyPage;
+    
+    /// Number of pages written by flushPage
+    unsigned int myFlushCount;
+    
 }; // end of class ImageCacheWritePolicyWB
 
 } // namespace DGtal
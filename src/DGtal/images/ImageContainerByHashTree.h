@@ -116,6 +116,28 @@ namespace DGtal
    * The method isKeyValid(..) is provided to verify the validity of a
    * key. Note that using this security strongly affects performances.
    *
+   * The const accessors do not modify the container, which may
+   * thus be read concurrently by several threads. Scans with a lot
+   * of locality (e.g. raster scans of images made of large constant
+   * regions) may rather go through a Reader: it checks the last leaf
+   * it found first, so that consecutive accesses to the same leaf
+   * cost a shift and a comparison instead of a walk up the tree. Use
+   * one Reader per thread, and do not modify the container while it
+   * is used.
+   *
+   * A container is built from a dense image much faster with
+   * buildFromImage(), which merges the constant regions bottom-up
+   * and only inserts the final leaves, than with a setValue() per
+   * point. The leaves can then be scanned with the built-in
+   * Iterator and getKeyDomain():
+   *
+   * @code
+   * Image tree( domain, 12 );
+   * tree.buildFromImage( denseImage );
+   * for ( Image::Iterator it = tree.begin(), itE = tree.end(); it != itE; ++it )
+   *   volume[ *it ] += tree.getKeyDomain( it.getKey() ).size();
+   * @endcode
+   *
    * @tparam TDomain type of domains
    * @tparam TValue type for image values
    * @tparam THashKey  type to store Morton keys
@@ -361,6 +383,25 @@ namespace DGtal
      */
     void setValue(const Point& aPoint, const Value object);
 
+    /**
+     * Replaces the content of the container by the values of a dense
+     * image. The tree is built bottom-up, in a single pass over the
+     * points: the children of a node that are leaves with the same
+     * value are merged into their parent, and only the final leaves
+     * are inserted in the hash table (instead of the insertions and
+     * removals of a setValue() per point).
+     *
+     * The points of the tree outside the domain of \a anImage do not
+     * constrain the merging; the leaves covering only such points get
+     * the value Value().
+     *
+     * @tparam TConstImage a model of concepts::CConstImage with the
+     * same point type.
+     * @param anImage the image to copy.
+     */
+    template <typename TConstImage>
+    void buildFromImage( const TConstImage & anImage );
+
     /**
      * Returns the size of a dimension (the container represents a
      * line, a square, a cube, etc. depending on the dimmension so no
@@ -407,8 +448,34 @@ namespace DGtal
 
     unsigned int getKeyDepth(HashKey key) const;
 
+    /**
+     * @deprecated allocates the result, use
+     * getCoordinatesFromKey(HashKey, Point &) instead.
+     * @param key a valid key.
+     * @return a new array (to delete[]) of the coordinates of the
+     * node, at the resolution of its depth.
+     */
     int* getCoordinatesFromKey(HashKey key) const;
 
+    /**
+     * Decodes the coordinates of a node from its key, without memory
+     * allocation. The coordinates are relative to the origin of the
+     * tree and given at the resolution of the depth of the key (a
+     * node of depth d covers a cube of side 2^(getDepth() - d)).
+     *
+     * @param key a valid key.
+     * @param coordinates (returns) the coordinates of the node.
+     */
+    void getCoordinatesFromKey(HashKey key, Point & coordinates) const;
+
+    /**
+     * @param key a valid key.
+     * @return the domain of the points covered by the node of key
+     * \a key. It may exceed the image domain when the image extent
+     * is not a power of two.
+     */
+    Domain getKeyDomain(HashKey key) const;
+
     /**
      * Prints in the state of the container as a tree. (Calls
      * printTree)
@@ -499,11 +566,11 @@ namespace DGtal
       {
         myArraySize = arraySize;
         myContainerData = data;
-        myNode = data[0];
         myCurrentCell = position;
-        while ((!myNode) && (myCurrentCell < myArraySize))
+        myNode = ( position < arraySize ) ? data[position] : 0;
+        while ((!myNode) && (++myCurrentCell < myArraySize))
           {
-            myNode = myContainerData[++myCurrentCell];
+            myNode = myContainerData[myCurrentCell];
           }
       }
       bool isAtEnd()const
@@ -544,6 +611,61 @@ namespace DGtal
       Node** myContainerData;
     };
 
+    /**
+     * @brief Read accessor with a one-leaf locality cache.
+     *
+     * Accesses from keys of maximal depth (i.e. from points) first
+     * check the last leaf found. A Reader is not thread-safe (use one
+     * per thread).
+     *
+     * @warning The container must not be modified while a Reader is
+     * used: the Reader does not detect the modifications, and its
+     * last leaf may have been split, merged or deleted. Create a new
+     * Reader after modifying the container.
+     *
+     * @code
+     * Image::Reader reader( tree );
+     * for ( auto p : domain )
+     *   sum += reader( p );
+     * @endcode
+     */
+    class Reader
+    {
+    public:
+      /**
+       * Constructor.
+       * @param image the container to read (aliased).
+       */
+      Reader( const ImageContainerByHashTree & image )
+        : myImage( &image ), myNode( 0 ), myKey( 0 ), myShift( 0 )
+      {}
+
+      /**
+       * @param key a hash key.
+       * @return the value at this key.
+       */
+      Value get( const HashKey key );
+
+      /**
+       * @param aPoint a point of the domain.
+       * @return the value at this point.
+       */
+      Value operator()( const Point & aPoint )
+      {
+        return get( myImage->getKey( aPoint ) );
+      }
+
+    private:
+      /// The container (aliased).
+      const ImageContainerByHashTree* myImage;
+      /// The last leaf found from a key of maximal depth (0 if none).
+      Node* myNode;
+      /// The key of myNode.
+      HashKey myKey;
+      /// The shift from maximal depth keys to myKey.
+      unsigned int myShift;
+    };
+
     /**
      * Returns an iterator to the first value as stored in the container.
      */
@@ -720,6 +842,37 @@ namespace DGtal
      */
     bool removeNode(HashKey key);
 
+    /**
+     * Removes all the nodes of the container (the tree is then
+     * invalid until a root is added).
+     */
+    void removeAllNodes();
+
+    /**
+     * Recursive part of buildFromImage(): computes the sub-tree of a
+     * node and inserts the leaves of its non-constant descendants.
+     *
+     * @param anImage the image to copy.
+     * @param key the key of the node.
+     * @param depth the depth of the node.
+     * @param aLowerBound the lowest point covered by the node.
+     * @param aValue (returns) the value of the sub-tree when it is constant.
+     * @return 0 if the node covers no point of the image domain, 1 if
+     * the sub-tree is constant (of value \a aValue), 2 otherwise.
+     */
+    template <typename TConstImage>
+    int buildSubTree( const TConstImage & anImage, HashKey key,
+                      unsigned int depth, const Point & aLowerBound,
+                      Value & aValue );
+
+    /**
+     * Inserts a node without checking whether its key is already in
+     * the container.
+     * @param object the value.
+     * @param key a key not present in the container.
+     */
+    void insertNewNode(const Value object, const HashKey key);
+
     /**
      * Recusrively calls RemoveNode on the key and its children.
      * @param key The key.
@@ -41,6 +41,9 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <cstddef>
+#include <iterator>
+#include <memory>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -53,6 +56,10 @@
 
 #include "DGtal/base/TiledImageBidirectionalConstRangeFromPoint.h"
 #include "DGtal/base/TiledImageBidirectionalRangeFromPoint.h"
+
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -71,6 +78,18 @@ namespace DGtal
    * @note It is important to take into account that read and write policies are passed as aliases in the TiledImage constructor,
    * so for example, if two TiledImage instances are successively created with the same read policy instance,
    * the state of the cache for a given time is therefore the same for the two TiledImage instances !
+   *
+   * The values can be read and set concurrently by several threads
+   * with operator() and setValue() (see ImageCache). A TiledIterator
+   * is meant to be used by a single thread, and pins its current tile
+   * in the cache. When a prefetch depth is set (see
+   * setPrefetchDepth), a TiledIterator entering a tile asks a
+   * background thread to load the next tiles of the traversal, so
+   * that loading the tiles from the factory overlaps the processing
+   * of the current one. Prefetched tiles are only useful if the read
+   * policy keeps at least depth+2 tiles (e.g. ImageCacheReadPolicyFIFO
+   * or ImageCacheReadPolicyCLOCK with a large enough size or budget);
+   * otherwise, they are loaded again by the traversal.
    */
   template <typename TImageContainer, typename TImageFactory, typename TImageCacheReadPolicy, typename TImageCacheWritePolicy>
   class TiledImage
@@ -118,7 +137,8 @@ namespace DGtal
                Alias<ImageCacheReadPolicy> aReadPolicy,
                Alias<ImageCacheWritePolicy> aWritePolicy,
                typename Domain::Integer N):
-      myN(N), myImageFactory(&anImageFactory), myReadPolicy(&aReadPolicy), myWritePolicy(&aWritePolicy)
+      myN(N), myImageFactory(&anImageFactory), myReadPolicy(&aReadPolicy), myWritePolicy(&aWritePolicy),
+      myPrefetchDepth(0)
     {
       myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy);
 
@@ -151,6 +171,7 @@ namespace DGtal
       myImageFactory = other.myImageFactory;
       myReadPolicy = other.myReadPolicy;
       myWritePolicy = other.myWritePolicy;
+      myPrefetchDepth = other.myPrefetchDepth;
 
       myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy);
 
@@ -174,7 +195,9 @@ namespace DGtal
           myImageFactory = other.myImageFactory;
           myReadPolicy = other.myReadPolicy;
           myWritePolicy = other.myWritePolicy;
+          myPrefetchDepth = other.myPrefetchDepth;
 
+          delete myImageCache;
           myImageCache = new MyImageCache(myImageFactory, myReadPolicy, myWritePolicy);
 
           m_lowerBound = myImageFactory->domain().lowerBound();
@@ -223,30 +246,187 @@ namespace DGtal
       return Domain(lowerBoundCords, upperBoundCoords);
     }
 
+    /////////////////////////// Tiles  /////////////////////
+
+    class TiledIterator;
+
+    /**
+     * A direct view on a tile, pinned in the cache (see
+     * ImageCache::acquirePage) during the lifetime of the view: the
+     * tile is neither detached nor flushed while it is viewed. Values
+     * are accessed without any cache lookup. A view cannot be copied,
+     * but can be moved.
+     *
+     * A tile modified through modifiableImage() is marked dirty when
+     * the view is destroyed, so that it is flushed by the write
+     * policy.
+     */
+    class TileView
+    {
+      friend class TiledIterator;
+
+    public:
+
+      /**
+       * Constructor. Pins the tile.
+       *
+       * @param aTiledImage the TiledImage.
+       * @param anIndex the tile index (see tileCoords).
+       */
+      TileView( const TiledImage & aTiledImage, std::size_t anIndex )
+        : myImageCache( aTiledImage.myImageCache ), myIndex( anIndex ),
+          myIsModified( false )
+      {
+        myTile = myImageCache->acquirePage( aTiledImage.tileDomain( anIndex ) );
+      }
+
+      /**
+       * Move constructor.
+       * @param other the view to move, which becomes empty.
+       */
+      TileView( TileView && other )
+        : myImageCache( other.myImageCache ), myTile( other.myTile ),
+          myIndex( other.myIndex ), myIsModified( other.myIsModified )
+      {
+        other.myTile = NULL;
+      }
+
+      /**
+       * Destructor. Unpins the tile.
+       */
+      ~TileView()
+      {
+        if ( myTile != NULL )
+          myImageCache->releasePage( myTile, myIsModified );
+      }
+
+      /// @return the tile index.
+      std::size_t index() const
+      {
+        return myIndex;
+      }
+
+      /// @return the tile domain.
+      const Domain & domain() const
+      {
+        return myTile->domain();
+      }
+
+      /// @return a const reference on the tile image.
+      const ImageContainer & image() const
+      {
+        return *myTile;
+      }
+
+      /// @return a reference on the tile image, which is then marked dirty.
+      ImageContainer & modifiableImage()
+      {
+        myIsModified = true;
+        return *myTile;
+      }
+
+    private:
+      TileView( const TileView & other );
+      TileView & operator=( const TileView & other );
+
+      /// Alias on the cache of the TiledImage
+      MyImageCache * myImageCache;
+
+      /// Alias on the pinned tile
+      ImageContainer * myTile;
+
+      /// Tile index
+      std::size_t myIndex;
+
+      /// True if the tile was modified through the view
+      bool myIsModified;
+    };
+
     /////////////////////////// Custom Iterator /////////////
 
     /**
      * Specific TiledIterator on TiledImage.
+     *
+     * The iterator pins its current tile (it holds a TileView, shared
+     * by its copies), so that the tile remains valid while it is
+     * traversed, whatever the read policy and the prefetched tiles.
+     * Values are written through the reference returned by
+     * operator*: only the tiles actually written are marked dirty and
+     * flushed by the write policy.
      */
 
-    class TiledIterator : public
-    std::iterator<std::bidirectional_iterator_tag, Value, ptrdiff_t, Value*, Value&>
+    class TiledIterator
     {
 
       friend class TiledImage<ImageContainer, ImageFactory, ImageCacheReadPolicy, ImageCacheWritePolicy>;
 
     public:
 
-      /*typedef std::bidirectional_iterator_tag iterator_category; // ???
-        typedef Value value_type;
-        typedef ptrdiff_t difference_type; // ???
-        typedef Value* pointer;
-        typedef Value& reference;*/
-
       typedef typename ImageContainer::Range::/*Output*/Iterator TiledRangeIterator;
       typedef typename Domain::Iterator BlockCoordsIterator;
 
-      //TiledIterator();
+      /**
+       * Reference on a value of the current tile, returned by
+       * operator*. It converts to the value, and assigning it writes
+       * the value and marks the tile dirty. Like a plain reference, it
+       * is valid while the tile is pinned by the iterator (or a copy
+       * of it).
+       */
+      class Reference
+      {
+      public:
+
+        /**
+         * Constructor.
+         *
+         * @param anIterator the iterator on the value in the tile.
+         * @param aTileView the view pinning the tile.
+         */
+        Reference( const TiledRangeIterator & anIterator,
+                   TileView * aTileView )
+          : myIterator( anIterator ), myTileView( aTileView ) {}
+
+        /// @return the value.
+        operator Value() const
+        {
+          return *myIterator;
+        }
+
+        /**
+         * Writes a value.
+         * @param aValue the value.
+         * @return a reference on 'this'.
+         */
+        Reference & operator=( const Value & aValue )
+        {
+          *myIterator = aValue;
+          myTileView->myIsModified = true;
+          return *this;
+        }
+
+        /**
+         * Writes the value referenced by another reference.
+         * @param other the other reference.
+         * @return a reference on 'this'.
+         */
+        Reference & operator=( const Reference & other )
+        {
+          return operator=( static_cast<Value>( other ) );
+        }
+
+      private:
+        /// Iterator on the value in the tile
+        TiledRangeIterator myIterator;
+
+        /// View pinning the tile (owned by the iterator)
+        TileView * myTileView;
+      };
+
+      typedef std::bidirectional_iterator_tag iterator_category;
+      typedef Value value_type;
+      typedef ptrdiff_t difference_type;
+      typedef Value* pointer;
+      typedef Reference reference;
 
       /**
        * Constructor.
@@ -261,8 +441,9 @@ namespace DGtal
       {
         if ( myBlockCoordsIterator != myTiledImage->domainBlockCoords().end() )
           {
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
-            myTiledRangeIterator = myTile->range().begin();
+            enterTile();
+            myTiledRangeIterator = tile().range().begin();
+            myTiledImage->prefetchNextTiles( myBlockCoordsIterator );
           }
       }
 
@@ -281,20 +462,21 @@ namespace DGtal
       {
         if ( myBlockCoordsIterator != myTiledImage->domainBlockCoords().end() )
           {
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
-            myTiledRangeIterator = myTile->range().begin(aPoint);
+            enterTile();
+            myTiledRangeIterator = tile().range().begin(aPoint);
+            myTiledImage->prefetchNextTiles( myBlockCoordsIterator );
           }
       }
 
       /**
        * operator *
        *
-       * @return the value associated to the current TiledRangeIterator position.
+       * @return a reference on the value associated to the current TiledRangeIterator position.
        */
       inline
-      Value & operator*()
+      Reference operator*() const
       {
-        return (*myTiledRangeIterator);
+        return Reference( myTiledRangeIterator, myTileView.get() );
       }
 
       /**
@@ -331,17 +513,21 @@ namespace DGtal
       {
         myTiledRangeIterator++;
 
-        if ( myTiledRangeIterator != myTile->range().end() )
+        if ( myTiledRangeIterator != tile().range().end() )
           return;
         else
           {
             myBlockCoordsIterator++;
 
             if ( myBlockCoordsIterator == myTiledImage->domainBlockCoords().end() )
-              return;
-
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
-            myTiledRangeIterator = myTile->range().begin();
+              {
+                myTileView.reset();
+                return;
+              }
+
+            enterTile();
+            myTiledRangeIterator = tile().range().begin();
+            myTiledImage->prefetchNextTiles( myBlockCoordsIterator );
           }
       }
 
@@ -380,9 +566,9 @@ namespace DGtal
           {
             myBlockCoordsIterator--;
 
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            enterTile();
 
-            myTiledRangeIterator = myTile->range().end();
+            myTiledRangeIterator = tile().range().end();
             myTiledRangeIterator--;
 
             return;
@@ -391,7 +577,7 @@ namespace DGtal
 
         // ---
 
-        if ( myTiledRangeIterator != myTile->range().begin() )
+        if ( myTiledRangeIterator != tile().range().begin() )
           {
             myTiledRangeIterator--;
             return;
@@ -403,9 +589,9 @@ namespace DGtal
 
             myBlockCoordsIterator--;
 
-            myTile = myTiledImage->findTileFromBlockCoords( (*myBlockCoordsIterator) );
+            enterTile();
 
-            myTiledRangeIterator = myTile->range().end();
+            myTiledRangeIterator = tile().range().end();
             myTiledRangeIterator--;
           }
       }
@@ -433,11 +619,30 @@ namespace DGtal
       }
 
     private:
+      /**
+       * Pins the tile of the current block coords, and unpins the
+       * previous one (unless it is still pinned by a copy of the
+       * iterator).
+       */
+      inline
+      void enterTile()
+      {
+        myTileView = std::make_shared<TileView>( *myTiledImage,
+                                                 myTiledImage->tileIndex( *myBlockCoordsIterator ) );
+      }
+
+      /// @return the current tile (not marked dirty).
+      inline
+      ImageContainer & tile() const
+      {
+        return *myTileView->myTile;
+      }
+
       /// TiledImage pointer
       const TiledImage *myTiledImage;
 
-      /// Alias on the current tile
-      ImageContainer * myTile;
+      /// View pinning the current tile, shared by the copies of the iterator
+      std::shared_ptr<TileView> myTileView;
 
       /// Current tiled range iterator
       TiledRangeIterator myTiledRangeIterator;
@@ -553,6 +758,121 @@ namespace DGtal
       return ReverseOutputIterator( rbegin(aPoint) );
     }
 
+    /**
+     * @return the number of tiles.
+     */
+    std::size_t tileCount() const
+    {
+      return static_cast<std::size_t>( domainBlockCoords().size() );
+    }
+
+    /**
+     * Get the block coords of a tile from its index. Tiles are
+     * indexed in the order of the block coords domain (lexicographic
+     * order, first dimension first), which is the order followed by
+     * the TiledIterator.
+     *
+     * @param anIndex the tile index, between 0 and tileCount()-1.
+     * @return the block coords.
+     */
+    Point tileCoords(std::size_t anIndex) const
+    {
+      ASSERT(anIndex < tileCount());
+
+      const Domain blocks = domainBlockCoords();
+      Point coords;
+      for(typename DGtal::Dimension i=0; i<Domain::dimension; i++)
+        {
+          const std::size_t extent = static_cast<std::size_t>( blocks.upperBound()[i] - blocks.lowerBound()[i] + 1 );
+          coords[i] = blocks.lowerBound()[i] + static_cast<typename Domain::Integer>( anIndex % extent );
+          anIndex /= extent;
+        }
+
+      return coords;
+    }
+
+    /**
+     * Get the index of a tile from its block coords (inverse of
+     * tileCoords).
+     *
+     * @param aCoord the block coords.
+     * @return the tile index.
+     */
+    std::size_t tileIndex(const Point & aCoord) const
+    {
+      ASSERT(domainBlockCoords().isInside(aCoord));
+
+      const Domain blocks = domainBlockCoords();
+      std::size_t index = 0;
+      for(typename DGtal::Dimension i=Domain::dimension; i-- > 0; )
+        {
+          const std::size_t extent = static_cast<std::size_t>( blocks.upperBound()[i] - blocks.lowerBound()[i] + 1 );
+          index = index * extent + static_cast<std::size_t>( aCoord[i] - blocks.lowerBound()[i] );
+        }
+
+      return index;
+    }
+
+    /**
+     * Get the domain of a tile from its index.
+     *
+     * @param anIndex the tile index, between 0 and tileCount()-1.
+     * @return the domain.
+     */
+    const Domain tileDomain(std::size_t anIndex) const
+    {
+      return findSubDomainFromBlockCoords( tileCoords( anIndex ) );
+    }
+
+    /**
+     * Get a direct view on a tile, loading it if needed.
+     *
+     * @param anIndex the tile index, between 0 and tileCount()-1.
+     * @return the view.
+     */
+    TileView tile(std::size_t anIndex)
+    {
+      return TileView( *this, anIndex );
+    }
+
+    /**
+     * Applies a kernel to each tile. With OpenMP, tiles are
+     * distributed among nbThreads threads (0 meaning all the
+     * available threads), each tile being processed by a single
+     * thread. The kernel should only access the tile it is given.
+     *
+     * @code
+     * tiledImage.forEachTile( [] ( MyTiledImage::TileView & view )
+     *   {
+     *     for ( auto & v : view.modifiableImage().range() ) v *= 2;
+     *   }, 4 );
+     * @endcode
+     *
+     * @tparam TTileKernel a functor type on TileView&.
+     * @param aKernel the kernel.
+     * @param nbThreads the number of threads.
+     */
+    template <typename TTileKernel>
+    void forEachTile(const TTileKernel & aKernel, int nbThreads = 1)
+    {
+      forEachTileView( aKernel, nbThreads );
+    }
+
+    /**
+     * Applies a read-only kernel to each tile (see forEachTile).
+     *
+     * @tparam TTileKernel a functor type on const TileView&.
+     * @param aKernel the kernel.
+     * @param nbThreads the number of threads.
+     */
+    template <typename TTileKernel>
+    void forEachTile(const TTileKernel & aKernel, int nbThreads = 1) const
+    {
+      forEachTileView( [&aKernel] ( TileView & view )
+                       { aKernel( static_cast<const TileView &>( view ) ); },
+                       nbThreads );
+    }
+
     /////////////////////////// Ranges  /////////////////////
 
     typedef TiledImageBidirectionalConstRangeFromPoint<TiledImage > ConstRange;
@@ -685,16 +1005,33 @@ namespace DGtal
     {
       ASSERT(domainBlockCoords().isInside(aCoord));
 
-      Domain d = findSubDomainFromBlockCoords( aCoord );
-      ImageContainer *tile = myImageCache->getPage(d);
-      if (!tile)
+      return myImageCache->fetchPage( findSubDomainFromBlockCoords( aCoord ) );
+    }
+
+    /**
+     * Asks the cache to prefetch the tiles following aBlockCoordsIterator
+     * (in the block coords domain order), up to the prefetch depth.
+     * The pending prefetches, for tiles the traversal has already
+     * reached, are discarded first.
+     *
+     * @param aBlockCoordsIterator a block coords iterator.
+     */
+    void prefetchNextTiles(typename Domain::Iterator aBlockCoordsIterator) const
+    {
+      if (myPrefetchDepth == 0)
+        return;
+
+      myImageCache->cancelPrefetches();
+
+      const typename Domain::Iterator itEnd = domainBlockCoords().end();
+      for (unsigned int i=0; i<myPrefetchDepth; i++)
         {
-          myImageCache->incCacheMissRead();
-          myImageCache->update(d);
-          tile = myImageCache->getPage(d);
-        }
+          ++aBlockCoordsIterator;
+          if (aBlockCoordsIterator == itEnd)
+            return;
 
-      return tile;
+          myImageCache->prefetch( findSubDomainFromBlockCoords( *aBlockCoordsIterator ) );
+        }
     }
 
     /**
@@ -708,30 +1045,15 @@ namespace DGtal
       ASSERT(myImageFactory->domain().isInside(aPoint));
 
       typename OutputImage::Value aValue;
-      bool res;
-
-      res = myImageCache->read(aPoint, aValue);
 
-      if (res)
+      if (myImageCache->read(aPoint, aValue))
         return aValue;
-      else
-        {
-          myImageCache->incCacheMissRead();
-          Domain d;
-#ifdef DEBUG_VERBOSE
-          trace.info()<<"+";
-#endif 
-          d = findSubDomain(aPoint);
-
-          myImageCache->update(d);
-
-          myImageCache->read(aPoint, aValue);
 
-          return aValue;
-        }
-
-      // Unspecified behavior, returning the default constructed value.
-      return aValue;
+#ifdef DEBUG_VERBOSE
+      trace.info()<<"+";
+#endif
+      // The page may have been loaded by another thread in the meantime.
+      return myImageCache->fetch(aPoint, findSubDomain(aPoint));
     }
 
     /**
@@ -746,12 +1068,8 @@ namespace DGtal
 
       if (myImageCache->write(aPoint, aValue))
         return;
-      else
-        {
-          myImageCache->incCacheMissWrite();
-          myImageCache->update(findSubDomain(aPoint));
-          myImageCache->write(aPoint, aValue);
-        }
+
+      myImageCache->store(aPoint, aValue, findSubDomain(aPoint));
     }
 
     /**
@@ -778,6 +1096,41 @@ namespace DGtal
       myImageCache->clearCacheAndResetCacheMisses();
     }
 
+    /**
+     * Set the number of tiles a TiledIterator asks to prefetch when
+     * it enters a tile (0, the default, disables prefetching).
+     *
+     * @param aDepth the prefetch depth.
+     */
+    void setPrefetchDepth(unsigned int aDepth)
+    {
+      myPrefetchDepth = aDepth;
+    }
+
+    /**
+     * Get the prefetch depth.
+     */
+    unsigned int prefetchDepth() const
+    {
+      return myPrefetchDepth;
+    }
+
+    /**
+     * Get the number of tiles loaded by the prefetch thread.
+     */
+    unsigned int getPrefetchLoads()
+    {
+      return myImageCache->getPrefetchLoads();
+    }
+
+    /**
+     * Wait until all the prefetched tiles are loaded.
+     */
+    void waitPrefetches()
+    {
+      myImageCache->waitPrefetches();
+    }
+
     // ------------------------- Private Datas --------------------------------
   protected:
 
@@ -802,7 +1155,36 @@ namespace DGtal
     /// TImageCacheWritePolicy pointer
     TImageCacheWritePolicy *myWritePolicy;
 
+    /// Number of tiles prefetched by a TiledIterator entering a tile
+    unsigned int myPrefetchDepth;
+
     // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Applies a kernel to a view on each tile (see forEachTile).
+     *
+     * @tparam TTileKernel a functor type on TileView&.
+     * @param aKernel the kernel.
+     * @param nbThreads the number of threads.
+     */
+    template <typename TTileKernel>
+    void forEachTileView(const TTileKernel & aKernel, int nbThreads) const
+    {
+      const std::ptrdiff_t nbTiles = static_cast<std::ptrdiff_t>( tileCount() );
+#ifdef WITH_OPENMP
+      if ( nbThreads <= 0 )
+        nbThreads = omp_get_max_threads();
+#pragma omp parallel for schedule(dynamic) num_threads(nbThreads)
+#else
+      boost::ignore_unused_variable_warning( nbThreads );
+#endif
+      for ( std::ptrdiff_t i = 0; i < nbTiles; ++i )
+        {
+          TileView view( *this, static_cast<std::size_t>( i ) );
+          aKernel( view );
+        }
+    }
 
   }; // end of class TiledImage
 
@@ -48,6 +48,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/io/Color.h"
+#include "DGtal/io/PackedPrimitiveList.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/images/CConstImage.h"
 #include "DGtal/shapes/Mesh.h"
@@ -248,6 +249,115 @@ namespace DGtal
 
     enum StreamKey {addNewList, updateDisplay, shiftSurfelVisu};
 
+    /// Layout of a CubeD3D in a PackedPrimitiveList: the center, and
+    /// the name and width as attributes.
+    struct CubeLayoutD3D {
+      typedef double Coordinate;
+      struct Attributes {
+        DGtal::int32_t name;
+        double width;
+        bool operator==( const Attributes & other ) const
+        { return name == other.name && width == other.width; }
+        bool operator<( const Attributes & other ) const
+        { return name < other.name || ( name == other.name && width < other.width ); }
+      };
+      static const unsigned int coordinates = 3;
+      static void pack( const CubeD3D & cube, Coordinate * coords, Attributes & attributes )
+      {
+        for ( unsigned int i = 0; i < 3; ++i ) coords[ i ] = Coordinate( cube.center[ i ] );
+        attributes.name  = cube.name;
+        attributes.width = cube.width;
+      }
+      static void unpack( const Coordinate * coords, const Attributes & attributes, CubeD3D & cube )
+      {
+        cube.center = RealPoint( coords[ 0 ], coords[ 1 ], coords[ 2 ] );
+        cube.name   = attributes.name;
+        cube.width  = attributes.width;
+      }
+    };
+
+    /// Layout of a QuadD3D in a PackedPrimitiveList: the four
+    /// vertices and the normal, and the name as attribute.
+    struct QuadLayoutD3D {
+      typedef double Coordinate;
+      struct Attributes {
+        DGtal::int32_t name;
+        bool operator==( const Attributes & other ) const { return name == other.name; }
+        bool operator<( const Attributes & other ) const { return name < other.name; }
+      };
+      static const unsigned int coordinates = 15;
+      static void pack( const QuadD3D & quad, Coordinate * coords, Attributes & attributes )
+      {
+        for ( unsigned int i = 0; i < 3; ++i )
+          {
+            coords[ i ]     = Coordinate( quad.point1[ i ] );
+            coords[ 3 + i ] = Coordinate( quad.point2[ i ] );
+            coords[ 6 + i ] = Coordinate( quad.point3[ i ] );
+            coords[ 9 + i ] = Coordinate( quad.point4[ i ] );
+          }
+        coords[ 12 ] = Coordinate( quad.nx );
+        coords[ 13 ] = Coordinate( quad.ny );
+        coords[ 14 ] = Coordinate( quad.nz );
+        attributes.name = quad.name;
+      }
+      static void unpack( const Coordinate * coords, const Attributes & attributes, QuadD3D & quad )
+      {
+        quad.point1 = RealPoint( coords[ 0 ], coords[ 1 ], coords[ 2 ] );
+        quad.point2 = RealPoint( coords[ 3 ], coords[ 4 ], coords[ 5 ] );
+        quad.point3 = RealPoint( coords[ 6 ], coords[ 7 ], coords[ 8 ] );
+        quad.point4 = RealPoint( coords[ 9 ], coords[ 10 ], coords[ 11 ] );
+        quad.nx = coords[ 12 ];
+        quad.ny = coords[ 13 ];
+        quad.nz = coords[ 14 ];
+        quad.name = attributes.name;
+      }
+    };
+
+    /// Layout of a BallD3D in a PackedPrimitiveList: the center, and
+    /// the name, radius, resolution and sign as attributes.
+    struct BallLayoutD3D {
+      typedef double Coordinate;
+      struct Attributes {
+        DGtal::int32_t name;
+        double radius;
+        unsigned int resolution;
+        bool isSigned;
+        bool signPos;
+        bool operator==( const Attributes & other ) const
+        {
+          return name == other.name && radius == other.radius
+            && resolution == other.resolution
+            && isSigned == other.isSigned && signPos == other.signPos;
+        }
+        bool operator<( const Attributes & other ) const
+        {
+          if ( name != other.name ) return name < other.name;
+          if ( radius != other.radius ) return radius < other.radius;
+          if ( resolution != other.resolution ) return resolution < other.resolution;
+          if ( isSigned != other.isSigned ) return isSigned < other.isSigned;
+          return signPos < other.signPos;
+        }
+      };
+      static const unsigned int coordinates = 3;
+      static void pack( const BallD3D & ball, Coordinate * coords, Attributes & attributes )
+      {
+        for ( unsigned int i = 0; i < 3; ++i ) coords[ i ] = Coordinate( ball.center[ i ] );
+        attributes.name       = ball.name;
+        attributes.radius     = ball.radius;
+        attributes.resolution = ball.resolution;
+        attributes.isSigned   = ball.isSigned;
+        attributes.signPos    = ball.signPos;
+      }
+      static void unpack( const Coordinate * coords, const Attributes & attributes, BallD3D & ball )
+      {
+        ball.center     = RealPoint( coords[ 0 ], coords[ 1 ], coords[ 2 ] );
+        ball.name       = attributes.name;
+        ball.radius     = attributes.radius;
+        ball.resolution = attributes.resolution;
+        ball.isSigned   = attributes.isSigned;
+        ball.signPos    = attributes.signPos;
+      }
+    };
 
   public:
     /// The type that maps identifier name -> vector of QuadD3D.
@@ -256,6 +366,25 @@ namespace DGtal
     /// The type that maps identifier name -> vector of CubeD3D.
     typedef std::map<DGtal::int32_t, std::vector< CubeD3D > > CubesMap;
 
+    /// The list of QuadD3D of a given identifier name.
+    typedef typename QuadsMap::mapped_type QuadList;
+
+    /// The list of CubeD3D of a given identifier name.
+    typedef typename CubesMap::mapped_type CubeList;
+
+    /// The type of the ball lists.
+    typedef std::vector< std::vector< BallD3D > > BallSetList;
+
+    /// The list of BallD3D of a ball list.
+    typedef typename BallSetList::value_type BallList;
+
+    /// Memory-compact copies of the lists above (structure of
+    /// arrays, see PackedPrimitiveList). The display itself stores
+    /// vectors.
+    typedef PackedPrimitiveList< QuadD3D, QuadLayoutD3D > PackedQuadList;
+    typedef PackedPrimitiveList< CubeD3D, CubeLayoutD3D > PackedCubeList;
+    typedef PackedPrimitiveList< BallD3D, BallLayoutD3D > PackedBallList;
+
 
   protected:
     /// The Khalimsky space
@@ -0,0 +1,352 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedPrimitiveList.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module PackedPrimitiveList.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedPrimitiveList_RECURSES)
+#error Recursive header files inclusion detected in PackedPrimitiveList.h
+#else // defined(PackedPrimitiveList_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedPrimitiveList_RECURSES
+
+#if !defined PackedPrimitiveList_h
+/** Prevents repeated inclusion of headers. */
+#define PackedPrimitiveList_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/Color.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedPrimitiveList
+  /**
+     Description of template class 'PackedPrimitiveList' <p>
+     \brief Aim: A memory-compact list of graphical primitives of
+     Display3D (cubes, quads, balls), stored as a structure of arrays.
+
+     Display3D keeps its primitives in std::vector, which its
+     backends and derived classes may modify in place. This list is
+     an opt-in copy of such a vector (see Display3D::PackedCubeList,
+     PackedQuadList and PackedBallList) for code that keeps many
+     primitives, e.g. a large scene between two displays.
+
+     Each primitive is split into three parts:
+     - its coordinates (centers, vertices, normals), stored in one
+       array of TLayout::Coordinate (TLayout::coordinates values per
+       primitive);
+     - its color, packed as 4 bytes in RGBA memory order;
+     - its attributes (name, width, radius...), which are almost
+       always shared by a whole list. The distinct attributes are
+       stored once in a small table, and the per-primitive index in
+       this table is only allocated when the list holds more than one
+       distinct attribute.
+
+     With double coordinates, a cube or a ball thus costs 28 bytes
+     instead of 40 or 56 (sizeof CubeD3D and BallD3D on x86-64).
+
+     The list is read through values: operator[], at() and the
+     iterators rebuild a TPrimitive, so that code written for a
+     std::vector<TPrimitive> (range-for with const references,
+     it->field, (*it)[i]) keeps working. Unlike a std::vector, there
+     is no mutable access: a primitive is changed with set(), and the
+     list is sorted with sort(). The raw arrays are also available for
+     renderers that upload them directly.
+
+     The layout TLayout is a structure that provides:
+     - a type Coordinate, the scalar type of the coordinates;
+     - a type Attributes, LessThan and EqualityComparable;
+     - a static constant coordinates, the number of Coordinate per primitive;
+     - static void pack( const TPrimitive &, Coordinate *, Attributes & );
+     - static void unpack( const Coordinate *, const Attributes &, TPrimitive & ).
+
+     The color of TPrimitive is its data member color (see
+     Display3D::CommonD3D), handled by the list.
+
+     @tparam TPrimitive the type of primitive (default constructible).
+     @tparam TLayout the layout of the primitive.
+
+     @see Display3D, testPackedPrimitiveList.cpp
+  */
+  template <typename TPrimitive, typename TLayout>
+  class PackedPrimitiveList
+  {
+  public:
+    // ----------------------- Public types ------------------------------
+    typedef PackedPrimitiveList<TPrimitive, TLayout> Self;
+    typedef TPrimitive                               Primitive;
+    typedef TLayout                                  Layout;
+    typedef typename Layout::Attributes              Attributes;
+    typedef typename Layout::Coordinate              Coordinate;
+    typedef std::size_t                              Size;
+    typedef Primitive                                value_type;
+    typedef Size                                     size_type;
+
+    /// The number of coordinates per primitive.
+    static const unsigned int coordinates = Layout::coordinates;
+
+    /// Pointer-like object returned by the operator-> of iterators.
+    struct ArrowProxy
+    {
+      Primitive myValue;
+      const Primitive * operator->() const { return &myValue; }
+    };
+
+    /**
+     * Read-only random access iterator on the primitives of the
+     * list. Its reference type is a Primitive value.
+     */
+    class ConstIterator
+      : public std::iterator<std::random_access_iterator_tag, Primitive,
+                             std::ptrdiff_t, ArrowProxy, Primitive>
+    {
+    public:
+      typedef std::ptrdiff_t Difference;
+
+      ConstIterator() : myList( 0 ), myIndex( 0 ) {}
+      ConstIterator( const Self * list, Size index )
+        : myList( list ), myIndex( index ) {}
+
+      Primitive operator*() const { return (*myList)[ myIndex ]; }
+      ArrowProxy operator->() const { return ArrowProxy{ **this }; }
+      Primitive operator[]( Difference n ) const { return (*myList)[ myIndex + n ]; }
+
+      ConstIterator & operator++() { ++myIndex; return *this; }
+      ConstIterator operator++( int ) { ConstIterator tmp( *this ); ++myIndex; return tmp; }
+      ConstIterator & operator--() { --myIndex; return *this; }
+      ConstIterator operator--( int ) { ConstIterator tmp( *this ); --myIndex; return tmp; }
+      ConstIterator & operator+=( Difference n ) { myIndex += n; return *this; }
+      ConstIterator & operator-=( Difference n ) { myIndex -= n; return *this; }
+      ConstIterator operator+( Difference n ) const { return ConstIterator( myList, myIndex + n ); }
+      ConstIterator operator-( Difference n ) const { return ConstIterator( myList, myIndex - n ); }
+      Difference operator-( const ConstIterator & other ) const
+      { return Difference( myIndex ) - Difference( other.myIndex ); }
+
+      bool operator==( const ConstIterator & other ) const { return myIndex == other.myIndex; }
+      bool operator!=( const ConstIterator & other ) const { return myIndex != other.myIndex; }
+      bool operator<( const ConstIterator & other ) const { return myIndex < other.myIndex; }
+      bool operator>( const ConstIterator & other ) const { return myIndex > other.myIndex; }
+      bool operator<=( const ConstIterator & other ) const { return myIndex <= other.myIndex; }
+      bool operator>=( const ConstIterator & other ) const { return myIndex >= other.myIndex; }
+
+      /// @return the index of the pointed primitive in the list.
+      Size index() const { return myIndex; }
+
+    private:
+      const Self * myList;
+      Size myIndex;
+    };
+
+    typedef ConstIterator Iterator;
+    typedef ConstIterator const_iterator;
+    typedef ConstIterator iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Constructs an empty list.
+    PackedPrimitiveList() = default;
+
+    /**
+     * Constructs the packed copy of a range of primitives, e.g. a
+     * list of Display3D::myCubesMap.
+     * @tparam TInputIterator a model of input iterator on TPrimitive.
+     * @param itb begin iterator on the primitives.
+     * @param ite end iterator on the primitives.
+     */
+    template <typename TInputIterator>
+    PackedPrimitiveList( TInputIterator itb, TInputIterator ite );
+
+    /// @return the number of primitives.
+    Size size() const { return myColors.size(); }
+
+    /// @return true if the list is empty.
+    bool empty() const { return myColors.empty(); }
+
+    /// Removes all the primitives and attributes.
+    void clear();
+
+    /**
+     * Reserves memory for a given number of primitives.
+     * @param n the number of primitives.
+     */
+    void reserve( Size n );
+
+    /**
+     * Appends a primitive.
+     * @param primitive any primitive.
+     */
+    void push_back( const Primitive & primitive );
+
+    /**
+     * @param i an index smaller than size().
+     * @return the i-th primitive.
+     */
+    Primitive operator[]( Size i ) const;
+
+    /**
+     * @param i an index smaller than size() (checked).
+     * @return the i-th primitive.
+     */
+    Primitive at( Size i ) const;
+
+    /**
+     * Replaces a primitive.
+     * @param i an index smaller than size().
+     * @param primitive any primitive.
+     */
+    void set( Size i, const Primitive & primitive );
+
+    /// @return the first primitive (the list is not empty).
+    Primitive front() const { return (*this)[ 0 ]; }
+
+    /// @return the last primitive (the list is not empty).
+    Primitive back() const { return (*this)[ size() - 1 ]; }
+
+    /// @return an iterator on the first primitive.
+    ConstIterator begin() const { return ConstIterator( this, 0 ); }
+
+    /// @return an iterator after the last primitive.
+    ConstIterator end() const { return ConstIterator( this, size() ); }
+
+    /**
+     * Sorts the primitives (the std::sort of proxy iterators is not
+     * possible).
+     * @tparam TCompare a strict weak ordering on primitives.
+     * @param comp the ordering.
+     */
+    template <typename TCompare>
+    void sort( TCompare comp );
+
+    // ----------------------- Raw data ---------------------------------------
+  public:
+
+    /// @return the coordinates, coordinates values per primitive.
+    const std::vector<Coordinate> & coordinateArray() const { return myCoordinates; }
+
+    /// @return the colors, packed as RGBA bytes in memory order.
+    const std::vector<DGtal::uint32_t> & colorArray() const { return myColors; }
+
+    /// @return the number of distinct attributes.
+    Size nbAttributes() const { return myAttributes.size(); }
+
+    /**
+     * @param i an index smaller than size().
+     * @return the attributes of the i-th primitive.
+     */
+    const Attributes & attributes( Size i ) const;
+
+    /// @return the number of bytes allocated by the list.
+    Size memoryUsage() const;
+
+    /**
+     * @param color any color.
+     * @return the color packed as RGBA bytes in memory order.
+     */
+    static DGtal::uint32_t packColor( const Color & color );
+
+    /**
+     * @param packed a color packed as RGBA bytes in memory order.
+     * @return the unpacked color.
+     */
+    static Color unpackColor( DGtal::uint32_t packed );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The coordinates of the primitives.
+    std::vector<Coordinate> myCoordinates;
+    /// The packed colors of the primitives.
+    std::vector<DGtal::uint32_t> myColors;
+    /// The distinct attributes.
+    std::vector<Attributes> myAttributes;
+    /// The index of each distinct attribute in myAttributes.
+    std::map<Attributes, DGtal::uint32_t> myAttributeIndices;
+    /// The attribute index of each primitive (empty if myAttributes.size() <= 1).
+    std::vector<DGtal::uint32_t> myPrimitiveAttributes;
+    /// The index of the last inserted attribute.
+    DGtal::uint32_t myLastAttribute = 0;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param attributes any attributes.
+     * @return the index of these attributes in myAttributes (inserted if needed).
+     */
+    DGtal::uint32_t attributeIndex( const Attributes & attributes );
+
+  }; // end of class PackedPrimitiveList
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedPrimitiveList'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedPrimitiveList' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPrimitive, typename TLayout>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedPrimitiveList<TPrimitive, TLayout> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/PackedPrimitiveList.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedPrimitiveList_h
+
+#undef PackedPrimitiveList_RECURSES
+#endif // else defined(PackedPrimitiveList_RECURSES)
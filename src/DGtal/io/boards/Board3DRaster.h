@@ -0,0 +1,416 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file   Board3DRaster.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * @brief
+ *
+ * Header file for module Board3DRaster.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(Board3DRaster_RECURSES)
+#error Recursive header files inclusion detected in Board3DRaster.h
+#else // defined(Board3DRaster_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define Board3DRaster_RECURSES
+
+#if !defined Board3DRaster_h
+/** Prevents repeated inclusion of headers. */
+#define Board3DRaster_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/io/Display3D.h"
+#include "DGtal/io/DrawWithDisplay3DModifier.h"
+#include "DGtal/io/Color.h"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class Board3DRaster
+  /**
+   * @brief The class Board3DRaster is a type of Display3D which renders
+   * the figures into an image with a CPU software rasterizer and
+   * exports it in the PPM or PNG format when calling the method
+   * saveRaster.
+   *
+   * It needs neither a display nor an OpenGL context and is meant for
+   * batch snapshots of large scenes. Cubes, quads, prisms (KSpace
+   * cells), balls, triangles and polygons are converted to screen
+   * space triangles which are binned into square tiles. The tiles are
+   * then rasterized in parallel (with OpenMP if available) against a
+   * z-buffer, and each visible pixel is shaded once with a headlight
+   * (a directional light close to the camera direction), either with
+   * one normal per face (FlatShading) or with interpolated vertex
+   * normals and a specular term (PhongShading).
+   *
+   * Primitives are drawn opaque (the alpha channel of their color is
+   * ignored), lines are not drawn and a primitive with a vertex cut
+   * by a clipping plane or in front of the near plane is discarded.
+   *
+   * @code
+   * Board3DRaster<> board;
+   * board << SetMode3D( domain.className(), "Paving" );
+   * board << aDigitalSet;
+   * board.setCameraDirection( -1.0, -1.0, -1.0 );
+   * board.centerCamera();
+   * board.saveRaster( "snapshot.png", Board3DRaster<>::RasterPNG, 800, 600 );
+   * @endcode
+   *
+   * @tparam Space a model of digital space (default type=Z3i::Space)
+   * @tparam KSpace a model of Khalimsky space (default type=Z3i::KSpace)
+   *
+   * @see Board3D, Board3DTo2D
+   */
+  template < typename Space = Z3i::Space, typename KSpace = Z3i::KSpace>
+  class Board3DRaster : public Display3D<Space, KSpace>
+  {
+  public:
+
+    typedef Display3D<Space, KSpace> Base;
+    typedef typename Base::RealPoint RealPoint;
+
+    /// The image formats of saveRaster.
+    enum RasterType { RasterPPM, RasterPNG };
+
+    /// The shading models of the rasterizer.
+    enum ShadingMode { FlatShading, PhongShading };
+
+    /**
+     * Constructor.
+     */
+    Board3DRaster();
+
+    /**
+     * Constructor with a khalimsky space
+     * @param KSEmb the Khalimsky space
+     */
+    Board3DRaster( const KSpace & KSEmb ) : Display3D<Space,KSpace>( KSEmb )
+    {
+      init();
+    }
+
+    /*!
+     * Destructor.
+     */
+    ~Board3DRaster(){};
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const
+    {
+      return "Board3DRaster";
+    }
+
+    /**
+     * Set camera position.
+     * @param x x position.
+     * @param y y position.
+     * @param z z position.
+     */
+    void setCameraPosition( double x, double y, double z )
+    { myCameraPosition = RealPoint( x, y, z ); }
+
+    /**
+     * Set camera direction.
+     * @param x x direction.
+     * @param y y direction.
+     * @param z z direction.
+     */
+    void setCameraDirection( double x, double y, double z )
+    { myCameraDirection = RealPoint( x, y, z ); }
+
+    /**
+     * Set camera up-vector.
+     * @param x x coordinate of up-vector.
+     * @param y y coordinate of up-vector.
+     * @param z z coordinate of up-vector.
+     */
+    void setCameraUpVector( double x, double y, double z )
+    { myCameraUpVector = RealPoint( x, y, z ); }
+
+    /**
+     * Set near and far distance, too near or too far end up not visible.
+     * @param _near near distance.
+     * @param _far far distance.
+     */
+    void setNearFar( double _near, double _far ) { myZNear = _near; myZFar = _far; }
+
+    /**
+     * Set the vertical field of view of the camera.
+     * @param fov the angle in radians (default M_PI/4).
+     */
+    void setFieldOfView( double fov ) { myFieldOfView = fov; }
+
+    /**
+     * Moves the camera along its current direction so that the
+     * bounding box of the drawn objects is entirely visible, and
+     * updates the near and far distances accordingly.
+     */
+    void centerCamera();
+
+    /**
+     * Set the shading model.
+     * @param mode either FlatShading (default) or PhongShading.
+     */
+    void setShadingMode( ShadingMode mode ) { myShadingMode = mode; }
+
+    /**
+     * Set the color of the pixels not covered by any primitive.
+     * @param aColor the background color (default white).
+     */
+    void setBackgroundColor( const DGtal::Color & aColor ) { myBackgroundColor = aColor; }
+
+    /**
+     * Set the side of the square tiles rendered in parallel.
+     * @param size the tile side in pixels (default 32).
+     */
+    void setTileSize( unsigned int size ) { myTileSize = size > 0 ? size : 1; }
+
+    /**
+     * Renders the drawn objects in the color and depth buffers.
+     *
+     * @param bWidth width of the image.
+     * @param bHeight height of the image.
+     * @param nbThreads the number of threads used with OpenMP (0 means
+     * the OpenMP default, ignored without OpenMP).
+     */
+    void render( unsigned int bWidth, unsigned int bHeight, int nbThreads = 0 );
+
+    /**
+     * Renders the drawn objects and saves the image.
+     *
+     * @param filename filename of the image to save.
+     * @param type type of the image to save (RasterPPM, RasterPNG).
+     * @param bWidth width of the image to save.
+     * @param bHeight height of the image to save.
+     * @param nbThreads the number of threads used with OpenMP (0 means
+     * the OpenMP default, ignored without OpenMP).
+     * @return 'true' if the file was written.
+     */
+    bool saveRaster( const std::string & filename, RasterType type,
+                     unsigned int bWidth, unsigned int bHeight, int nbThreads = 0 );
+
+    /**
+     * Saves the last rendered image as a binary PPM (P6) file.
+     * @param filename filename of the image to save.
+     * @return 'true' if the file was written.
+     */
+    bool savePPM( const std::string & filename ) const;
+
+    /**
+     * Saves the last rendered image as a RGB PNG file.
+     * @param filename filename of the image to save.
+     * @return 'true' if the file was written.
+     */
+    bool savePNG( const std::string & filename ) const;
+
+    /// @return the width of the last rendered image.
+    unsigned int width() const { return myWidth; }
+
+    /// @return the height of the last rendered image.
+    unsigned int height() const { return myHeight; }
+
+    /**
+     * @param x a column of the last rendered image (0 is left).
+     * @param y a row of the last rendered image (0 is top).
+     * @return the color of the pixel.
+     */
+    DGtal::Color pixel( unsigned int x, unsigned int y ) const;
+
+    /**
+     * @param x a column of the last rendered image (0 is left).
+     * @param y a row of the last rendered image (0 is top).
+     * @return the distance along the camera direction of the visible
+     * primitive at this pixel, or infinity for the background.
+     */
+    double depth( unsigned int x, unsigned int y ) const;
+
+    /// @return the number of triangles rasterized by the last rendering.
+    std::size_t nbRasterizedTriangles() const { return myTriangles.size(); }
+
+    DGtal::Color myDefaultColor;  //!< default color
+
+    /**
+     * Set the default color for future drawing.
+     *
+     * @param aColor a DGtal::Color (allow to set a trasnparency value).
+     *
+     **/
+    Board3DRaster & operator<<( const DGtal::Color & aColor );
+
+    /**
+     * Draws the drawable [object] in this board. It should satisfy
+     * the concept CDrawableWithDisplay3D, which requires for instance a
+     * method setStyle( Board3DRaster & ).
+     *
+     * @param object any drawable object.
+     * @return a reference on 'this'.
+     */
+    template <typename TDrawableWithDisplay3D>
+    Board3DRaster & operator<<( const TDrawableWithDisplay3D & object );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// A triangle in screen space, with its world normals.
+    struct RasterTriangle {
+      float x[3], y[3];   ///< Screen coordinates of the vertices.
+      float iw[3];        ///< Inverse of the camera depth of the vertices.
+      float n[3][3];      ///< Unit normals of the vertices.
+      DGtal::uint32_t color; ///< Packed RGB color.
+    };
+
+    /// A 3D vertex with its normal, before projection.
+    struct Vertex {
+      RealPoint p;
+      RealPoint n;
+    };
+
+    RealPoint myCameraPosition;   //!< camera position
+    RealPoint myCameraDirection;  //!< camera direction
+    RealPoint myCameraUpVector;   //!< camera up-vector
+    double myZNear;               //!< znear distance
+    double myZFar;                //!< zfar distance
+    double myFieldOfView;         //!< vertical field of view in radians
+    ShadingMode myShadingMode;    //!< shading model
+    DGtal::Color myBackgroundColor; //!< color of the background
+    unsigned int myTileSize;      //!< side of the tiles
+
+    /// Orthonormal camera frame (right, up, direction) of the current rendering.
+    RealPoint myCamX, myCamY, myCamZ;
+    /// Scale from camera to screen coordinates of the current rendering.
+    double myFocal;
+
+    unsigned int myWidth;   //!< width of the last rendered image
+    unsigned int myHeight;  //!< height of the last rendered image
+    std::vector<unsigned char> myColorBuffer; //!< RGB pixels, row major from the top
+    std::vector<float> myDepthBuffer;         //!< inverse depth per pixel, 0 for the background
+    std::vector<RasterTriangle> myTriangles;  //!< triangles of the last rendering
+
+  protected :
+    /**
+     *  init function (should be in Constructor).
+     */
+    void init();
+
+  private:
+
+    /**
+     * @param pts an array of points.
+     * @param nb the number of points.
+     * @return 'true' if no clipping plane cuts one of the points.
+     */
+    bool notCut( const RealPoint * pts, unsigned int nb ) const;
+
+    /**
+     * Projects a 3D triangle and appends it to @a out if it may cover
+     * at least one pixel center.
+     */
+    void addRasterTriangle( const Vertex & v0, const Vertex & v1, const Vertex & v2,
+                            const DGtal::Color & aColor,
+                            std::vector<RasterTriangle> & out ) const;
+
+    /// Appends the screen triangles of a convex planar polygon (a fan).
+    void addRasterPolygon( const RealPoint * pts, unsigned int nb,
+                           const RealPoint & normal, const DGtal::Color & aColor,
+                           std::vector<RasterTriangle> & out ) const;
+
+    /// Appends the screen triangles of a primitive.
+    void addPrimitive( const typename Base::CubeD3D & cube, std::vector<RasterTriangle> & out ) const;
+    /// Appends the screen triangles of a primitive.
+    void addPrimitive( const typename Base::QuadD3D & quad, std::vector<RasterTriangle> & out ) const;
+    /// Appends the screen triangles of a primitive.
+    void addPrimitive( const typename Base::TriangleD3D & triangle, std::vector<RasterTriangle> & out ) const;
+    /// Appends the screen triangles of a primitive.
+    void addPrimitive( const typename Base::PolygonD3D & polygon, std::vector<RasterTriangle> & out ) const;
+    /// Appends the screen triangles of a primitive.
+    void addPrimitive( const typename Base::BallD3D & ball, std::vector<RasterTriangle> & out ) const;
+
+    /**
+     * Appends the screen triangles of a list of primitives to
+     * myTriangles. Primitives are processed in parallel by blocks
+     * whose outputs are concatenated in order, so that the result does
+     * not depend on the number of threads.
+     */
+    template <typename TPrimitive>
+    void addPrimitives( const std::vector<const TPrimitive*> & primitives, int nbThreads );
+
+    /**
+     * Rasterizes and shades the tile (tx,ty) with the triangles whose
+     * indices are in the range [first,last).
+     */
+    void renderTile( unsigned int tx, unsigned int ty,
+                     const unsigned int * first, const unsigned int * last );
+
+  }; // end of class Board3DRaster
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'Board3DRaster'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'Board3DRaster' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename Space, typename KSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const Board3DRaster<Space, KSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/boards/Board3DRaster.ih"
+
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined Board3DRaster_h
+
+#undef Board3DRaster_RECURSES
+#endif // else defined(Board3DRaster_RECURSES)
@@ -0,0 +1,394 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file   GLInstancedRenderer.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * @brief
+ *
+ * Header file for module GLInstancedRenderer.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(GLInstancedRenderer_RECURSES)
+#error Recursive header files inclusion detected in GLInstancedRenderer.h
+#else // defined(GLInstancedRenderer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define GLInstancedRenderer_RECURSES
+
+#if !defined GLInstancedRenderer_h
+/** Prevents repeated inclusion of headers. */
+#define GLInstancedRenderer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <map>
+#include <string>
+#include <cstddef>
+#include <functional>
+#ifdef WIN32
+#include <windows.h>
+#endif
+#ifdef APPLE
+#include <OpenGL/gl.h>
+#else
+#include <GL/gl.h>
+#endif
+
+#include "DGtal/base/Common.h"
+#include "DGtal/io/Display3D.h"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class GLInstancedRenderer
+  /**
+   * Description of template class 'GLInstancedRenderer' <p>
+   * \brief Aim: draws the cubes and balls of a Display3D with vertex
+   * buffer objects and instanced drawing, instead of one display
+   * list of immediate-mode calls per primitive.
+   *
+   * The renderer keeps packed per-instance arrays (center and size as
+   * four floats, RGBA color as four bytes) of the cube lists
+   * (Display3D::CubesMap) and ball lists of a Display3D. A single
+   * unit cube or unit sphere mesh is stored in the GPU memory and
+   * drawn once per instance by a small GLSL program, lit with the
+   * fixed pipeline light 0 and material so that it looks like the
+   * display lists of Viewer3D.
+   *
+   * The synchronization with the lists is incremental: when the
+   * lists only grew since the last call to sync() (objects streamed
+   * into the viewer), only the new instances are packed and sent to
+   * the GPU. Any other change (a list shrank, its last synchronized
+   * element was modified, ...) triggers a complete rebuild. Changes
+   * of elements which are not the last synchronized one of their
+   * list are not detected: call invalidate() after such changes
+   * (e.g. after sorting the lists).
+   *
+   * The GL side needs OpenGL 3.1 (or the extensions
+   * ARB_draw_instanced and ARB_instanced_arrays) with a compatibility
+   * profile. The functions beyond OpenGL 1.1 are obtained with the
+   * loader given to initializeGL(), so that the class does not depend
+   * on any windowing or extension library. All GL methods must be
+   * called with the same current GL context. The CPU side (sync() and
+   * the packed arrays) needs no context.
+   *
+   * @code
+   * GLInstancedRenderer<> renderer;
+   * // once, with a current GL context:
+   * renderer.initializeGL( loader );
+   * // when the lists of the display changed:
+   * renderer.sync( cubesMap, ballSetList );
+   * // each frame:
+   * renderer.draw();
+   * // before the context is destroyed:
+   * renderer.releaseGL();
+   * @endcode
+   *
+   * @tparam TSpace any model of Digital 3D Space
+   * @tparam TKSpace any mode of Khalimksky 3D space
+   *
+   * @see Viewer3D, Display3D
+   */
+  template < typename TSpace = Z3i::Space, typename TKSpace = Z3i::KSpace >
+  class GLInstancedRenderer
+  {
+    // ----------------------- Standard types ------------------------------
+  public:
+    typedef TSpace Space;
+    typedef TKSpace KSpace;
+    typedef GLInstancedRenderer<Space, KSpace> Self;
+    typedef Display3D<Space, KSpace> Display;
+    typedef typename Display::CubesMap CubesMap;
+    typedef typename Display::BallD3D BallD3D;
+    /// The ball lists of a Display3D.
+    typedef std::vector< std::vector<BallD3D> > BallLists;
+    /// Gives the address of a GL function from its name (e.g. eglGetProcAddress).
+    typedef std::function< void*( const char * ) > ProcAddressLoader;
+
+    /// A range of instances sharing the same name and mesh, drawn with one call.
+    struct DrawRange
+    {
+      DGtal::int32_t name;     ///< Name of the list (the cube list key or the ball list index).
+      std::size_t first;       ///< Index of the first instance.
+      std::size_t count;       ///< Number of instances.
+      unsigned int resolution; ///< Resolution of the sphere mesh (0 for cubes).
+    };
+
+    /// Packed per-instance arrays (structure of arrays) and their draw ranges.
+    struct InstanceArrays
+    {
+      std::vector<float> geometry;         ///< Center x, y, z and size (half width or radius) per instance.
+      std::vector<DGtal::uint32_t> colors; ///< RGBA bytes per instance, in memory order.
+      std::vector<DrawRange> ranges;       ///< Draw ranges, in packing order.
+
+      /// @return the number of instances.
+      std::size_t size() const { return colors.size(); }
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Nothing is packed and the GL side is not initialized.
+     */
+    GLInstancedRenderer();
+
+    /**
+     * Destructor. It does not release the GL objects, which needs the
+     * GL context: call releaseGL() before.
+     */
+    ~GLInstancedRenderer();
+
+    // ----------------------- CPU side --------------------------------------
+  public:
+
+    /**
+     * Packs the new instances of the cube and ball lists of a display.
+     *
+     * @param cubes the cube lists (Display3D::myCubesMap).
+     * @param balls the ball lists (Display3D::myBallSetList).
+     * @return 'true' if the arrays were rebuilt, 'false' if only new
+     * instances were appended (or nothing changed).
+     */
+    bool sync( const CubesMap & cubes, const BallLists & balls );
+
+    /**
+     * Forces a complete rebuild of the arrays at the next call to sync().
+     */
+    void invalidate();
+
+    /// @return the packed cube instances.
+    const InstanceArrays & cubeInstances() const { return myCubes; }
+
+    /// @return the packed ball instances.
+    const InstanceArrays & ballInstances() const { return myBalls; }
+
+    /// @return the number of instances appended by the last call to sync().
+    std::size_t nbAppendedInstances() const { return myNbAppended; }
+
+    /// @return the total number of instances sent to the GPU so far.
+    std::size_t nbUploadedInstances() const { return myNbUploaded; }
+
+    // ----------------------- GL side ---------------------------------------
+  public:
+
+    /**
+     * Loads the GL functions, compiles the shader program and creates
+     * the buffers. Needs a current GL context.
+     *
+     * @param loader gives the address of a GL function from its name.
+     * @return 'true' if instanced rendering is available; otherwise
+     * the renderer draws nothing and the error is given by glError().
+     */
+    bool initializeGL( const ProcAddressLoader & loader );
+
+    /// @return 'true' if initializeGL() succeeded and releaseGL() was not called.
+    bool isInitialized() const { return myProgram != 0; }
+
+    /// @return the last error of initializeGL(), empty if none.
+    const std::string & glError() const { return myGLError; }
+
+    /**
+     * Sends the instances packed since the last upload to the GPU.
+     * Called by draw(), so it is only useful to control when the
+     * transfer happens.
+     */
+    void upload();
+
+    /**
+     * Draws the cube and ball instances with the current modelview and
+     * projection matrices, clipping planes, light 0 and material.
+     *
+     * @param selectedName the instances of the cube list with this
+     * name are drawn with shifted colors (-1 for none).
+     * @param selectionColorShift the color shift of selected instances (in [0,255]).
+     */
+    void draw( DGtal::int32_t selectedName = -1, unsigned int selectionColorShift = 150 );
+
+    /**
+     * Draws the cube instances only (see draw()).
+     * @param selectedName the name of the selected cube list (-1 for none).
+     * @param selectionColorShift the color shift of selected instances.
+     */
+    void drawCubes( DGtal::int32_t selectedName = -1, unsigned int selectionColorShift = 150 );
+
+    /**
+     * Draws the ball instances only (see draw()).
+     */
+    void drawBalls();
+
+    /**
+     * Deletes the GL objects. Needs the GL context of initializeGL().
+     * The packed arrays are kept and uploaded again after a new call
+     * to initializeGL().
+     */
+    void releaseGL();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private types --------------------------------
+  private:
+
+    /// Synchronization state of a list.
+    struct ListState
+    {
+      std::size_t packed; ///< Number of elements of the list already packed.
+      std::size_t last;   ///< Index of the instance of its last packed element.
+    };
+
+    /// GPU buffers of an array of instances.
+    struct InstanceBuffers
+    {
+      GLuint geometry;       ///< Buffer of InstanceArrays::geometry.
+      GLuint colors;         ///< Buffer of InstanceArrays::colors.
+      std::size_t capacity;  ///< Number of instances allocated in the buffers.
+      std::size_t uploaded;  ///< Number of instances up to date in the buffers.
+    };
+
+    /// A mesh in a GPU buffer (interleaved positions and normals).
+    struct Mesh
+    {
+      GLuint buffer;     ///< Buffer of the vertices.
+      GLsizei nbVertices;///< Number of vertices (triangles).
+    };
+
+    /// The GL functions beyond OpenGL 1.1.
+    struct Functions;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    InstanceArrays myCubes;  ///< packed cubes
+    InstanceArrays myBalls;  ///< packed balls
+    std::map<DGtal::int32_t, ListState> myCubeStates; ///< state of each cube list
+    std::vector<ListState> myBallStates;               ///< state of each ball list
+    bool myNeedRebuild;       ///< true if the next sync must rebuild
+    std::size_t myNbAppended; ///< instances appended by the last sync
+    std::size_t myNbUploaded; ///< instances sent to the GPU so far
+
+    Functions * myGL;             ///< loaded GL functions (owned)
+    std::string myGLError;        ///< last error of initializeGL
+    GLuint myProgram;             ///< shader program (0 if not initialized)
+    GLint myColorShiftLocation;   ///< location of the uniform colorShift
+    InstanceBuffers myCubeBuffers;  ///< GPU cubes
+    InstanceBuffers myBallBuffers;  ///< GPU balls
+    Mesh myCubeMesh;                          ///< unit cube
+    std::map<unsigned int, Mesh> mySphereMeshes; ///< unit spheres by resolution
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// Copy constructor (forbidden).
+    GLInstancedRenderer( const GLInstancedRenderer & other ) = delete;
+
+    /// Assignment (forbidden).
+    GLInstancedRenderer & operator=( const GLInstancedRenderer & other ) = delete;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Clears the packed arrays and states.
+    void clearInstances();
+
+    /**
+     * Appends an instance to @a arrays, in the range of @a name
+     * (merged with the last range when possible).
+     */
+    static void pushInstance( InstanceArrays & arrays, DGtal::int32_t name,
+                              unsigned int resolution,
+                              const typename Display::RealPoint & center,
+                              double size, const DGtal::Color & color );
+
+    /**
+     * @return 'true' if the instance @a index of @a arrays has these values.
+     */
+    static bool sameInstance( const InstanceArrays & arrays, std::size_t index,
+                              const typename Display::RealPoint & center,
+                              double size, const DGtal::Color & color );
+
+    /// @return 'true' if the arrays must be rebuilt to follow the lists.
+    bool needRebuild( const CubesMap & cubes, const BallLists & balls ) const;
+
+    /// Sends the new instances of @a arrays to @a buffers.
+    void uploadInstances( const InstanceArrays & arrays, InstanceBuffers & buffers );
+
+    /// Creates a mesh buffer from interleaved positions and normals.
+    Mesh createMesh( const std::vector<float> & vertices );
+
+    /// @return the unit sphere mesh of a resolution (created on demand).
+    const Mesh & sphereMesh( unsigned int resolution );
+
+    /// Draws the ranges of @a arrays with a mesh given by @a meshOf.
+    template <typename TMeshFunctor>
+    void drawInstances( const InstanceArrays & arrays, const InstanceBuffers & buffers,
+                        TMeshFunctor meshOf, DGtal::int32_t selectedName,
+                        unsigned int selectionColorShift );
+
+    /// Deletes the buffers of @a buffers and resets them.
+    void deleteInstanceBuffers( InstanceBuffers & buffers );
+
+  }; // end of class GLInstancedRenderer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'GLInstancedRenderer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'GLInstancedRenderer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const GLInstancedRenderer<TSpace, TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/viewers/GLInstancedRenderer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined GLInstancedRenderer_h
+
+#undef GLInstancedRenderer_RECURSES
+#endif // else defined(GLInstancedRenderer_RECURSES)
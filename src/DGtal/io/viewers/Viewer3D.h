@@ -70,6 +70,8 @@
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/io/Display3D.h"
+#include "DGtal/io/viewers/GLInstancedRenderer.h"
+#include "DGtal/base/TimeAccumulator.h"
 #include "DGtal/math/BasicMathFunctions.h"
 
 #include "DGtal/kernel/CSpace.h"
@@ -307,6 +309,11 @@ namespace DGtal
       resize(800,600);
     }
 
+    /**
+     * Destructor. Releases the buffers of the instanced rendering.
+     */
+    ~Viewer3D();
+
     /// Sets the extension \a ext to the viewer. The object is
     /// acquired by the viewer and should be dynamically allocated.
     /// @param ext any dynamically allocated object deriving from Extension.
@@ -456,6 +463,54 @@ namespace DGtal
      **/    
     void setUseGLPointForBalls(bool useOpenGLPt);
 
+
+    /**
+     *  Draws the cubes and balls with vertex buffer objects and
+     *  instanced drawing (see GLInstancedRenderer) instead of display
+     *  lists. Then, updateList() only sends the objects added since
+     *  the previous update to the GPU. Falls back to display lists
+     *  when the OpenGL context does not support instancing (OpenGL
+     *  3.3 or ARB_instanced_arrays).
+     *
+     *  @param[in] useInstancing if true (default false) the cubes and
+     *  balls are drawn with instanced rendering.
+     *
+     **/
+    void setUseInstancedRendering(bool useInstancing);
+
+    /// @return 'true' if the cubes and balls are drawn with instanced rendering.
+    bool isInstancedRendering() const
+    {
+      return myUseInstancedRendering;
+    }
+
+
+    /**
+     *  Enables the frame time counter. Each call to paintGL is then
+     *  timed until the completion of its OpenGL commands (glFinish).
+     *
+     *  @param[in] enable if true (default false) the frame times are
+     *  accumulated in frameTimes().
+     *
+     **/
+    void setFrameTimeCounter(bool enable)
+    {
+      myFrameTimeCounter = enable;
+    }
+
+    /// @return the durations (in milliseconds) of the frames drawn
+    /// since the last resetFrameTimes() with the frame time counter.
+    const TimeAccumulator<> & frameTimes() const
+    {
+      return myFrameTimes;
+    }
+
+    /// Clears the frame time counter.
+    void resetFrameTimes()
+    {
+      myFrameTimes.reset();
+    }
+
     
     /**
      * Change the current rendering mode of the viewer.
@@ -1390,6 +1445,15 @@ namespace DGtal
     void glCreateListCubesMaps(const typename Display3D<Space, KSpace>::CubesMap &aCubeMap, unsigned int idList);
 
 
+    /**
+     * Initializes the instanced rendering if it is required and not
+     * done yet (needs the current OpenGL context). Disables it if the
+     * OpenGL context does not support it.
+     * @return 'true' if the cubes and balls are drawn with instanced rendering.
+     **/
+    bool glInitInstancedRendering();
+
+
 
     /**
      * Creates an OpenGL list of type GL_QUADS from a vector of QuadD3D.
@@ -1642,6 +1706,12 @@ namespace DGtal
     
     bool myUseGLPointsForBalls =  false; // to display balls with GL points (instead real ball) 
 
+    GLInstancedRenderer<Space, KSpace> myInstancedRenderer; ///< instanced drawing of cubes and balls
+    bool myUseInstancedRendering = false; ///< true to draw cubes and balls with myInstancedRenderer
+    bool myNamedListsValid = true; ///< false when the cube and ball lists used for selection are not compiled
+    bool myFrameTimeCounter = false; ///< true to time each frame
+    TimeAccumulator<> myFrameTimes; ///< durations of the timed frames
+
     double ZNear; ///< znear distance
     double ZFar; ///< zfar distance
 
@@ -124,6 +124,39 @@ namespace DGtal
     using type = typename std::common_type<T, U>::type; //! Arithmetic operation result type.
   };
 
+#ifdef WITH_INT128
+  namespace details
+  {
+    /// Arithmetic types, including 128-bit integers in strict ISO modes.
+    template <typename T>
+    struct IsArithmeticOrInt128
+      : std::integral_constant< bool,
+                                   std::is_arithmetic<T>::value
+                                || std::is_same<T, DGtal::int128_t>::value
+                                || std::is_same<T, DGtal::uint128_t>::value >
+    {};
+  } // namespace details
+
+  /** @brief Specialization for 128-bit integers when the standard
+   *  library does not consider them as arithmetic types (strict ISO
+   *  modes, e.g. -std=c++11 instead of -std=gnu++11).
+   *
+   * Resulting type is deduced from usual arithmetic conversion using
+   * std::common_type.
+   *
+   * @see ArithmeticConversionTraits
+   */
+  template <typename T, typename U>
+  struct ArithmeticConversionTraits< T, U,
+      typename std::enable_if<    details::IsArithmeticOrInt128<T>::value
+                               && details::IsArithmeticOrInt128<U>::value
+                               && ! (    std::is_arithmetic<T>::value
+                                      && std::is_arithmetic<U>::value ) >::type >
+  {
+    using type = typename std::common_type<T, U>::type; //! Arithmetic operation result type.
+  };
+#endif
+
   /** @brief Result type of arithmetic binary operators between two given types.
    *
    * @tparam T      First operand type.
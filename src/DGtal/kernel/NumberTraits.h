@@ -376,6 +376,159 @@ namespace DGtal
     using UnsignedVersion = T; ///< Alias to the unsigned version of a floating-point type (aka itself).
   }; // end of class NumberTraitsImpl
 
+#ifdef WITH_INT128
+  namespace details
+  {
+    /**
+     * NumberTraits common part for the 128-bit integer types. It does
+     * not rely on std::numeric_limits nor std::is_integral, which are
+     * not specialized for them in strict ISO modes.
+     *
+     * @tparam T      DGtal::int128_t or DGtal::uint128_t.
+     * @tparam Signed true for the signed version.
+     */
+    template <typename T, bool Signed>
+    struct NumberTraitsImpl128
+    {
+      // ----------------------- Associated types ------------------------------
+      using IsBounded     = TagTrue;                                ///< A 128-bit integer is bounded.
+      using IsUnsigned    = typename BoolToTag<!Signed>::type;      ///< Is the number unsigned.
+      using IsSigned      = typename BoolToTag<Signed>::type;       ///< Is the number signed.
+      using IsIntegral    = TagTrue;                                ///< A 128-bit integer is of integral type.
+      using IsSpecialized = TagTrue;                                ///< Is that a number type with specific traits.
+      using SignedVersion   = DGtal::int128_t;                      ///< Alias to the signed version of the number type.
+      using UnsignedVersion = DGtal::uint128_t;                     ///< Alias to the unsigned version of the number type.
+      using ReturnType  = T;  ///< Alias to the type that should be used as return type.
+      using ParamType   = T;  ///< A 128-bit integer is passed by value.
+
+      /// Constant Zero.
+      static constexpr T ZERO = T(0);
+
+      /// Constant One.
+      static constexpr T ONE  = T(1);
+
+      /// Return the zero of this integer.
+      static inline constexpr
+      ReturnType zero() noexcept
+      {
+        return ZERO;
+      }
+
+      /// Return the one of this integer.
+      static inline constexpr
+      ReturnType one() noexcept
+      {
+        return ONE;
+      }
+
+      /// Return the minimum possible value for this type of number.
+      static inline constexpr
+      ReturnType min() noexcept
+      {
+        return Signed ? static_cast<T>( -max() - 1 ) : ZERO;
+      }
+
+      /// Return the maximum possible value for this type of number.
+      static inline constexpr
+      ReturnType max() noexcept
+      {
+        return static_cast<T>( Signed ? ( ~DGtal::uint128_t( 0 ) ) >> 1 : ~DGtal::uint128_t( 0 ) );
+      }
+
+      /// Return the number of significant binary digits for this type of number.
+      static inline constexpr
+      unsigned int digits() noexcept
+      {
+        return Signed ? 127 : 128;
+      }
+
+      /** @brief Return the bounding type of the number.
+       *
+       * @return BOUNDED.
+       */
+      static inline constexpr
+      BoundEnum isBounded() noexcept
+      {
+        return BOUNDED;
+      }
+
+      /** @brief Return the sign type of the number.
+       *
+       * @return SIGNED or UNSIGNED.
+       */
+      static inline constexpr
+      SignEnum isSigned() noexcept
+      {
+        return Signed ? SIGNED : UNSIGNED;
+      }
+
+      /** @brief
+       * Cast method to DGtal::int64_t (for I/O or board export uses
+       * only).
+       */
+      static inline constexpr
+      DGtal::int64_t castToInt64_t(const T & aT) noexcept
+      {
+        return static_cast<DGtal::int64_t>(aT);
+      }
+
+      /** @brief
+       * Cast method to double (for I/O or board export uses
+       * only).
+       */
+      static inline constexpr
+      double castToDouble(const T & aT) noexcept
+      {
+        return static_cast<double>(aT);
+      }
+
+      /** @brief Check the parity of a number.
+       *
+       * @param aT any number.
+       * @return 'true' iff the number is even.
+       */
+      static inline constexpr
+      bool even( ParamType aT ) noexcept
+      {
+        return ( aT & ONE ) == ZERO;
+      }
+
+      /** @brief Check the parity of a number.
+       *
+       * @param aT any number.
+       * @return 'true' iff the number is odd.
+       */
+      static inline constexpr
+      bool odd( ParamType aT ) noexcept
+      {
+        return ( aT & ONE ) != ZERO;
+      }
+    };
+
+    // Definition of the static attributes in order to allow ODR-usage.
+    template <typename T, bool Signed> constexpr T NumberTraitsImpl128<T, Signed>::ZERO;
+    template <typename T, bool Signed> constexpr T NumberTraitsImpl128<T, Signed>::ONE;
+
+  } // namespace details
+
+  /** @brief Specialization of NumberTraitsImpl for DGtal::int128_t.
+   *
+   * A fixed-width alternative to DGtal::BigInteger when the
+   * computations are known to fit in 127 bits (e.g. plane recognition
+   * with 64-bit input points).
+   */
+  template <>
+  struct NumberTraitsImpl<DGtal::int128_t, void>
+    : details::NumberTraitsImpl128<DGtal::int128_t, true>
+  {};
+
+  /// Specialization of NumberTraitsImpl for DGtal::uint128_t.
+  template <>
+  struct NumberTraitsImpl<DGtal::uint128_t, void>
+    : details::NumberTraitsImpl128<DGtal::uint128_t, false>
+  {};
+#endif // WITH_INT128
+
 #ifdef WITH_BIGINTEGER
   /** @brief Specialization of NumberTraitsImpl for DGtal::BigInteger
    *
@@ -0,0 +1,298 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FlatMesh.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module FlatMesh.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FlatMesh_RECURSES)
+#error Recursive header files inclusion detected in FlatMesh.h
+#else // defined(FlatMesh_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FlatMesh_RECURSES
+
+#if !defined FlatMesh_h
+/** Prevents repeated inclusion of headers. */
+#define FlatMesh_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/HalfEdgeDataStructure.h"
+#include "DGtal/shapes/Mesh.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FlatMesh
+  /**
+   * Description of template class 'FlatMesh' <p> \brief Aim: Represents
+   * a soup of polygonal faces like Mesh, but with all the face indices
+   * stored in flat arrays instead of one vector per face.
+   *
+   * As long as only triangles are added, the faces are stored in a
+   * single array of HalfEdgeDataStructure::Triangle (triangle fast
+   * path). As soon as a face with more than three vertices is added,
+   * the faces are stored in compressed rows: an array of vertex
+   * indices and an array of offsets, the face \a f being the indices
+   * in the range [offsets()[f], offsets()[f+1]).
+   *
+   * Faces are accessed through FlatMesh::FaceView, a pair of pointers
+   * into the mesh storage, so that iterating over the faces never
+   * allocates. The storage arrays can be moved into a
+   * TriangulatedSurface or a PolygonalSurface (see
+   * MeshHelpers::flatMesh2TriangulatedSurface and
+   * MeshHelpers::flatMesh2PolygonalSurface).
+   *
+   * @code
+   * FlatMesh<Z3i::RealPoint> mesh;
+   * mesh.reserve( 4, 2 );
+   * mesh.addVertex( Z3i::RealPoint( 0, 0, 0 ) );
+   * ...
+   * mesh.addTriangle( 0, 1, 2 );
+   * mesh.addTriangle( 2, 1, 3 );
+   * for ( FlatMesh<Z3i::RealPoint>::Index f = 0; f < mesh.nbFaces(); ++f )
+   *   for ( auto v : mesh.face( f ) )
+   *     std::cout << mesh.vertex( v ) << std::endl;
+   * @endcode
+   *
+   * @tparam TPoint a type defining the position in space of vertices.
+   *
+   * @see Mesh, TriangulatedSurface, PolygonalSurface
+   */
+  template <typename TPoint>
+  class FlatMesh
+  {
+  public:
+    typedef TPoint                                   Point;
+    typedef FlatMesh<TPoint>                         Self;
+    typedef HalfEdgeDataStructure::Size              Size;
+    typedef HalfEdgeDataStructure::Index             Index;
+    typedef HalfEdgeDataStructure::Triangle          Triangle;
+    typedef std::vector<Point>                       VertexStorage;
+    typedef std::vector<Triangle>                    TriangleStorage;
+    typedef std::vector<Index>                       IndexStorage;
+
+    /// A read-only view on the vertex indices of one face of the
+    /// mesh. It references the mesh storage and is invalidated by any
+    /// modification of the faces of the mesh.
+    class FaceView
+    {
+    public:
+      typedef const Index* ConstIterator;
+      typedef const Index* const_iterator;
+
+      /// Constructor from a range of indices.
+      FaceView( const Index* itb, const Index* ite )
+        : myBegin( itb ), myEnd( ite ) {}
+
+      /// @return an iterator on the first vertex index of the face.
+      ConstIterator begin() const { return myBegin; }
+      /// @return an iterator after the last vertex index of the face.
+      ConstIterator end() const { return myEnd; }
+      /// @return the number of vertices of the face.
+      Size size() const { return myEnd - myBegin; }
+      /// @param i any index in 0..size()-1.
+      /// @return the index of the \a i-th vertex of the face.
+      Index operator[]( Size i ) const { return myBegin[ i ]; }
+
+    private:
+      const Index* myBegin;
+      const Index* myEnd;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The mesh is empty.
+    FlatMesh() = default;
+    /// Default copy constructor.
+    FlatMesh( const Self& other ) = default;
+    /// Default move constructor.
+    FlatMesh( Self&& other ) = default;
+    /// Default assignment.
+    Self& operator=( const Self& other ) = default;
+    /// Default move assignment.
+    Self& operator=( Self&& other ) = default;
+
+    /// Constructor from a mesh. Copies the vertices and the faces of
+    /// \a mesh (its colors are ignored).
+    /// @param mesh any mesh.
+    explicit FlatMesh( const Mesh<Point>& mesh );
+
+    /// Clears everything. The mesh is back to the triangle fast path.
+    void clear();
+
+    /// Reserves memory for the given number of elements.
+    /// @param nbVertices the expected number of vertices.
+    /// @param nbFaces the expected number of faces.
+    /// @param nbIndices the expected total number of face indices
+    /// (when 0, three indices per face are expected).
+    void reserve( Size nbVertices, Size nbFaces, Size nbIndices = 0 );
+
+    /// Adds a new vertex to the mesh.
+    /// @param p the position of the vertex.
+    /// @return the index of the new vertex.
+    Index addVertex( const Point& p );
+
+    /// Adds a new triangle to the mesh.
+    /// @return the index of the new face.
+    Index addTriangle( Index v0, Index v1, Index v2 );
+
+    /// Adds a new face to the mesh, given by the range of its vertex
+    /// indices. A face with more than three vertices switches the
+    /// mesh to compressed rows storage.
+    ///
+    /// @tparam TInputIterator the type of an input iterator on indices.
+    /// @param itb an iterator on the first vertex index of the face.
+    /// @param ite an iterator after the last vertex index of the face.
+    /// @return the index of the new face.
+    template <typename TInputIterator>
+    Index addFace( TInputIterator itb, TInputIterator ite );
+
+    // ----------------------- Accessors ------------------------------
+  public:
+
+    /// @return the number of vertices of the mesh.
+    Size nbVertices() const { return myVertices.size(); }
+
+    /// @return the number of faces of the mesh.
+    Size nbFaces() const
+    { return myOffsets.empty() ? myTriangles.size() : myOffsets.size() - 1; }
+
+    /// @return the total number of vertex indices of the faces.
+    Size nbIndices() const
+    { return myOffsets.empty() ? 3 * myTriangles.size() : myIndices.size(); }
+
+    /// @return 'true' if the faces are stored as triangles
+    /// (triangles()), 'false' if they are stored in compressed rows
+    /// (indices() and offsets()).
+    bool isTriangular() const { return myOffsets.empty(); }
+
+    /// @param i any vertex index.
+    /// @return the position of the vertex \a i.
+    const Point& vertex( Index i ) const { return myVertices[ i ]; }
+
+    /// @param i any vertex index.
+    /// @return a reference to the position of the vertex \a i.
+    Point& vertex( Index i ) { return myVertices[ i ]; }
+
+    /// @param f any face index.
+    /// @return the number of vertices of the face \a f.
+    Size faceSize( Index f ) const
+    { return myOffsets.empty() ? 3 : myOffsets[ f + 1 ] - myOffsets[ f ]; }
+
+    /// @param f any face index.
+    /// @return a view on the vertex indices of the face \a f.
+    FaceView face( Index f ) const;
+
+    /// @return a const reference to the vertex positions.
+    const VertexStorage& vertices() const { return myVertices; }
+
+    /// @return a reference to the vertex positions, which may be
+    /// modified or moved out (the mesh should then be cleared).
+    VertexStorage& vertices() { return myVertices; }
+
+    /// @return a const reference to the triangles (empty if the mesh
+    /// is not triangular).
+    const TriangleStorage& triangles() const { return myTriangles; }
+
+    /// @return a reference to the triangles (empty if the mesh is not
+    /// triangular), which may be moved out (the mesh should then be
+    /// cleared).
+    TriangleStorage& triangles() { return myTriangles; }
+
+    /// @return a const reference to the vertex indices of the faces
+    /// (empty if the mesh is triangular).
+    const IndexStorage& indices() const { return myIndices; }
+
+    /// @return a const reference to the face offsets in indices()
+    /// (empty if the mesh is triangular, nbFaces()+1 values otherwise).
+    const IndexStorage& offsets() const { return myOffsets; }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if every face has at least three vertices which
+     * are all valid vertex indices.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The positions of the vertices.
+    VertexStorage   myVertices;
+    /// The faces when the mesh is triangular.
+    TriangleStorage myTriangles;
+    /// The vertex indices of the faces when the mesh is not triangular.
+    IndexStorage    myIndices;
+    /// The offsets of the faces in myIndices when the mesh is not
+    /// triangular (empty otherwise).
+    IndexStorage    myOffsets;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+    /// Moves the triangles into compressed rows storage.
+    void switchToCompressedRows();
+
+  }; // end of class FlatMesh
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FlatMesh'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FlatMesh' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint>
+  std::ostream&
+  operator<< ( std::ostream & out, const FlatMesh<TPoint> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/FlatMesh.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FlatMesh_h
+
+#undef FlatMesh_RECURSES
+#endif // else defined(FlatMesh_RECURSES)
@@ -0,0 +1,275 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MarchingCubes.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MarchingCubes.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MarchingCubes_RECURSES)
+#error Recursive header files inclusion detected in MarchingCubes.h
+#else // defined(MarchingCubes_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MarchingCubes_RECURSES
+
+#if !defined MarchingCubes_h
+/** Prevents repeated inclusion of headers. */
+#define MarchingCubes_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/HalfEdgeDataStructure.h"
+#include "DGtal/shapes/FlatMesh.h"
+#include "DGtal/shapes/TriangulatedSurface.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MarchingCubes
+  /**
+   * Description of template class 'MarchingCubes' <p> \brief Aim:
+   * Extracts the iso-surface of a 3D gray-scale image
+   * (ImageContainerBySTLVector) as a triangulated surface, with the
+   * marching cubes algorithm.
+   *
+   * The cubes have the image points as corners. A point is inside iff
+   * its value is greater than the iso-value, and each vertex of the
+   * surface lies on a grid edge between an inside and an outside
+   * point, at the linearly interpolated position of the
+   * iso-value. The triangles of a cube are obtained by chaining its
+   * face segments into loops, which are fan triangulated. Ambiguous
+   * faces (two diagonally opposite inside points) are resolved by the
+   * mean of their four values, so that the output is crack-free and
+   * vertices are shared between cubes.
+   *
+   * When the extractor is \e closed, the points around the image
+   * domain are considered outside (the vertices toward them lie in the
+   * middle of the grid edges), so that the surface is closed.
+   *
+   * The image is processed by slabs of consecutive cube layers, in
+   * parallel when OpenMP is available. Each slab keeps an edge cache
+   * of two planes of grid edges, giving each vertex a unique index
+   * computed from the number of vertices of the previous planes
+   * (counted in a first pass). Triangles may be streamed to any
+   * writer providing the methods `addVertex( const RealPoint& )` and
+   * `addTriangle( Index, Index, Index )` (e.g. FlatMesh or
+   * TriangulatedSurface): the vertices are given in index order, and
+   * each triangle after its three vertices, slab after slab.
+   *
+   * @code
+   * MarchingCubes< ImageContainerBySTLVector< Z3i::Domain, unsigned char > > mc( image );
+   * TriangulatedSurface< Z3i::RealPoint > trisurf;
+   * mc.makeTriangulatedSurface( 127.5, trisurf );
+   * @endcode
+   *
+   * @tparam TImage the type of image, some ImageContainerBySTLVector
+   * over a 3D domain whose values are convertible to double.
+   *
+   * @see FlatMesh, MeshHelpers::flatMesh2TriangulatedSurface
+   */
+  template <typename TImage>
+  class MarchingCubes
+  {
+    BOOST_STATIC_ASSERT(( TImage::Domain::dimension == 3 ));
+
+  public:
+    typedef TImage                                  Image;
+    typedef MarchingCubes<TImage>                   Self;
+    typedef typename Image::Value                   Value;
+    typedef typename Image::Domain                  Domain;
+    typedef typename Domain::Point                  Point;
+    typedef typename Domain::Space                  Space;
+    typedef typename Space::RealPoint               RealPoint;
+    typedef HalfEdgeDataStructure::Size             Size;
+    typedef HalfEdgeDataStructure::Index            Index;
+    typedef HalfEdgeDataStructure::Triangle         Triangle;
+    typedef std::vector<RealPoint>                  VertexStorage;
+    typedef std::vector<Triangle>                   TriangleStorage;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param image the gray-scale image (aliased).
+     * @param closed when 'true', the points outside the domain are
+     * considered outside, which closes the surface along the domain
+     * border, otherwise only the cubes within the domain are processed.
+     */
+    MarchingCubes( ConstAlias<Image> image, bool closed = true );
+
+    /**
+     * Extracts the iso-surface and streams it to a writer.
+     *
+     * @tparam TTriangleWriter a type providing `addVertex( const
+     * RealPoint& )` and `addTriangle( Index, Index, Index )`.
+     *
+     * @param isovalue the iso-value of the surface.
+     * @param[in,out] writer the writer receiving the vertices and the triangles.
+     * @param nbThreads the number of threads (0: all available).
+     * @param slabThickness the number of cube layers per slab (0: automatic).
+     * @return the number of triangles.
+     */
+    template <typename TTriangleWriter>
+    Size extract( double isovalue, TTriangleWriter & writer,
+                  int nbThreads = 0, Size slabThickness = 0 ) const;
+
+    /**
+     * Extracts the iso-surface as a triangulated surface. The
+     * triangles are gathered in a FlatMesh whose buffers are then
+     * moved into \a trisurf.
+     *
+     * @param isovalue the iso-value of the surface.
+     * @param[out] trisurf the output triangulated surface.
+     * @param nbThreads the number of threads (0: all available).
+     * @return 'true' if the triangulated surface was built.
+     */
+    bool makeTriangulatedSurface( double isovalue,
+                                  TriangulatedSurface<RealPoint> & trisurf,
+                                  int nbThreads = 0 ) const;
+
+    /// @return the image.
+    const Image & image() const { return *myImage; }
+
+    /// @return 'true' if the surfaces are closed along the domain border.
+    bool isClosed() const { return myClosed; }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The image.
+    const Image* myImage;
+    /// When 'true', the points outside the domain are outside.
+    bool myClosed;
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+
+    /// The grid of the cube corners.
+    struct Grid
+    {
+      /// The position of the first corner.
+      Point origin;
+      /// The number of corners along each axis.
+      Size nx, ny, nz;
+      /// The size of the image domain along each axis.
+      Size dx, dy, dz;
+      /// The position of the first point of the domain in the grid.
+      Size shift;
+    };
+
+    /// The values and states of one plane of corners (state 0:
+    /// outside, 1: inside, 2: out of the domain).
+    struct Plane
+    {
+      std::vector<double>        values;
+      std::vector<unsigned char> states;
+    };
+
+    /// The result of a slab: its own vertices and its triangles.
+    struct Slab
+    {
+      VertexStorage   vertices;
+      TriangleStorage triangles;
+    };
+
+    /// @return the grid of cube corners.
+    Grid grid() const;
+
+    /// Loads the corners of plane \a z.
+    void loadPlane( const Grid & g, double isovalue, Size z, Plane & plane ) const;
+
+    /// Gives indices to the vertices on the edges starting from plane
+    /// \a z, from \a firstIndex, and computes their positions.
+    ///
+    /// @param next the plane z+1 or 0 if \a z is the last plane.
+    /// @param cache if not 0, stores the vertex index of each edge (3 per corner).
+    /// @param positions if not 0, the vertex positions are appended to it.
+    /// @return the number of vertices of the plane.
+    Size fillPlane( const Grid & g, double isovalue, Size z,
+                    const Plane & plane, const Plane* next, Index firstIndex,
+                    Index* cache, VertexStorage* positions ) const;
+
+    /// Triangulates the cubes of layer \a z, between \a plane and \a next.
+    void processLayer( const Grid & g, double isovalue,
+                       const Plane & plane, const Plane & next,
+                       const Index* cache, const Index* nextCache,
+                       TriangleStorage & triangles ) const;
+
+    /// Processes the cube layers [z0,z1).
+    void processSlab( const Grid & g, double isovalue,
+                      const std::vector<Index> & planeOffsets,
+                      Size z0, Size z1, Slab & slab ) const;
+
+  }; // end of class MarchingCubes
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MarchingCubes'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MarchingCubes' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage>
+  std::ostream&
+  operator<< ( std::ostream & out, const MarchingCubes<TImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/MarchingCubes.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MarchingCubes_h
+
+#undef MarchingCubes_RECURSES
+#endif // else defined(MarchingCubes_RECURSES)
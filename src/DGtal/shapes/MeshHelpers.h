@@ -48,6 +48,7 @@
 #include "DGtal/shapes/TriangulatedSurface.h"
 #include "DGtal/shapes/PolygonalSurface.h"
 #include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/FlatMesh.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -98,6 +99,42 @@ namespace DGtal
       ( const Mesh<Point>& mesh,
         PolygonalSurface<Point>& polysurf );
 
+    /// Builds a triangulated surface (class TriangulatedSurface) from
+    /// a flat mesh (class FlatMesh), whose buffers are moved into the
+    /// triangulated surface: when \a mesh only contains triangles,
+    /// neither the vertices nor the faces are copied. Otherwise,
+    /// polygonal faces are (naively) triangulated as in
+    /// mesh2TriangulatedSurface. The mesh is empty afterwards.
+    ///
+    /// @tparam Point the type for points.
+    /// @param[in,out] mesh the input flat mesh (moved).
+    /// @param[out] trisurf the output triangulated surface mesh.
+    ///
+    /// @return 'true' on success, 'false' if the input \a mesh was
+    /// not a combinatorial surface.
+    template <typename Point>
+      static
+      bool flatMesh2TriangulatedSurface
+      ( FlatMesh<Point>&& mesh,
+        TriangulatedSurface<Point>& trisurf );
+
+    /// Builds a polygon mesh (class PolygonalSurface) from a flat
+    /// mesh (class FlatMesh). The vertex positions are moved into the
+    /// polygonal surface and its faces are built once from the
+    /// compressed rows of \a mesh. The mesh is empty afterwards.
+    ///
+    /// @tparam Point the type for points.
+    /// @param[in,out] mesh the input flat mesh (moved).
+    /// @param[out] polysurf the output polygonal surface mesh.
+    ///
+    /// @return 'true' on success, 'false' if the input \a mesh was
+    /// not a combinatorial surface.
+    template <typename Point>
+      static
+      bool flatMesh2PolygonalSurface
+      ( FlatMesh<Point>&& mesh,
+        PolygonalSurface<Point>& polysurf );
+
     /// Builds a polygonal surface from a triangulated
     /// surface. Polygonal faces are triangulated according to \a
     /// centroid: when 'true', creates a vertex in each non triangular
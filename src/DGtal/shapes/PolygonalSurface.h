@@ -44,6 +44,7 @@
 #include <set>
 #include <map>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/Clone.h"
 #include "DGtal/base/OwningOrAliasingPtr.h"
 #include "DGtal/base/IntegerSequenceIterator.h"
 #include "DGtal/topology/HalfEdgeDataStructure.h"
@@ -250,6 +251,17 @@ namespace DGtal
     /// neighborhoods).
     bool build();
 
+    /// Builds the half-edge data structure from the given vertex
+    /// positions and polygonal faces, which are moved into the surface
+    /// instead of being copied. Previous vertices and faces are
+    /// discarded. After that, the surface is valid.
+    ///
+    /// @param positions the positions of the vertices (moved).
+    /// @param faces the polygonal faces (moved).
+    /// @return true if everything went allright, false if it was not
+    /// possible to build a consistent data structure.
+    bool build( PositionsStorage&& positions, PolygonalFacesStorage&& faces );
+
     /// Adds a new vertex to the surface with data \a vdata.
     /// @param vdata the data associated to this new vertex.
     /// @return the new index given to this vertex.
@@ -236,6 +236,17 @@ namespace DGtal
     /// neighborhoods).
     bool build();
 
+    /// Builds the half-edge data structure from the given vertex
+    /// positions and triangles, which are moved into the surface
+    /// instead of being copied. Previous vertices and faces are
+    /// discarded. After that, the surface is valid.
+    ///
+    /// @param positions the positions of the vertices (moved).
+    /// @param faces the triangles (moved).
+    /// @return true if everything went allright, false if it was not
+    /// possible to build a consistent data structure.
+    bool build( PositionsStorage&& positions, TriangleStorage&& faces );
+
     /// Adds a new vertex to the surface with data \a vdata.
     /// @param vdata the data associated to this new vertex.
     /// @return the new index given to this vertex.
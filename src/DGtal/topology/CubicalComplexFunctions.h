@@ -41,6 +41,9 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 #include "DGtal/base/Common.h"
 #include "DGtal/topology/CubicalComplex.h"
 #include <DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h>
@@ -398,6 +401,50 @@ namespace DGtal
                        bool hintIsSClosed = false, bool hintIsKClosed = false,
                        bool verbose = false );
 
+    /**
+     * Collapse a user-specified part of complex \a K like
+     * collapse, but on an indexed copy of the neighborhoods of the
+     * collapsible cells. The direct faces and co-faces of each cell
+     * are computed once and in parallel (OpenMP), as well as the
+     * maximal cells having a free face. These cells are stored in an
+     * indexed heap ordered by [priority]; after each collapse only the
+     * faces of the removed pair are updated, and the maximal cells
+     * that got a free face are (re)inserted in the heap. Removed cells
+     * are erased from \a K at the end.
+     *
+     * The sequence of collapses may differ from the one of collapse,
+     * since only maximal cells are popped from the heap, but the
+     * result keeps the same homotopy type and does not depend on the
+     * number of threads.
+     *
+     * @note Cells whose data has been marked as FIXED are not removed.
+     *
+     * @tparam TKSpace the digital space in which lives the cubical complex.
+     * @tparam TCellContainer the associative container used to store cells within the cubical complex.
+     * @tparam CellConstIterator any forward const iterator on Cell.
+     * @tparam CellMapIteratorPriority same as for collapse.
+     *
+     * @param[in,out] K the complex that is collapsed.
+     * @param S_itB the start of a range of cells which is included in [K].
+     * @param S_itE the end of a range of cells which is included in [K].
+     * @param priority the object that assign a priority to each cell.
+     * @param hintIsSClosed indicates if [\a S_itb,\a S_ite) is a closed set (faster in this case).
+     * @param hintIsKClosed indicates that complex \a K is closed.
+     * @param nbThreads the number of threads of the initial pass (0
+     * for the OpenMP default), ignored without OpenMP.
+     * @param verbose outputs some information during processing,
+     * including the number of collapsed cells per second, when 'true'.
+     * @return the number of cells removed from complex \a K.
+     */
+    template <typename TKSpace, typename TCellContainer,
+              typename CellConstIterator,
+              typename CellMapIteratorPriority >
+    uint64_t indexedCollapse( CubicalComplex< TKSpace, TCellContainer > & K,
+                              CellConstIterator S_itB, CellConstIterator S_itE,
+                              const CellMapIteratorPriority& priority,
+                              bool hintIsSClosed = false, bool hintIsKClosed = false,
+                              int nbThreads = 0, bool verbose = false );
+
     /**
      * Computes the cells of the given complex \a K that lies on the
      * boundary or inside the parallelepiped specified by bounds \a
@@ -0,0 +1,473 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DenseCellMap.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DenseCellMap.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DenseCellMap_RECURSES)
+#error Recursive header files inclusion detected in DenseCellMap.h
+#else // defined(DenseCellMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DenseCellMap_RECURSES
+
+#if !defined DenseCellMap_h
+/** Prevents repeated inclusion of headers. */
+#define DenseCellMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ContainerTraits.h"
+#include "DGtal/topology/CubicalComplex.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseCellMap
+  /**
+     Description of template class 'DenseCellMap' <p>
+     \brief Aim: Represents a map cell -> data as dense arrays over a
+     box of the Khalimsky space, to be used as the cell container of a
+     CubicalComplex or a VoxelComplex.
+
+     The cells are grouped by type (the parity of their Khalimsky
+     coordinates). For each type present in the map, there is one
+     data per cell of the box and one bit telling if the cell is in
+     the map. A std::map spends about 64 bytes per cell, while this
+     container spends sizeof(Data) bytes and a bit per cell of the box,
+     i.e. about 4 bytes per cell for the closure of a full volume.
+     Since a CubicalComplex stores one container per dimension, each
+     container only allocates the types of this dimension.
+
+     The box grows when a cell outside of it is inserted (by at least
+     half its size along the growing axes), which invalidates the
+     iterators. It may be set beforehand with reserve(). Erasing or
+     inserting cells inside the box keeps the iterators valid.
+
+     Iterators visit the cells type by type, and each type in
+     increasing order of its index in the box. They are proxy
+     iterators: their reference is a pair (const Cell&, Data&) whose
+     cell is stored in the iterator.
+
+     Model of boost::ForwardContainer and
+     concepts::CSTLAssociativeContainer, with the unordered map
+     category of ContainerTraits.
+
+     @code
+     typedef CubicalComplex< Z3i::KSpace, DenseCellMap< Z3i::KSpace > > DenseComplex;
+     DenseComplex complex( K );
+     complex.construct( set );
+     @endcode
+
+     @tparam TKSpace the type of Khalimsky space (a KhalimskySpaceND,
+     default constructible with a default space containing every cell).
+     @tparam TData the type of data (default constructible and copy constructible).
+
+     @see testDenseCellMap.cpp
+  */
+  template <typename TKSpace, typename TData = CubicalCellData>
+  class DenseCellMap
+  {
+  public:
+    // ----------------------- Public types ------------------------------
+    typedef DenseCellMap<TKSpace, TData>       Self;
+    typedef TKSpace                            KSpace;
+    typedef typename KSpace::Cell              Cell;
+    typedef typename KSpace::Point             Point;
+    typedef typename KSpace::Integer           Integer;
+    typedef Cell                               Key;
+    typedef TData                              Data;
+    typedef std::pair<const Cell, Data>        Value;
+    typedef std::pair<const Cell&, Data&>      Reference;
+    typedef std::pair<const Cell&, const Data&> ConstReference;
+    typedef std::ptrdiff_t                     DifferenceType;
+    typedef std::size_t                        SizeType;
+    typedef DGtal::uint64_t                    Word;
+
+    /// The dimension of the space.
+    static const Dimension dimension = KSpace::dimension;
+    /// The number of cell types.
+    static const unsigned int nbTypes = 1u << dimension;
+
+    /// Pointer-like object returned by the operator-> of iterators.
+    template <typename TReference>
+    struct ArrowProxy
+    {
+      TReference myReference;
+      TReference * operator->() { return &myReference; }
+    };
+
+    /**
+     * Forward iterator on the pairs of the map.
+     * @tparam TMap Self or const Self.
+     * @tparam TReference Reference or ConstReference.
+     */
+    template <typename TMap, typename TReference>
+    class IteratorT
+      : public std::iterator<std::forward_iterator_tag, Value, DifferenceType,
+                             ArrowProxy<TReference>, TReference>
+    {
+      friend class DenseCellMap<TKSpace, TData>;
+      template <typename TOtherMap, typename TOtherReference> friend class IteratorT;
+    public:
+      IteratorT() : myMap( 0 ), myType( nbTypes ), myIndex( 0 ) {}
+
+      /// Conversion from a mutable iterator (a template, so that the
+      /// implicit copy constructor and assignment are kept).
+      template <typename TOtherReference>
+      IteratorT( const IteratorT<Self, TOtherReference> & other )
+        : myMap( other.myMap ), myType( other.myType ),
+          myIndex( other.myIndex ), myCell( other.myCell ) {}
+
+      TReference operator*() const
+      {
+        return TReference( myCell, myMap->myData[ myType ][ myIndex ] );
+      }
+      ArrowProxy<TReference> operator->() const
+      {
+        ArrowProxy<TReference> proxy = { **this };
+        return proxy;
+      }
+      IteratorT & operator++()
+      {
+        ++myIndex;
+        skipFreeCells();
+        return *this;
+      }
+      IteratorT operator++( int )
+      {
+        IteratorT tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+      template <typename TOtherMap, typename TOtherReference>
+      bool operator==( const IteratorT<TOtherMap, TOtherReference> & other ) const
+      {
+        return myType == other.myType && myIndex == other.myIndex;
+      }
+      template <typename TOtherMap, typename TOtherReference>
+      bool operator!=( const IteratorT<TOtherMap, TOtherReference> & other ) const
+      {
+        return ! ( *this == other );
+      }
+
+    private:
+      /// Iterator on the cell of index \a anIndex of type \a aType (which is in the map).
+      IteratorT( TMap * aMap, unsigned int aType, SizeType anIndex, const Cell & aCell )
+        : myMap( aMap ), myType( aType ), myIndex( anIndex ), myCell( aCell ) {}
+
+      /// Iterator on the first cell from index \a anIndex of type \a aType.
+      IteratorT( TMap * aMap, unsigned int aType, SizeType anIndex )
+        : myMap( aMap ), myType( aType ), myIndex( anIndex )
+      {
+        skipFreeCells();
+      }
+
+      void skipFreeCells()
+      {
+        for ( ; myType < nbTypes; ++myType, myIndex = 0 )
+          {
+            const std::vector<Word> & bits = myMap->myBits[ myType ];
+            SizeType w = myIndex / 64;
+            if ( w >= bits.size() ) continue;
+            Word word = bits[ w ] & ( ~Word( 0 ) << ( myIndex % 64 ) );
+            while ( word == 0 && ++w < bits.size() ) word = bits[ w ];
+            if ( word == 0 ) continue;
+            myIndex = 64 * w;
+            for ( ; ( word & 1 ) == 0; word >>= 1 ) ++myIndex;
+            myCell = myMap->cell( myType, myIndex );
+            return;
+          }
+        myIndex = 0;
+      }
+
+      /// The map.
+      TMap * myMap;
+      /// The type of the current cell.
+      unsigned int myType;
+      /// The index of the current cell in the box.
+      SizeType myIndex;
+      /// The current cell.
+      Cell myCell;
+    };
+
+    typedef IteratorT<Self, Reference>            Iterator;
+    typedef IteratorT<const Self, ConstReference> ConstIterator;
+
+    // ----------------------- Standard types ------------------------------
+    typedef Key                           key_type;
+    typedef Value                         value_type;
+    typedef Data                          data_type;
+    typedef Data                          mapped_type;
+    typedef DifferenceType                difference_type;
+    typedef Reference                     reference;
+    typedef ArrowProxy<Reference>         pointer;
+    typedef ConstReference                const_reference;
+    typedef ArrowProxy<ConstReference>    const_pointer;
+    typedef SizeType                      size_type;
+    typedef Iterator                      iterator;
+    typedef ConstIterator                 const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The map is empty, with an empty box.
+     */
+    DenseCellMap();
+
+    /**
+     * Extends the box so that it contains the cells between \a
+     * lower and \a upper (e.g. the lowerCell() and upperCell() of the
+     * Khalimsky space), which avoids growing it afterwards.
+     * Invalidates the iterators.
+     *
+     * @param lower any cell.
+     * @param upper any cell (with greater coordinates than \a lower).
+     */
+    void reserve( const Cell & lower, const Cell & upper );
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /// @return the number of elements.
+    SizeType size() const { return mySize; }
+
+    /// @return 'true' if the map is empty.
+    bool empty() const { return mySize == 0; }
+
+    /// @return the maximal number of elements.
+    SizeType max_size() const { return std::numeric_limits<SizeType>::max(); }
+
+    /// @return the number of cells of the box (per type).
+    SizeType boxSize() const { return myBoxSize; }
+
+    /// @return the number of bytes used by the map.
+    SizeType memoryUsage() const;
+
+    /**
+     * Swaps the content of this map with \a other.
+     * @param other any other map.
+     */
+    void swap( Self & other );
+
+    /// Removes all the elements, keeping the box.
+    void clear();
+
+    /// @return an iterator on the first element.
+    ConstIterator begin() const { return ConstIterator( this, 0, 0 ); }
+    /// @return an iterator after the last element.
+    ConstIterator end() const { return ConstIterator(); }
+    /// @return an iterator on the first element.
+    Iterator begin() { return Iterator( this, 0, 0 ); }
+    /// @return an iterator after the last element.
+    Iterator end() { return Iterator(); }
+
+    /**
+     * @param key any cell.
+     * @return an iterator on the element of key \a key, or end().
+     */
+    ConstIterator find( const Key & key ) const;
+
+    /**
+     * @param key any cell.
+     * @return an iterator on the element of key \a key, or end().
+     */
+    Iterator find( const Key & key );
+
+    /**
+     * @param key any cell.
+     * @return the number of elements of key \a key (0 or 1).
+     */
+    SizeType count( const Key & key ) const;
+
+    /**
+     * @param key any cell.
+     * @return the range of the elements of key \a key (at most one).
+     */
+    std::pair<ConstIterator, ConstIterator> equal_range( const Key & key ) const;
+
+    /**
+     * @param key any cell.
+     * @return the range of the elements of key \a key (at most one).
+     */
+    std::pair<Iterator, Iterator> equal_range( const Key & key );
+
+    /**
+     * Inserts a value if its cell is not already in the map.
+     * @param aValue a pair (cell, data).
+     * @return an iterator on the element of this cell and 'true' if
+     * the value was inserted.
+     */
+    std::pair<Iterator, bool> insert( const Value & aValue );
+
+    /**
+     * Inserts a value if its cell is not already in the map.
+     * @param aHint an iterator, ignored.
+     * @param aValue a pair (cell, data).
+     * @return an iterator on the element of this cell.
+     */
+    Iterator insert( Iterator aHint, const Value & aValue );
+
+    /**
+     * Inserts a range of values.
+     * @param itb an iterator on the first value.
+     * @param ite an iterator after the last value.
+     */
+    template <typename InputIterator>
+    void insert( InputIterator itb, InputIterator ite );
+
+    /**
+     * @param key any cell.
+     * @return a reference on the data of cell \a key, inserted with a
+     * default data if needed.
+     */
+    Data & operator[]( const Key & key );
+
+    /**
+     * Erases the element of a given cell.
+     * @param key any cell.
+     * @return the number of erased elements (0 or 1).
+     */
+    SizeType erase( const Key & key );
+
+    /**
+     * Erases an element. Other iterators stay valid.
+     * @param position an iterator on an element.
+     */
+    void erase( Iterator position );
+
+    /**
+     * Erases a range of elements.
+     * @param first an iterator on the first element to erase.
+     * @param last an iterator after the last element to erase.
+     */
+    void erase( Iterator first, Iterator last );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object (the number of
+     * bits set is the size).
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the default Khalimsky space, used to convert cells and coordinates.
+    static const KSpace & space();
+
+    /// Computes the type of a cell and the coordinates of its spel
+    /// (Khalimsky coordinates divided by two).
+    static unsigned int typeAndCoordinates( const Cell & c, Point & u );
+
+    /// @return 'true' if \a u is in the box.
+    bool isInBox( const Point & u ) const;
+
+    /// @return the index of \a u (which is in the box).
+    SizeType index( const Point & u ) const;
+
+    /// @return the cell of index \a anIndex and of type \a aType.
+    Cell cell( unsigned int aType, SizeType anIndex ) const;
+
+    /// @return 'true' if the cell of index \a anIndex and type \a aType is in the map.
+    bool isSet( unsigned int aType, SizeType anIndex ) const
+    {
+      return ( myBits[ aType ][ anIndex / 64 ] >> ( anIndex % 64 ) ) & 1;
+    }
+
+    /// Grows the box so that it contains [lower,upper] (spel coordinates).
+    void growBox( const Point & lower, const Point & upper );
+
+    /// Allocates the arrays of a type.
+    void allocate( unsigned int aType );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The spel coordinates of the lowest cells of the box.
+    Point myLower;
+    /// The number of spels of the box along each axis.
+    Point myExtent;
+    /// The number of cells of the box (per type).
+    SizeType myBoxSize;
+    /// The number of elements.
+    SizeType mySize;
+    /// The data of the cells of each type (empty if the type is not used).
+    std::vector<Data> myData[ nbTypes ];
+    /// The bits telling which cells of each type are in the map.
+    std::vector<Word> myBits[ nbTypes ];
+
+  }; // end of class DenseCellMap
+
+  /// Defines container traits for DenseCellMap.
+  template <typename TKSpace, typename TData>
+  struct ContainerTraits< DenseCellMap<TKSpace, TData> >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DenseCellMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DenseCellMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TData>
+  std::ostream&
+  operator<< ( std::ostream & out, const DenseCellMap<TKSpace, TData> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/DenseCellMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DenseCellMap_h
+
+#undef DenseCellMap_RECURSES
+#endif // else defined(DenseCellMap_RECURSES)
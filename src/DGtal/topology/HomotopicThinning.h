@@ -0,0 +1,130 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HomotopicThinning.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Greedy homotopic thinning of digital objects and of dense binary
+ * images, based on simple points.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HomotopicThinning_RECURSES)
+#error Recursive header files inclusion detected in HomotopicThinning.h
+#else // defined(HomotopicThinning_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HomotopicThinning_RECURSES
+
+#if !defined HomotopicThinning_h
+/** Prevents repeated inclusion of headers. */
+#define HomotopicThinning_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "boost/dynamic_bitset.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/NeighborhoodConfigurations.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace functions {
+
+    /**
+     * Greedy homotopic thinning of an object: simple points are
+     * removed layer by layer, as long as there are some. A layer is
+     * the set of the points that are simple at the beginning of the
+     * pass; each of them is removed if it is still simple when it is
+     * visited. Only the points close to removed points are tested
+     * again at the next pass.
+     *
+     * The object uses its own isSimple, so a table set with
+     * Object::setTable or Object::loadSimplicityTable makes each test a
+     * table lookup.
+     *
+     * @tparam TObject the type of Object.
+     * @tparam TPointPredicate the type of a predicate on points.
+     * @param[in,out] object the object to thin.
+     * @param isFixed the predicate telling the points that must not be
+     * removed (e.g. end points or medial axis points).
+     *
+     * @return the number of removed points.
+     */
+    template < typename TObject, typename TPointPredicate >
+    typename TObject::Size
+    homotopicThinning( TObject & object, const TPointPredicate & isFixed );
+
+    /**
+     * Greedy homotopic thinning of an object, where any point may be
+     * removed: the result is an ultimate homotopic skeleton.
+     *
+     * @tparam TObject the type of Object.
+     * @param[in,out] object the object to thin.
+     * @return the number of removed points.
+     */
+    template < typename TObject >
+    typename TObject::Size
+    homotopicThinning( TObject & object );
+
+    /**
+     * Greedy homotopic thinning of a dense binary image (non-zero
+     * values are the foreground, points outside the domain are in the
+     * background), with the same passes as homotopicThinning. Points
+     * are tested with a simplicity table and
+     * getNeighborhoodConfiguration, and removed by setting their value
+     * to zero.
+     *
+     * @tparam TImage the type of image (see concept CImage).
+     * @tparam TPointPredicate the type of a predicate on points.
+     * @param[in,out] image the image to thin.
+     * @param table the simplicity table of the chosen topology (@see
+     * loadSimplicityTable).
+     * @param isFixed the predicate telling the points that must not be
+     * removed.
+     *
+     * @return the number of removed points.
+     */
+    template < typename TImage, typename TPointPredicate >
+    std::size_t
+    homotopicThinningOfImage( TImage & image,
+                              const boost::dynamic_bitset<> & table,
+                              const TPointPredicate & isFixed );
+
+  } // namespace functions
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/HomotopicThinning.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HomotopicThinning_h
+
+#undef HomotopicThinning_RECURSES
+#endif // else defined(HomotopicThinning_RECURSES)
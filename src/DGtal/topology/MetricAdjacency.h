@@ -40,6 +40,8 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <array>
+#include <cstddef>
 #include <iostream>
 #include <set>
 #include <map>
@@ -52,6 +54,77 @@
 namespace DGtal
 {
 
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MetricAdjacencyOffsets
+  /**
+   * Description of template class 'MetricAdjacencyOffsets' <p> \brief
+   * Aim: Precomputed offsets of the proper neighbors of a point for
+   * the metric adjacency of given maximal 1-norm. Base class of all
+   * the MetricAdjacency classes.
+   *
+   * The number of neighbors is a compile-time constant and the
+   * offsets are computed once, in the order of a HyperRectDomain
+   * scan of the cube \f$ \{-1,0,1\}^d \f$ (first coordinate
+   * first). For dense images stored row-major (first coordinate
+   * first, as ImageContainerBySTLVector), linearOffsets gives the
+   * index offsets of the neighbors, so that neighborhood loops need
+   * neither points nor allocation:
+   *
+   * @code
+   * typedef MetricAdjacency<Z3i::Space, 1> Adj6;
+   * const Adj6::LinearOffsets offsets = Adj6::linearOffsets( image.extent() );
+   * for ( std::ptrdiff_t o : offsets ) sum += data[ index + o ];
+   * @endcode
+   *
+   * @tparam TSpace any digital space (see concept CSpace).
+   * @tparam maxNorm1 the maximal 1-norm of a neighbor offset.
+   * @tparam dimension the dimension of the space.
+   */
+  template <typename TSpace, Dimension maxNorm1,
+            Dimension dimension = TSpace::dimension >
+  struct MetricAdjacencyOffsets
+  {
+    typedef typename TSpace::Vector Vector;
+    typedef typename TSpace::Size Size;
+
+    /// @return the binomial coefficient C(n,k).
+    static constexpr Size binomial( Dimension n, Dimension k )
+    {
+      return ( k > n ) ? 0 : ( ( k == 0 ) ? 1 : binomial( n - 1, k - 1 ) * n / k );
+    }
+
+    /// @return the number of offsets of 1-norm between 1 and k.
+    static constexpr Size nbOffsets( Dimension k )
+    {
+      return ( k == 0 ) ? 0 : nbOffsets( k - 1 ) + binomial( dimension, k ) * ( Size( 1 ) << k );
+    }
+
+    /// The number of proper neighbors of a point.
+    static constexpr Size nbNeighbors = nbOffsets( maxNorm1 );
+
+    /// The offsets of the proper neighbors.
+    typedef std::array<Vector, nbNeighbors> Offsets;
+    /// The offsets of the proper neighbors in a linearized dense image.
+    typedef std::array<std::ptrdiff_t, nbNeighbors> LinearOffsets;
+
+    /**
+     * @return the offsets of the proper neighbors of any point,
+     * computed at the first call.
+     */
+    static const Offsets & offsets();
+
+    /**
+     * @param extent the extent of a dense image stored row-major
+     * (first coordinate first).
+     * @return the index offsets of the proper neighbors of an
+     * interior point, in the order of offsets().
+     */
+    static LinearOffsets linearOffsets( const Vector & extent );
+
+  private:
+    static Offsets computeOffsets();
+  }; // end of struct MetricAdjacencyOffsets
+
   /////////////////////////////////////////////////////////////////////////////
   // template class MetricAdjacency
   /**
@@ -65,6 +138,12 @@ namespace DGtal
    *
    * \b Model of concepts::CAdjacency.
    *
+   * The offsets of the neighbors are precomputed (see
+   * MetricAdjacencyOffsets, from which all metric adjacencies
+   * derive): writeNeighbors does not scan a local domain, and
+   * offsets() or linearOffsets() give allocation-free loops over
+   * neighborhoods.
+   *
    * @tparam TSpace any digital space (see concept CSpace).
    *
    * @tparam maxNorm1 defines which points are adjacent. More
@@ -77,6 +156,7 @@ namespace DGtal
   template <typename TSpace, Dimension maxNorm1, 
 	    Dimension dimension = TSpace::dimension >
   class MetricAdjacency
+    : public MetricAdjacencyOffsets<TSpace, maxNorm1, dimension>
   {
     BOOST_CONCEPT_ASSERT(( concepts::CSpace<TSpace> ));
     // ----------------------- public types ------------------------------
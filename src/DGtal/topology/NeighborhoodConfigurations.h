@@ -41,12 +41,89 @@
 // Inclusions
 #include <iostream>
 #include <bitset>
+#include <string>
 #include <unordered_map>
 #include "boost/dynamic_bitset.hpp"
 #include <DGtal/base/CountedPtr.h>
+#include <DGtal/topology/MetricAdjacency.h>
 #include <DGtal/topology/helpers/NeighborhoodConfigurationsHelper.h>
+#include <DGtal/topology/tables/NeighborhoodTables.h>
 
 namespace DGtal {
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template struct SimplicityTableTraits
+  /**
+   * Description of template struct 'SimplicityTableTraits' <p>
+   * \brief Aim: gives the precomputed simplicity table of the digital
+   * topology (TForegroundAdjacency, TBackgroundAdjacency), if any.
+   *
+   * Tables are distributed for the metric adjacencies of the
+   * topologies (4,8) and (8,4) in 2D, and (6,18), (18,6), (6,26) and
+   * (26,6) in 3D.
+   *
+   * @tparam TForegroundAdjacency the adjacency of the object.
+   * @tparam TBackgroundAdjacency the adjacency of its complement.
+   */
+  template <typename TForegroundAdjacency, typename TBackgroundAdjacency>
+  struct SimplicityTableTraits
+  {
+    /// 'true' iff a table is distributed for this topology.
+    static const bool available = false;
+    /// the dimension of the table (2 or 3), 0 if there is none.
+    static const unsigned int dimension = 0;
+    /// @return the file name of the table, or an empty string.
+    static std::string fileName() { return std::string(); }
+  };
+
+  template <typename TSpace>
+  struct SimplicityTableTraits< MetricAdjacency<TSpace, 1, 2>, MetricAdjacency<TSpace, 2, 2> >
+  {
+    static const bool available = true;
+    static const unsigned int dimension = 2;
+    static std::string fileName() { return simplicity::tableSimple4_8; }
+  };
+
+  template <typename TSpace>
+  struct SimplicityTableTraits< MetricAdjacency<TSpace, 2, 2>, MetricAdjacency<TSpace, 1, 2> >
+  {
+    static const bool available = true;
+    static const unsigned int dimension = 2;
+    static std::string fileName() { return simplicity::tableSimple8_4; }
+  };
+
+  template <typename TSpace>
+  struct SimplicityTableTraits< MetricAdjacency<TSpace, 1, 3>, MetricAdjacency<TSpace, 2, 3> >
+  {
+    static const bool available = true;
+    static const unsigned int dimension = 3;
+    static std::string fileName() { return simplicity::tableSimple6_18; }
+  };
+
+  template <typename TSpace>
+  struct SimplicityTableTraits< MetricAdjacency<TSpace, 2, 3>, MetricAdjacency<TSpace, 1, 3> >
+  {
+    static const bool available = true;
+    static const unsigned int dimension = 3;
+    static std::string fileName() { return simplicity::tableSimple18_6; }
+  };
+
+  template <typename TSpace>
+  struct SimplicityTableTraits< MetricAdjacency<TSpace, 1, 3>, MetricAdjacency<TSpace, 3, 3> >
+  {
+    static const bool available = true;
+    static const unsigned int dimension = 3;
+    static std::string fileName() { return simplicity::tableSimple6_26; }
+  };
+
+  template <typename TSpace>
+  struct SimplicityTableTraits< MetricAdjacency<TSpace, 3, 3>, MetricAdjacency<TSpace, 1, 3> >
+  {
+    static const bool available = true;
+    static const unsigned int dimension = 3;
+    static std::string fileName() { return simplicity::tableSimple26_6; }
+  };
+
   namespace functions {
   /**
    * Load existing look up table existing in file_name, precalculated
@@ -114,6 +191,49 @@ namespace DGtal {
   std::unordered_map<TPoint, NeighborhoodConfiguration > >
   mapZeroPointNeighborhoodToConfigurationMask();
 
+  /**
+   * Occupancy configuration of the neighborhood of a point, with the
+   * bit order of mapZeroPointNeighborhoodToConfigurationMask. The
+   * neighbors are scanned in this order with precomputed offsets, so
+   * that no map is needed.
+   *
+   * Any point predicate may describe the shape, e.g. a digital set or
+   * a dense binary image:
+   * @code
+   * auto inImage = [&image] ( const Point & q )
+   *   { return image.domain().isInside( q ) && image( q ); };
+   * const bool simple = (*table)[ functions::getNeighborhoodConfiguration( inImage, p ) ];
+   * @endcode
+   *
+   * @tparam TPointPredicate the type of a predicate on points.
+   * @tparam TPoint the type of point, of dimension 2 or 3.
+   * @param pred the predicate telling if a point belongs to the shape.
+   * @param center the center of the neighborhood (it doesn't matter if
+   * it belongs to the shape).
+   *
+   * @return bit configuration of neighborhood
+   */
+  template<typename TPointPredicate, typename TPoint>
+  inline
+  NeighborhoodConfiguration
+  getNeighborhoodConfiguration( const TPointPredicate & pred, const TPoint & center );
+
+  /**
+   * Loads the precomputed simplicity table of a digital topology (see
+   * SimplicityTableTraits). The table is read only once for the whole
+   * program and then shared.
+   *
+   * @tparam TForegroundAdjacency the adjacency of the object.
+   * @tparam TBackgroundAdjacency the adjacency of its complement.
+   *
+   * @return smart ptr to the table, or an invalid one if no table is
+   * distributed for this topology.
+   */
+  template<typename TForegroundAdjacency, typename TBackgroundAdjacency>
+  inline
+  DGtal::CountedPtr< boost::dynamic_bitset<> >
+  loadSimplicityTable();
+
   } // namespace functions
 } // namespace DGtal
 
@@ -44,9 +44,11 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <map>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CowPtr.h"
 #include "DGtal/base/CountedPtr.h"
@@ -56,6 +58,7 @@
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/topology/Topology.h"
+#include "DGtal/topology/MetricAdjacency.h"
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/properties.hpp>
 #include <boost/dynamic_bitset.hpp>
@@ -281,6 +284,26 @@ namespace DGtal
      */
     void setTable(Alias<boost::dynamic_bitset<> >inputTable);
 
+    /**
+     * Sets the distributed simplicity table of the topology of this
+     * object, if any (see SimplicityTableTraits): isSimple is then a
+     * table lookup. The table is read once for the whole program.
+     *
+     * @return 'true' if a table exists for this topology, 'false'
+     * otherwise (isSimple is then unchanged).
+     */
+    bool loadSimplicityTable();
+
+    /**
+     * Get the occupancy configuration of the neighborhood of a point,
+     * without map lookups.
+     * @param center point of the neighborhood. It doesn't matter if center belongs or not to the object.
+     *
+     * @return bit configuration of neighborhood
+     * @see functions::getNeighborhoodConfiguration
+     */
+    NeighborhoodConfiguration getNeighborhoodConfigurationOccupancy( const Point & center ) const;
+
     /**
      * Get the occupancy configuration of the neighborhood of a point. The neighborhood only depends on the dimension, not the topology of the object (3x3 cube for 3D point, 2x2 square for 2D).
      * @param center point of the neighborhood. It doesn't matter if center belongs or not to \b input_object.
@@ -601,6 +624,11 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
      * careful, such a definition is valid only for Jordan couples in
      * dimension 2 and 3.
      *
+     * When both adjacencies are metric adjacencies (e.g. Z3i::DT6_26)
+     * in dimension 2 or 3, the geodesic neighborhoods are computed as
+     * bit masks of the cube around v: the test then only looks up the
+     * neighbors of v in the point set and allocates nothing.
+     *
      * @return 'true' if this point is simple.
      */
     bool isSimple( const Point & v ) const;
@@ -674,6 +702,79 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
      */
     bool myTableIsLoaded;
 
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// A subset of the cube \f$ \{-1,0,1\}^d \f$, for d <= 3.
+    typedef std::uint32_t CubeMask;
+
+    /**
+     * @return the offsets of the cells of the cube \f$
+     * \{-1,0,1\}^d \f$ in the order of a HyperRectDomain scan (the
+     * center is the middle cell).
+     */
+    static const std::vector<Point> & cubeOffsets();
+
+    /**
+     * @tparam norm1 the maximal 1-norm of a metric adjacency.
+     * @return for each cell of the cube, the mask of its proper
+     * neighbors within the cube for this adjacency.
+     */
+    template <Dimension norm1>
+    static const std::vector<CubeMask> & cubeAdjacencyMasks();
+
+    /**
+     * @param masks the adjacency masks of the cube cells.
+     * @param Y a subset of the cube, without its center.
+     * @param k the order of the geodesic neighborhood.
+     * @return the cells of Y at distance at most k within Y from the
+     * neighbors of the center.
+     */
+    static CubeMask cubeGeodesicNeighborhood( const std::vector<CubeMask> & masks,
+                                              CubeMask Y, unsigned int k );
+
+    /**
+     * @param masks the adjacency masks of the cube cells.
+     * @param G a non-empty subset of the cube.
+     * @return 'true' iff G is connected for this adjacency.
+     */
+    static bool isConnectedInCube( const std::vector<CubeMask> & masks, CubeMask G );
+
+    /**
+     * Simple point test of isSimple with bit masks, for metric
+     * adjacencies.
+     *
+     * @param kappa the foreground adjacency.
+     * @param lambda the background adjacency.
+     * @param v any point.
+     * @param kappaOrder the order of the geodesic neighborhood in the object.
+     * @param lambdaOrder the order of the geodesic neighborhood in the complement.
+     * @param[out] done 'false' if the test does not apply (dimension
+     * greater than 3), 'true' otherwise.
+     * @return 'true' if this point is simple.
+     */
+    template <Dimension kappaNorm1, Dimension lambdaNorm1>
+    bool isSimpleInCube( const MetricAdjacency<Space, kappaNorm1, Space::dimension> & kappa,
+                         const MetricAdjacency<Space, lambdaNorm1, Space::dimension> & lambda,
+                         const Point & v, unsigned int kappaOrder,
+                         unsigned int lambdaOrder, bool & done ) const;
+
+    /**
+     * Other adjacencies: the test does not apply.
+     *
+     * @param kappa the foreground adjacency.
+     * @param lambda the background adjacency.
+     * @param v any point.
+     * @param kappaOrder the order of the geodesic neighborhood in the object.
+     * @param lambdaOrder the order of the geodesic neighborhood in the complement.
+     * @param[out] done always 'false'.
+     * @return 'false'.
+     */
+    template <typename TKappa, typename TLambda>
+    bool isSimpleInCube( const TKappa & kappa, const TLambda & lambda,
+                         const Point & v, unsigned int kappaOrder,
+                         unsigned int lambdaOrder, bool & done ) const;
+
     // --------------- CDrawableWithBoard2D realization ------------------
   public:
     /**
@@ -45,6 +45,12 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <array>
+#include <cstddef>
+#include <vector>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
@@ -71,6 +77,16 @@ namespace DGtal
  * lower than the complex.
  * Paper: Chaussard, J. and Couprie, M., Surface Thinning in 3D Cubical Complexes,
  * Combinatorial Image Analysis, (2009)
+ *
+ * Each approach also exists in a multi-threaded version
+ * (evalParallel(), collapseSurfaceParallel() and
+ * collapseIsthmusParallel()), which works on a dense copy of the
+ * complex: one byte of flags per cell of the bounding box of the
+ * Khalimsky space. The free pairs of a directional sub-iteration are
+ * independent, hence they are detected in parallel (with OpenMP),
+ * then removed all together. Only the cells of the boundary of the
+ * complex are visited, and the result does not depend on the number
+ * of threads. The Khalimsky space must not be periodic.
  * @tparam CC cubical complex.
  */
 template < typename CC >
@@ -139,6 +155,32 @@ public:
      */
     void collapseIsthmus();
 
+    /**
+     * Multi-threaded version of eval(), working on a dense copy of
+     * the complex. The complex is updated at the end, and is the one
+     * eval() gives.
+     * @param iterations -- number of iterations
+     * @param nbThreads -- number of threads (0: all available).
+     * @return total number of removed cells.
+     */
+    unsigned int evalParallel ( unsigned int iterations, int nbThreads = 0 );
+
+    /**
+     * Multi-threaded version of collapseSurface(), working on a dense
+     * copy of the complex. The complex is updated at the end.
+     * @param nbThreads -- number of threads (0: all available).
+     * @return total number of removed cells.
+     */
+    unsigned int collapseSurfaceParallel ( int nbThreads = 0 );
+
+    /**
+     * Multi-threaded version of collapseIsthmus(), working on a dense
+     * copy of the complex. The complex is updated at the end.
+     * @param nbThreads -- number of threads (0: all available).
+     * @return total number of removed cells.
+     */
+    unsigned int collapseIsthmusParallel ( int nbThreads = 0 );
+
     // ------------------------- Internals ------------------------------------
 private:
     /**
@@ -181,6 +223,190 @@ private:
      */
     bool isIsthmus ( CellMapConstIterator F );
 
+    /// Flags of the cells of a DenseComplex.
+    enum DenseFlag { DENSE_IN = 1, DENSE_FIXED = 2, DENSE_LISTED = 4 };
+
+    /**
+     * Dense copy of a complex: one byte of flags per cell of the
+     * bounding box of the Khalimsky space, and, per dimension, the
+     * cells of the complex which may miss some upper incident cells
+     * (i.e. its boundary cells).
+     */
+    struct DenseComplex
+    {
+      /// Khalimsky coordinates of the first cell of the box.
+      Point lower;
+      /// Khalimsky coordinates of the last cell of the box.
+      Point upper;
+      /// Offset between consecutive cells along each axis.
+      std::array<std::ptrdiff_t, KSpace::dimension> strides;
+      /// Flags of each cell, see DenseFlag.
+      std::vector<unsigned char> flags;
+      /// Indices of the boundary cells of each dimension.
+      std::vector< std::vector<std::size_t> > boundary;
+
+      /// @return the index of the cell of Khalimsky coordinates \a k.
+      std::size_t index ( const Point& k ) const
+      {
+        std::ptrdiff_t idx = 0;
+        for ( Dimension i = 0; i < KSpace::dimension; i++ )
+          idx += ( k[i] - lower[i] ) * strides[i];
+        return idx;
+      }
+
+      /// @return the Khalimsky coordinates of the cell of index \a idx.
+      Point point ( std::size_t idx ) const
+      {
+        Point k;
+        for ( Dimension i = KSpace::dimension; i-- > 0; )
+        {
+          k[i] = lower[i] + idx / strides[i];
+          idx %= strides[i];
+        }
+        return k;
+      }
+
+      /// @return 'true' iff the cell of Khalimsky coordinates \a k is in the box.
+      bool inBox ( const Point& k ) const
+      {
+        for ( Dimension i = 0; i < KSpace::dimension; i++ )
+          if ( k[i] < lower[i] || k[i] > upper[i] ) return false;
+        return true;
+      }
+
+      /// @return 'true' iff the cell of Khalimsky coordinates \a k is in the complex.
+      bool has ( const Point& k ) const
+      {
+        return inBox ( k ) && ( flags[ index ( k ) ] & DENSE_IN );
+      }
+
+      /**
+       * Calls \a f( index, dimension ) on the proper cofaces (if \a up)
+       * or on the proper faces of \a k which are in the box, until it
+       * returns 'false'.
+       * @return 'false' iff \a f returned 'false'.
+       */
+      template <typename Functor>
+      bool forEachIncident ( const Point& k, bool up, Functor f ) const
+      {
+        // Axes along which k can move (even coordinates for cofaces,
+        // odd ones for faces), with the allowed moves in the box.
+        std::ptrdiff_t steps[ KSpace::dimension ];
+        bool lowOk[ KSpace::dimension ], highOk[ KSpace::dimension ];
+        Dimension m = 0;
+        Dimension dim = 0;
+        std::ptrdiff_t nb = 1;
+        for ( Dimension i = 0; i < KSpace::dimension; i++ )
+        {
+          dim += k[i] & 1;
+          if ( ( ( k[i] & 1 ) == 0 ) == up )
+          {
+            steps[m]  = strides[i];
+            lowOk[m]  = k[i] > lower[i];
+            highOk[m] = k[i] < upper[i];
+            m++;
+            nb *= 3;
+          }
+        }
+        const std::ptrdiff_t idx = index ( k );
+        // Base 3 digits of c: 0, -1 or +1 along each of these axes.
+        for ( std::ptrdiff_t c = 1; c < nb; c++ )
+        {
+          std::ptrdiff_t n = idx;
+          Dimension moved = 0;
+          bool valid = true;
+          std::ptrdiff_t r = c;
+          for ( Dimension j = 0; valid && j < m; j++, r /= 3 )
+            if ( r % 3 == 1 )
+            {
+              valid = lowOk[j];
+              n -= steps[j];
+              moved++;
+            }
+            else if ( r % 3 == 2 )
+            {
+              valid = highOk[j];
+              n += steps[j];
+              moved++;
+            }
+          if ( valid && ! f ( (std::size_t) n, up ? dim + moved : dim - moved ) ) return false;
+        }
+        return true;
+      }
+
+      /// @return 'true' iff all the proper cofaces of \a k in the box are in the complex.
+      bool isInterior ( const Point& k ) const
+      {
+        return forEachIncident ( k, true, [this] ( std::size_t n, Dimension )
+                                 { return ( flags[n] & DENSE_IN ) != 0; } );
+      }
+
+      /// @return the number of upper incident cells of \a k in the complex.
+      unsigned int nbUpperIncident ( Point k ) const
+      {
+        unsigned int nb = 0;
+        for ( Dimension i = 0; i < KSpace::dimension; i++ )
+          if ( ! ( k[i] & 1 ) )
+          {
+            k[i]--; nb += has ( k );
+            k[i] += 2; nb += has ( k );
+            k[i]--;
+          }
+        return nb;
+      }
+    };
+
+    /**
+     * Copies the attached complex into \a dc and computes its boundary cells.
+     * @param dc -- the dense complex.
+     * @param nbThreads -- number of threads.
+     */
+    void toDense ( DenseComplex& dc, int nbThreads ) const;
+
+    /**
+     * Erases from the attached complex its cells removed from \a dc,
+     * and marks as fixed the ones fixed in \a dc.
+     * @param dc -- the dense complex.
+     */
+    void fromDense ( const DenseComplex& dc );
+
+    /**
+     * @param dc -- the dense complex.
+     * @param idx -- index of a cell F of \a dc.
+     * @param orient -- freepair orientation
+     * @param dir -- freepair direction
+     * @return 'true' iff F and G = F - orient.e_dir form a free pair of
+     * \a dc made of unfixed cells.
+     */
+    static bool isDenseFreepair ( const DenseComplex& dc, std::size_t idx, int orient, Dimension dir );
+
+    /**
+     * Applies a given number of iterations of directional collapse to \a dc.
+     * @param dc -- the dense complex.
+     * @param iterations -- number of iterations
+     * @param nbThreads -- number of threads.
+     * @return total number of removed cells.
+     */
+    unsigned int denseEval ( DenseComplex& dc, unsigned int iterations, int nbThreads ) const;
+
+    /**
+     * Fixes the cells of dimension KSpace::dimension - 1 of \a dc
+     * which are not included in any KSpace::dimension cell (and
+     * which are isthmus if \a isthmus is 'true').
+     * @param dc -- the dense complex.
+     * @param isthmus -- when 'true', only isthmus are fixed.
+     * @param nbThreads -- number of threads.
+     */
+    void denseFix ( DenseComplex& dc, bool isthmus, int nbThreads ) const;
+
+    /**
+     * Applies denseEval() and denseFix() until stability.
+     * @param isthmus -- when 'true', only isthmus are fixed.
+     * @param nbThreads -- number of threads (0: all available).
+     * @return total number of removed cells.
+     */
+    unsigned int denseCollapse ( bool isthmus, int nbThreads );
+
     // ------------------------- Hidden services ------------------------------
 protected:
     /**
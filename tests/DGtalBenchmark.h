@@ -0,0 +1,331 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * @brief Lightweight micro-benchmark harness used by the DGtal benchmark programs.
+ *
+ * A benchmark is a named setup function taking a problem size and
+ * returning a kernel. The setup is not timed, the kernel is run a
+ * few times to warm up caches, then timed for a given number of
+ * repetitions. The kernel returns the number of processed items
+ * (points, surfels, ...), used to compute a throughput.
+ *
+ * @code
+ * int main( int argc, char** argv )
+ * {
+ *   DGtal::BenchmarkRunner runner( argc, argv );
+ *   runner.run( "images/fill", { 32, 64, 128 }, [] ( std::int64_t n )
+ *     {
+ *       auto image = std::make_shared<Image>( Domain( ..., n ) );
+ *       return DGtal::BenchmarkRunner::Kernel( [image] ()
+ *         { ... ; return image->domain().size(); } );
+ *     } );
+ *   return runner.finish();
+ * }
+ * @endcode
+ *
+ * Command line options of programs using BenchmarkRunner:
+ * - --repetitions N : number of timed runs (default 5);
+ * - --warmup N      : number of untimed runs (default 1);
+ * - --filter STR    : only runs benchmarks whose name contains STR;
+ * - --json FILE     : writes the results as JSON in FILE;
+ * - --quick         : only runs the smallest size of each benchmark, once;
+ * - --large         : also runs the sizes registered only if large() is true.
+ *
+ * The JSON files can be compared with the compareBenchmarks tool.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace DGtal
+{
+  /**
+   * Prevents the compiler from optimizing away a computed value.
+   * @param value any value.
+   */
+  template <typename T>
+  inline void benchmarkDoNotOptimize( T const & value )
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile( "" : : "r,m"( value ) : "memory" );
+#else
+    static volatile const T * sink;
+    sink = &value;
+#endif
+  }
+
+  /// Timing statistics of a benchmark (in milliseconds).
+  struct BenchmarkResult
+  {
+    std::string name;          ///< Name of the benchmark.
+    std::int64_t size;         ///< Problem size.
+    std::size_t repetitions;   ///< Number of timed runs.
+    std::size_t items;         ///< Items processed by one run.
+    double min;                ///< Minimal time.
+    double max;                ///< Maximal time.
+    double mean;               ///< Mean time.
+    double median;             ///< Median time.
+    double stddev;             ///< Standard deviation of the time.
+
+    /// @return the number of items processed per second (from the median time).
+    double itemsPerSecond() const
+    {
+      return median > 0.0 ? 1000.0 * items / median : 0.0;
+    }
+  };
+
+  /**
+   * Runs, times and reports benchmarks (see DGtalBenchmark.h).
+   */
+  class BenchmarkRunner
+  {
+  public:
+    /// A timed kernel returns the number of processed items.
+    typedef std::function<std::size_t()> Kernel;
+
+    /// A setup builds the data for a given size and returns the kernel.
+    typedef std::function<Kernel( std::int64_t )> Setup;
+
+    /**
+     * Constructor from the program arguments.
+     * @param argc number of arguments.
+     * @param argv arguments.
+     */
+    BenchmarkRunner( int argc, char ** argv )
+      : myRepetitions( 5 ), myWarmup( 1 ), myQuick( false ), myLarge( false )
+    {
+      for ( int i = 1; i < argc; ++i )
+        {
+          const std::string arg = argv[ i ];
+          const bool hasValue = ( i + 1 < argc );
+          if ( arg == "--repetitions" && hasValue )
+            myRepetitions = std::max( 1, std::atoi( argv[ ++i ] ) );
+          else if ( arg == "--warmup" && hasValue )
+            myWarmup = std::max( 0, std::atoi( argv[ ++i ] ) );
+          else if ( arg == "--filter" && hasValue )
+            myFilter = argv[ ++i ];
+          else if ( arg == "--json" && hasValue )
+            myJSONFile = argv[ ++i ];
+          else if ( arg == "--quick" )
+            myQuick = true;
+          else if ( arg == "--large" )
+            myLarge = true;
+          else
+            std::cerr << "[BenchmarkRunner] ignoring argument " << arg << std::endl;
+        }
+      if ( myQuick )
+        {
+          myRepetitions = 1;
+          myWarmup      = 0;
+        }
+    }
+
+    /// @return true if only the smallest sizes are run.
+    bool quick() const { return myQuick; }
+
+    /// @return true if the large sizes (memory or time hungry) are requested.
+    bool large() const { return myLarge; }
+
+    /**
+     * Runs a benchmark for each given size.
+     * @param name the benchmark name (use '/' to group benchmarks).
+     * @param sizes the problem sizes.
+     * @param setup the setup function (not timed).
+     */
+    void run( const std::string & name,
+              std::vector<std::int64_t> sizes,
+              const Setup & setup )
+    {
+      if ( ! myFilter.empty() && name.find( myFilter ) == std::string::npos )
+        return;
+      if ( myQuick && ! sizes.empty() )
+        sizes.resize( 1 );
+      for ( const std::int64_t n : sizes )
+        {
+          const Kernel kernel = setup( n );
+          std::size_t items = 0;
+          for ( int i = 0; i < myWarmup; ++i )
+            items = kernel();
+          std::vector<double> times;
+          for ( int i = 0; i < myRepetitions; ++i )
+            {
+              const auto start = std::chrono::steady_clock::now();
+              items = kernel();
+              const auto stop  = std::chrono::steady_clock::now();
+              times.push_back( std::chrono::duration<double, std::milli>( stop - start ).count() );
+            }
+          myResults.push_back( statistics( name, n, items, times ) );
+          display( std::cout, myResults.back() );
+        }
+    }
+
+    /// @return the results of all the benchmarks run so far.
+    const std::vector<BenchmarkResult> & results() const
+    {
+      return myResults;
+    }
+
+    /**
+     * Writes the results as JSON.
+     * @param out the output stream.
+     */
+    void exportJSON( std::ostream & out ) const
+    {
+      const std::time_t now = std::time( nullptr );
+      char date[ 64 ];
+      std::strftime( date, sizeof( date ), "%Y-%m-%dT%H:%M:%S", std::localtime( &now ) );
+      const std::streamsize precision = out.precision( 17 );
+      out << "{\n  \"context\": { \"date\": \"" << date << "\""
+          << ", \"repetitions\": " << myRepetitions
+          << ", \"warmup\": " << myWarmup << " },\n"
+          << "  \"benchmarks\": [";
+      for ( std::size_t i = 0; i < myResults.size(); ++i )
+        {
+          const BenchmarkResult & r = myResults[ i ];
+          out << ( i == 0 ? "\n" : ",\n" )
+              << "    { \"name\": \"" << escapeJSON( r.name ) << "\""
+              << ", \"size\": " << r.size
+              << ", \"repetitions\": " << r.repetitions
+              << ", \"items\": " << r.items
+              << ", \"min_ms\": " << r.min
+              << ", \"max_ms\": " << r.max
+              << ", \"mean_ms\": " << r.mean
+              << ", \"median_ms\": " << r.median
+              << ", \"stddev_ms\": " << r.stddev
+              << ", \"items_per_second\": " << r.itemsPerSecond() << " }";
+        }
+      out << "\n  ]\n}\n";
+      out.precision( precision );
+    }
+
+    /**
+     * Writes the JSON file if requested on the command line.
+     * @return the program exit code.
+     */
+    int finish() const
+    {
+      if ( myJSONFile.empty() ) return 0;
+      std::ofstream out( myJSONFile.c_str() );
+      exportJSON( out );
+      if ( ! out.good() )
+        {
+          std::cerr << "[BenchmarkRunner] cannot write " << myJSONFile << std::endl;
+          return 1;
+        }
+      return 0;
+    }
+
+  private:
+
+    /**
+     * @param s any string.
+     * @return @a s with the quotes, backslashes and control characters
+     * escaped, to be written in a JSON string.
+     */
+    static std::string escapeJSON( const std::string & s )
+    {
+      std::string escaped;
+      escaped.reserve( s.size() );
+      for ( const char c : s )
+        {
+          switch ( c )
+            {
+            case '"':  escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\b': escaped += "\\b"; break;
+            case '\f': escaped += "\\f"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\r': escaped += "\\r"; break;
+            case '\t': escaped += "\\t"; break;
+            default:
+              if ( static_cast<unsigned char>( c ) < 0x20 )
+                {
+                  char code[ 8 ];
+                  std::snprintf( code, sizeof( code ), "\\u%04x", static_cast<unsigned char>( c ) );
+                  escaped += code;
+                }
+              else
+                escaped += c;
+            }
+        }
+      return escaped;
+    }
+
+    static BenchmarkResult statistics( const std::string & name, std::int64_t size,
+                                       std::size_t items, std::vector<double> times )
+    {
+      BenchmarkResult r;
+      r.name        = name;
+      r.size        = size;
+      r.items       = items;
+      r.repetitions = times.size();
+      std::sort( times.begin(), times.end() );
+      r.min    = times.front();
+      r.max    = times.back();
+      r.median = ( times.size() % 2 == 1 )
+        ? times[ times.size() / 2 ]
+        : 0.5 * ( times[ times.size() / 2 - 1 ] + times[ times.size() / 2 ] );
+      double sum = 0.0, sum2 = 0.0;
+      for ( const double t : times ) { sum += t; sum2 += t * t; }
+      r.mean   = sum / times.size();
+      r.stddev = std::sqrt( std::max( 0.0, sum2 / times.size() - r.mean * r.mean ) );
+      return r;
+    }
+
+    static void display( std::ostream & out, const BenchmarkResult & r )
+    {
+      out << std::left << std::setw( 48 ) << r.name << std::right
+          << " size=" << std::setw( 8 ) << r.size
+          << " median=" << std::setw( 10 ) << std::fixed << std::setprecision( 3 ) << r.median << "ms"
+          << " min=" << std::setw( 10 ) << r.min << "ms"
+          << " stddev=" << std::setw( 9 ) << r.stddev << "ms"
+          << " items/s=" << std::scientific << std::setprecision( 3 ) << r.itemsPerSecond()
+          << std::defaultfloat << std::endl;
+    }
+
+    int myRepetitions;
+    int myWarmup;
+    bool myQuick;
+    bool myLarge;
+    std::string myFilter;
+    std::string myJSONFile;
+    std::vector<BenchmarkResult> myResults;
+  };
+
+} // namespace DGtal
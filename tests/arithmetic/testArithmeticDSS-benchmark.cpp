@@ -30,13 +30,18 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <string>
+#include <vector>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
 #include "DGtal/arithmetic/SternBrocot.h"
 #include "DGtal/arithmetic/Pattern.h"
 #include "DGtal/arithmetic/StandardDSLQ0.h"
 #include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/FreemanDSSRecognizer.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -141,6 +146,83 @@ bool testSubStandardDSLQ0( unsigned int nbtries,
 }
 
 
+/**
+ * Builds a 4-connected Freeman chain of about @a nbCodes codes made
+ * of pieces of standard digital lines of random slopes and lengths.
+ */
+std::string randomPolygonalCodes( unsigned int nbCodes )
+{
+  std::string codes;
+  codes.reserve( nbCodes );
+  while ( codes.size() < nbCodes )
+    {
+      const int a = rand() % 200 + 1;
+      const int b = rand() % 200 + 1;
+      const int q = rand() % 4;
+      const int n = 1 + rand() % 500;
+      // 0 <= r < a + b: the step (1,0) adds a, the step (0,1) subtracts b.
+      DGtal::int64_t r = rand() % ( a + b );
+      for ( int i = 0; ( i < n ) && ( codes.size() < nbCodes ); ++i )
+        {
+          const bool xStep = ( r < b );
+          r += xStep ? a : -b;
+          const char c = char( '0' + ( ( xStep ? 0 : 1 ) + q ) % 4 );
+          // backtracks are skipped to keep a simple chain of long DSSs.
+          if ( codes.empty() || ( ( c - codes[ codes.size() - 1 ] + 4 ) % 4 != 2 ) )
+            codes += c;
+        }
+    }
+  return codes;
+}
+
+/**
+ * Measures the throughput (points/s) of the greedy DSS segmentation
+ * of a long Freeman chain, computed point by point with
+ * ArithmeticalDSSComputer and in bulk on the codes with
+ * FreemanDSSRecognizer.
+ */
+bool benchmarkFreemanCodes( unsigned int nbCodes )
+{
+  typedef FreemanChain<DGtal::int32_t> Chain;
+  typedef std::vector<Chain::Point>::const_iterator ConstIterator;
+  typedef ArithmeticalDSSComputer<ConstIterator, DGtal::int32_t, 4> Computer;
+  typedef FreemanDSSRecognizer<DGtal::int32_t> Recognizer;
+
+  const Chain fc( randomPolygonalCodes( nbCodes ), 0, 0 );
+  std::vector<Chain::Point> points;
+  Chain::getContourPoints( fc, points );
+
+  Clock c;
+  c.startClock();
+  unsigned int nbGeneric = 0;
+  for ( ConstIterator it = points.begin(); ; ++nbGeneric )
+    {
+      Computer computer;
+      computer.init( it );
+      while ( ( computer.end() != points.end() ) && computer.extendFront() ) {}
+      if ( computer.end() == points.end() )
+        break;
+      it = computer.end();
+      --it;
+    }
+  const double tGeneric = c.stopClock();
+
+  c.startClock();
+  std::vector<Recognizer::DSS> segments;
+  segments.reserve( nbGeneric + 1 );
+  Recognizer::greedySegmentation( fc, std::back_inserter( segments ) );
+  const double tCodes = c.stopClock();
+
+  const double nbPoints = double( points.size() );
+  std::cout << "# greedy DSS segmentation of " << points.size() << " points, "
+            << segments.size() << " segments" << std::endl
+            << "# ArithmeticalDSSComputer: " << tGeneric << " ms, "
+            << 1000.0 * nbPoints / tGeneric << " points/s" << std::endl
+            << "# FreemanDSSRecognizer:    " << tCodes << " ms, "
+            << 1000.0 * nbPoints / tCodes << " points/s" << std::endl;
+  return segments.size() == nbGeneric + 1;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -153,7 +235,9 @@ int main( int argc, char** argv)
   Integer moda = ( argc > 2 ) ? atoll( argv[ 2 ] ) : 12000;
   Integer modb = ( argc > 3 ) ? atoll( argv[ 3 ] ) : 12000;
   Integer modx = ( argc > 4 ) ? atoll( argv[ 4 ] ) : 1000;
+  unsigned int nbCodes = ( argc > 5 ) ? atoi( argv[ 5 ] ) : 10000000;
   testSubStandardDSLQ0<Fraction>( nbtries, moda, modb, modx );
+  benchmarkFreemanCodes( nbCodes );
   return true;
 }
 
@@ -28,7 +28,10 @@
  */
 
 ///////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
+#include <vector>
 
 //#define DEBUG_LatticePolytope2D
 
@@ -329,6 +332,57 @@ bool specificTestLatticePolytope2D()
   return nbok == nb;
 }
 
+/**
+ * Checks that a polytope stored in a vector gives the same sequence
+ * of vertices as one stored in a list, for random sequences of cuts.
+ */
+template <typename Space>
+bool
+compareListAndVectorCuts()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing block LatticePolytope2D list vs vector cuts" );
+  typedef typename Space::Point Point;
+  typedef typename Space::Vector Vector;
+  typedef LatticePolytope2D<Space> CIP;
+  typedef LatticePolytope2D<Space, std::vector<Point> > VectorCIP;
+  typedef typename CIP::HalfSpace HalfSpace;
+
+  CIP cip;
+  VectorCIP vcip;
+  const Point vertices[] = { Point( 0, 0 ), Point( 8, -3 ), Point( 17, 2 ), Point( 21, 13 ),
+                             Point( 13, 19 ), Point( 6, 17 ), Point( -3, 6 ) };
+  for ( unsigned int i = 0; i < 7; ++i )
+    {
+      cip.pushBack( vertices[ i ] );
+      vcip.pushBack( vertices[ i ] );
+    }
+  for ( unsigned int j = 0; j < 200; ++j )
+    {
+      CIP cip2 = cip;
+      VectorCIP vcip2 = vcip;
+      for ( unsigned int i = 0; i < 10 && ! cip2.empty(); ++i )
+        {
+          int x = 0;
+          int y = 0;
+          while ( ( x == 0 ) && ( y == 0 ) )
+            {
+              x = myRand( 63 ) - 31;
+              y = myRand( 63 ) - 31;
+            }
+          HalfSpace h( Vector( x, y ), x * myRand( 22 ) + y * myRand( 20 ) );
+          ++nb; nbok += ( cip2.cut( h ) == vcip2.cut( h ) ) ? 1 : 0;
+          ++nb; nbok += ( cip2.size() == vcip2.size() )
+            && std::equal( cip2.begin(), cip2.end(), vcip2.begin() ) ? 1 : 0;
+        }
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") same vertices" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 template <typename Space>
 bool
 checkOutputConvexHullBorder()
@@ -383,10 +437,12 @@ int main( int, char** )
   trace.beginBlock ( "Testing class LatticePolytope2D" );
 
   typedef SpaceND<2, DGtal::int64_t> Z2;
-  typedef SpaceND<2, DGtal::BigInteger> Z2I;
   bool res = testLatticePolytope2D<Z2>()
-    && testLatticePolytope2D<Z2I>()
+#ifdef WITH_BIGINTEGER
+    && testLatticePolytope2D< SpaceND<2, DGtal::BigInteger> >()
+#endif
     && exhaustiveTestLatticePolytope2D<Z2>()
+    && compareListAndVectorCuts<Z2>()
     && checkOutputConvexHullBorder<Z2>();
   //&& specificTestLatticePolytope2D<Z2>();
   //&& exhaustiveTestLatticePolytope2D<Z2I>();
@@ -696,12 +696,12 @@ bool testSubStandardDSLQ0()
  * Example of a test. To be completed.
  *
  */
+template <typename Integer>
 bool testSternBrocot()
 {
   unsigned int nbtests = 10;
   unsigned int nbok = 0;
   unsigned int nb = 0;
-  typedef DGtal::BigInteger Integer;
   typedef SternBrocot<Integer, DGtal::int32_t> SB;
   trace.beginBlock ( "Testing block: init fractions." );
   for ( unsigned int i = 0; i < nbtests; ++i )
@@ -874,7 +874,15 @@ int main( int , char** )
   BOOST_CONCEPT_ASSERT(( boost::InputIterator< ConstIterator > ));
 
   trace.beginBlock ( "Testing class SternBrocot" );
-  bool res = testSternBrocot()
+  bool res = true
+#ifdef WITH_BIGINTEGER
+    && testSternBrocot<DGtal::BigInteger>()
+#endif
+#ifdef WITH_INT128
+    && testSternBrocot<DGtal::int128_t>()
+    && testContinuedFractions< SternBrocot<DGtal::int128_t, DGtal::int64_t> >()
+    && testSimplestFractionInBetween< SternBrocot<DGtal::int128_t, DGtal::int64_t> >()
+#endif
     && testPattern<SB>()
     && testSubStandardDSLQ0<Fraction>()
     && testContinuedFractions<SB>()
@@ -36,6 +36,9 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Clock.h"
+#if !defined(WIN32)
+#include <unistd.h>
+#endif
 
 using namespace DGtal;
 using namespace std;
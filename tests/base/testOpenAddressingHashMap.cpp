@@ -0,0 +1,187 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOpenAddressingHashMap.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class OpenAddressingHashMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <random>
+#include <boost/concept_check.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/OpenAddressingHashMap.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class OpenAddressingHashMap.
+///////////////////////////////////////////////////////////////////////////////
+
+/// A bad hash function: every key collides.
+struct ConstantHash
+{
+  std::size_t operator()( int ) const { return 42; }
+};
+
+template <typename Map>
+bool sameContent( const Map & map, const std::map<int, int> & reference )
+{
+  if ( map.size() != reference.size() || ! map.isValid() )
+    return false;
+  for ( std::map<int, int>::const_iterator it = reference.begin(); it != reference.end(); ++it )
+    {
+      typename Map::const_iterator found = map.find( it->first );
+      if ( found == map.end() || found->second != it->second )
+        return false;
+    }
+  std::size_t nb = 0;
+  for ( typename Map::const_iterator it = map.begin(); it != map.end(); ++it )
+    ++nb;
+  return nb == reference.size();
+}
+
+template <typename Map>
+void randomOperations( Map & map )
+{
+  std::map<int, int> reference;
+  std::mt19937 gen( 7 );
+  std::uniform_int_distribution<int> keys( 0, 400 );
+  for ( int i = 0; i < 5000; ++i )
+    {
+      const int k = keys( gen );
+      switch ( gen() % 4 )
+        {
+        case 0:
+        case 1:
+          map.insert( std::make_pair( k, i ) );
+          reference.insert( std::make_pair( k, i ) );
+          break;
+        case 2:
+          map[ k ] = -i;
+          reference[ k ] = -i;
+          break;
+        default:
+          REQUIRE( map.erase( k ) == reference.erase( k ) );
+        }
+    }
+  REQUIRE( sameContent( map, reference ) );
+}
+
+TEST_CASE( "Testing OpenAddressingHashMap" )
+{
+  typedef OpenAddressingHashMap<int, int> Map;
+  BOOST_CONCEPT_ASSERT(( boost::PairAssociativeContainer< Map > ));
+  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< Map > ));
+
+  SECTION( "Empty map" )
+    {
+      Map map;
+      REQUIRE( map.empty() );
+      REQUIRE( map.begin() == map.end() );
+      REQUIRE( map.find( 3 ) == map.end() );
+      REQUIRE( map.count( 3 ) == 0 );
+      REQUIRE( map.erase( 3 ) == 0 );
+      REQUIRE( map.isValid() );
+    }
+
+  SECTION( "Insertion, lookup and growth" )
+    {
+      Map map;
+      for ( int i = 0; i < 1000; ++i )
+        REQUIRE( map.insert( std::make_pair( i, 2 * i ) ).second );
+      REQUIRE( ! map.insert( std::make_pair( 10, 0 ) ).second );
+      REQUIRE( map.size() == 1000 );
+      REQUIRE( map.count( 10 ) == 1 );
+      REQUIRE( map.find( 10 )->second == 20 );
+      REQUIRE( map.size() <= Map::maxLoadFactor * map.capacity() );
+      REQUIRE( map.isValid() );
+      REQUIRE( map.equal_range( 5 ).first->second == 10 );
+      REQUIRE( map.equal_range( 5000 ).first == map.end() );
+    }
+
+  SECTION( "Random insertions and erasures, as std::map" )
+    {
+      Map map;
+      randomOperations( map );
+    }
+
+  SECTION( "Erasures with long probing sequences" )
+    {
+      OpenAddressingHashMap<int, int, ConstantHash> map;
+      randomOperations( map );
+    }
+
+  SECTION( "Copy, assignment, range erasure" )
+    {
+      Map map( 100 );
+      const std::size_t capacity = map.capacity();
+      for ( int i = 0; i < 75; ++i )
+        map[ i ] = i;
+      REQUIRE( map.capacity() == capacity );
+      Map copy( map );
+      Map other;
+      other = map;
+      map.erase( map.begin(), map.end() );
+      REQUIRE( map.empty() );
+      REQUIRE( copy.size() == 75 );
+      REQUIRE( other.size() == 75 );
+      REQUIRE( copy[ 74 ] == 74 );
+      copy.clear();
+      REQUIRE( copy.empty() );
+      REQUIRE( other.isValid() );
+    }
+
+  SECTION( "Surfels as keys" )
+    {
+      typedef Z3i::KSpace::SCell SCell;
+      Z3i::KSpace K;
+      K.init( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 10 ), true );
+      OpenAddressingHashMap<SCell, double> map;
+      std::map<SCell, double> reference;
+      const Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 10 ) );
+      for ( auto p : domain )
+        {
+          const SCell s = K.sSpel( p, K.POS );
+          map[ K.sIncident( s, 0, true ) ] = p[ 0 ];
+          reference[ K.sIncident( s, 0, true ) ] = p[ 0 ];
+        }
+      bool same = ( map.size() == reference.size() );
+      for ( auto it = reference.begin(); it != reference.end(); ++it )
+        same = same && ( map.find( it->first ) != map.end() )
+          && ( map.find( it->first )->second == it->second );
+      REQUIRE( same );
+      REQUIRE( map.memoryUsage() < reference.size() * ( sizeof( std::pair<SCell, double> ) + 32 ) );
+    }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,161 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testProfiler.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class Profiler.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Profiler.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+double work( unsigned int n )
+{
+  double tmp = 1.0;
+  for ( unsigned int i = 0; i < n; i++ )
+    tmp = std::cos( tmp + i );
+  return tmp;
+}
+
+////////////////////////////// unit tests /////////////////////////////////
+TEST_CASE( "Profiler aggregates nested blocks", "[profiler]" )
+{
+  Profiler profiler( true, true );
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      profiler.beginBlock( "Outer" );
+      work( 1000 );
+      profiler.beginBlock( "Inner" );
+      work( 1000 );
+      double elapsed = profiler.endBlock();
+      REQUIRE( elapsed >= 0.0 );
+      profiler.endBlock();
+    }
+  REQUIRE( profiler.endBlock() == 0.0 );
+
+  const auto outer = profiler.statistics( "Outer" );
+  const auto inner = profiler.statistics( "Outer/Inner" );
+  REQUIRE( outer.count == 3 );
+  REQUIRE( inner.count == 3 );
+  REQUIRE( inner.depth == 1 );
+  REQUIRE( inner.name == "Inner" );
+  REQUIRE( outer.total >= inner.total );
+  REQUIRE( inner.min <= inner.mean() );
+  REQUIRE( inner.mean() <= inner.max );
+  REQUIRE( profiler.statistics( "Unknown" ).count == 0 );
+  REQUIRE( profiler.events().size() == 6 );
+
+  const auto all = profiler.statistics();
+  REQUIRE( all.size() == 2 );
+  REQUIRE( all[ 0 ].path == "Outer" );
+  REQUIRE( all[ 1 ].path == "Outer/Inner" );
+
+  std::stringstream json;
+  profiler.exportJSON( json );
+  REQUIRE( json.str().find( "\"path\": \"Outer/Inner\"" ) != std::string::npos );
+  std::stringstream chrome;
+  profiler.exportChromeTrace( chrome );
+  REQUIRE( chrome.str().find( "\"traceEvents\"" ) != std::string::npos );
+  REQUIRE( chrome.str().find( "\"ph\": \"X\"" ) != std::string::npos );
+
+  profiler.reset();
+  REQUIRE( profiler.statistics().empty() );
+}
+
+TEST_CASE( "Profiler is thread-safe", "[profiler]" )
+{
+  Profiler profiler( true );
+  std::vector<std::thread> threads;
+  for ( unsigned int t = 0; t < 4; ++t )
+    threads.push_back( std::thread( [&profiler] ()
+      {
+        for ( unsigned int i = 0; i < 50; ++i )
+          {
+            profiler.beginBlock( "Task" );
+            profiler.beginBlock( "Step" );
+            work( 100 );
+            profiler.endBlock();
+            profiler.endBlock();
+          }
+      } ) );
+  for ( auto & t : threads ) t.join();
+
+  REQUIRE( profiler.statistics( "Task" ).count == 200 );
+  REQUIRE( profiler.statistics( "Task/Step" ).count == 200 );
+  REQUIRE( profiler.events().size() == 400 );
+}
+
+TEST_CASE( "Trace blocks feed an attached profiler", "[profiler]" )
+{
+  Profiler profiler;
+  trace.attachProfiler( profiler );
+  REQUIRE( trace.profiler() == &profiler );
+  trace.beginBlock( "Level0" );
+  trace.beginBlock( "Level1" );
+  work( 1000 );
+  trace.endBlock();
+  trace.endBlock();
+  trace.detachProfiler();
+  trace.beginBlock( "NotProfiled" );
+  trace.endBlock();
+
+  REQUIRE( profiler.statistics( "Level0" ).count == 1 );
+  REQUIRE( profiler.statistics( "Level0/Level1" ).count == 1 );
+  REQUIRE( profiler.statistics( "NotProfiled" ).count == 0 );
+  trace.info() << profiler;
+}
+
+TEST_CASE( "Attaching a profiler inside a block keeps it balanced", "[profiler]" )
+{
+  Profiler first;
+  Profiler second;
+  trace.beginBlock( "Outer" );
+  trace.attachProfiler( first );
+  trace.beginBlock( "Inner" );
+  trace.detachProfiler();
+  trace.endBlock();
+  trace.attachProfiler( second );
+  trace.endBlock();
+  trace.beginBlock( "Next" );
+  trace.endBlock();
+  trace.detachProfiler();
+
+  REQUIRE( first.statistics( "Inner" ).count == 1 );
+  REQUIRE( first.statistics( "Outer" ).count == 0 );
+  REQUIRE( second.statistics( "Next" ).count == 1 );
+  REQUIRE( second.statistics( "Outer/Next" ).count == 0 );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,156 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testTimeAccumulator.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing classes TimeAccumulator and ScopedTimer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/TimeAccumulator.h"
+
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes TimeAccumulator and ScopedTimer
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing the monotonic Clock" )
+{
+  Clock c;
+  c.startClock();
+  std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+  const double first = c.restartClock();
+  const double second = c.stopClock();
+  REQUIRE( first >= 20.0 );
+  REQUIRE( second >= 0.0 );
+  REQUIRE( second < first );
+}
+
+TEST_CASE( "Testing TimeAccumulator" )
+{
+  SECTION( "An empty accumulator" )
+    {
+      TimeAccumulator<> acc;
+      REQUIRE( acc.count() == 0 );
+      REQUIRE( acc.totalTicks() == 0 );
+      REQUIRE( acc.minTicks() == 0 );
+      REQUIRE( acc.mean() == 0.0 );
+      REQUIRE( acc.isValid() );
+    }
+
+  SECTION( "Adding and merging measurements" )
+    {
+      TimeAccumulator<> a, b;
+      a.add( 10 ); a.add( 30 );
+      b.add( 5 );  b.add( 50 ); b.add( 15 );
+      REQUIRE( a.count() == 2 );
+      REQUIRE( a.totalTicks() == 40 );
+      REQUIRE( a.minTicks() == 10 );
+      REQUIRE( a.maxTicks() == 30 );
+      a.merge( b );
+      REQUIRE( a.count() == 5 );
+      REQUIRE( a.totalTicks() == 110 );
+      REQUIRE( a.minTicks() == 5 );
+      REQUIRE( a.maxTicks() == 50 );
+      REQUIRE( a.total() == Approx( 110.0e-6 ) );
+      REQUIRE( a.mean() == Approx( 22.0e-6 ) );
+      a.reset();
+      REQUIRE( a.count() == 0 );
+    }
+
+  SECTION( "Accumulators of an array do not share cache lines" )
+    {
+      REQUIRE( sizeof( TimeAccumulator<> ) >= 128 );
+      REQUIRE( sizeof( TimeAccumulator<CycleTickCounter> ) >= 128 );
+    }
+}
+
+TEST_CASE( "Testing ScopedTimer" )
+{
+  SECTION( "With the steady clock" )
+    {
+      TimeAccumulator<> acc;
+      for ( int i = 0; i < 3; ++i )
+        {
+          ScopedTimer<> timer( acc );
+          std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) );
+        }
+      trace.info() << acc << std::endl;
+      REQUIRE( acc.count() == 3 );
+      REQUIRE( acc.min() >= 5.0 );
+      REQUIRE( acc.total() >= 15.0 );
+      REQUIRE( acc.max() >= acc.min() );
+    }
+
+  SECTION( "With the cycle counter" )
+    {
+      TimeAccumulator<CycleTickCounter> acc;
+      {
+        ScopedTimer<CycleTickCounter> timer( acc );
+        std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+      }
+      trace.info() << acc << std::endl;
+      REQUIRE( CycleTickCounter::ticksPerMillisecond() > 0.0 );
+      REQUIRE( acc.count() == 1 );
+      // Loose bounds: the calibration is approximate.
+      REQUIRE( acc.total() >= 10.0 );
+      REQUIRE( acc.total() < 2000.0 );
+    }
+
+  SECTION( "Per-thread accumulators merged afterwards" )
+    {
+      const int nbThreads = 4;
+      const int nbLoops   = 1000;
+      std::vector< TimeAccumulator<CycleTickCounter> > timers( nbThreads );
+      std::vector< std::thread > threads;
+      std::vector< double > sinks( nbThreads, 0.0 );
+      for ( int t = 0; t < nbThreads; ++t )
+        threads.push_back( std::thread( [&timers, &sinks, t, nbLoops] ()
+          {
+            for ( int i = 0; i < nbLoops; ++i )
+              {
+                ScopedTimer<CycleTickCounter> timer( timers[ t ] );
+                sinks[ t ] += std::cos( sinks[ t ] + i );
+              }
+          } ) );
+      for ( auto & thread : threads ) thread.join();
+      TimeAccumulator<CycleTickCounter> total;
+      for ( const auto & timer : timers ) total.merge( timer );
+      REQUIRE( total.count() == std::size_t( nbThreads * nbLoops ) );
+      REQUIRE( total.isValid() );
+    }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,1029 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkSuite.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Regression benchmark suite covering images, digital sets, digital
+ * surfaces, distance transformations and curve estimators.
+ *
+ * @code
+ * ./benchmarkSuite --repetitions 10 --json current.json
+ * ./compareBenchmarks baseline.json current.json
+ * @endcode
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <unordered_set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/PointHashFunctions.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerByBricks.h"
+#include "DGtal/images/ImageContainerByHashTree.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/parametric/Ball2D.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/FlatMesh.h"
+#include "DGtal/shapes/MeshHelpers.h"
+#include "DGtal/shapes/MarchingCubes.h"
+#include "DGtal/kernel/CanonicEmbedder.h"
+#include "DGtal/images/ImageLinearCellEmbedder.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalTopologyTraits.h"
+#include "DGtal/topology/HomotopicThinning.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/CubicalComplexFunctions.h"
+#include "DGtal/topology/DenseCellMap.h"
+#include "DGtal/topology/ParDirCollapse.h"
+#include "DGtal/io/boards/Board3DRaster.h"
+#include "DGtal/geometry/surfaces/DigitalPlaneSegmentation.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/FreemanDSSRecognizer.h"
+#include "DGtal/geometry/curves/estimation/MostCenteredMaximalSegmentEstimator.h"
+#include "DGtal/geometry/curves/estimation/SegmentComputerEstimators.h"
+#include "DGtal/geometry/curves/estimation/BatchMostCenteredMaximalSegmentEstimator.h"
+#include "DGtalBenchmark.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+typedef BenchmarkRunner::Kernel Kernel;
+
+///////////////////////////////////////////////////////////////////////////////
+// Images
+///////////////////////////////////////////////////////////////////////////////
+template <typename Image>
+Kernel setupImageWrite( std::int64_t n )
+{
+  const Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( n - 1 ) );
+  auto image = std::make_shared<Image>( domain );
+  return [image] ()
+    {
+      int v = 0;
+      for ( auto p : image->domain() )
+        image->setValue( p, v++ );
+      return (std::size_t) image->domain().size();
+    };
+}
+
+template <typename Image>
+Kernel setupImageRead( std::int64_t n )
+{
+  const Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( n - 1 ) );
+  auto image = std::make_shared<Image>( domain );
+  int v = 0;
+  for ( auto p : domain )
+    image->setValue( p, v++ );
+  return [image] ()
+    {
+      long long sum = 0;
+      for ( auto p : image->domain() )
+        sum += (*image)( p );
+      benchmarkDoNotOptimize( sum );
+      return (std::size_t) image->domain().size();
+    };
+}
+
+// Sparse label volume: two nested balls in an empty background.
+std::shared_ptr< ImageContainerBySTLVector<Z3i::Domain, int> > makeLabelVolume( std::int64_t n )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  const Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( n - 1 ) );
+  auto labels = std::make_shared<Image>( domain );
+  const Z3i::Point c = Z3i::Point::diagonal( n / 2 );
+  for ( auto p : domain )
+    {
+      const double d = ( p - c ).norm();
+      labels->setValue( p, d < n / 5.0 ? 2 : ( d < n / 3.0 ? 1 : 0 ) );
+    }
+  return labels;
+}
+
+// Hash tree filled voxel by voxel.
+Kernel setupHashTreeSetValue( std::int64_t n )
+{
+  typedef experimental::ImageContainerByHashTree<Z3i::Domain, int> Tree;
+  auto labels = makeLabelVolume( n );
+  return [labels] ()
+    {
+      Tree tree( labels->domain(), 12, 0 );
+      for ( auto p : labels->domain() )
+        tree.setValue( p, (*labels)( p ) );
+      benchmarkDoNotOptimize( tree.getNbNodes() );
+      return (std::size_t) labels->domain().size();
+    };
+}
+
+// Hash tree built bottom-up from the dense volume.
+Kernel setupHashTreeBuild( std::int64_t n )
+{
+  typedef experimental::ImageContainerByHashTree<Z3i::Domain, int> Tree;
+  auto labels = makeLabelVolume( n );
+  return [labels] ()
+    {
+      Tree tree( labels->domain(), 12, 0 );
+      tree.buildFromImage( *labels );
+      benchmarkDoNotOptimize( tree.getNbNodes() );
+      return (std::size_t) labels->domain().size();
+    };
+}
+
+// Raster scan of a hash tree (through a Reader).
+Kernel setupHashTreeRead( std::int64_t n )
+{
+  typedef experimental::ImageContainerByHashTree<Z3i::Domain, int> Tree;
+  auto labels = makeLabelVolume( n );
+  auto tree = std::make_shared<Tree>( labels->domain(), 12, 0 );
+  for ( auto p : labels->domain() )
+    tree->setValue( p, (*labels)( p ) );
+  return [tree, labels] ()
+    {
+      long long sum = 0;
+      Tree::Reader reader( *tree );
+      for ( auto p : labels->domain() )
+        sum += reader( p );
+      benchmarkDoNotOptimize( sum );
+      return (std::size_t) labels->domain().size();
+    };
+}
+
+// Scan of the leaves of a hash tree (label volumes).
+Kernel setupHashTreeLeafScan( std::int64_t n )
+{
+  typedef experimental::ImageContainerByHashTree<Z3i::Domain, int> Tree;
+  auto labels = makeLabelVolume( n );
+  auto tree = std::make_shared<Tree>( labels->domain(), 12, 0 );
+  tree->buildFromImage( *labels );
+  return [tree, labels] ()
+    {
+      std::size_t volumes[ 3 ] = { 0, 0, 0 };
+      for ( Tree::Iterator it = tree->begin(), itE = tree->end(); it != itE; ++it )
+        volumes[ *it ] += tree->getKeyDomain( it.getKey() ).size();
+      benchmarkDoNotOptimize( volumes[ 1 ] + volumes[ 2 ] );
+      return (std::size_t) labels->domain().size();
+    };
+}
+
+// Sum over the 3x3x3 neighborhoods of the interior points, with
+// precomputed memory offsets (row-major layout).
+Kernel setupNeighborhoodSumSTLVector( std::int64_t n )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  const Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( n - 1 ) );
+  auto image = std::make_shared<Image>( domain );
+  int v = 0;
+  for ( auto p : domain )
+    image->setValue( p, v++ % 7 );
+  const Z3i::Domain interior( Z3i::Point::diagonal( 1 ), Z3i::Point::diagonal( n - 2 ) );
+  const Z3i::Domain neighborhood( Z3i::Point::diagonal( -1 ), Z3i::Point::diagonal( 1 ) );
+  std::vector<std::ptrdiff_t> offsets;
+  for ( auto q : neighborhood )
+    offsets.push_back( (std::ptrdiff_t) image->linearized( Z3i::Point::diagonal( 1 ) + q )
+                       - (std::ptrdiff_t) image->linearized( Z3i::Point::diagonal( 1 ) ) );
+  return [image, interior, offsets] ()
+    {
+      long long sum = 0;
+      const int * values = image->data();
+      for ( auto p : interior )
+        {
+          const std::size_t index = image->linearized( p );
+          for ( auto offset : offsets )
+            sum += values[ index + offset ];
+        }
+      benchmarkDoNotOptimize( sum );
+      return (std::size_t) interior.size();
+    };
+}
+
+// Same sums on a bricked image, scanned in memory order.
+Kernel setupNeighborhoodSumBricks( std::int64_t n )
+{
+  typedef ImageContainerByBricks<Z3i::Domain, int> Image;
+  const Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( n - 1 ) );
+  auto image = std::make_shared<Image>( domain );
+  int v = 0;
+  for ( auto p : domain )
+    image->setValue( p, v++ % 7 );
+  const Z3i::Domain interior( Z3i::Point::diagonal( 1 ), Z3i::Point::diagonal( n - 2 ) );
+  const Z3i::Domain neighborhood( Z3i::Point::diagonal( -1 ), Z3i::Point::diagonal( 1 ) );
+  const std::vector<Z3i::Vector> vectors( neighborhood.begin(), neighborhood.end() );
+  const std::vector<Image::Difference> offsets = image->neighborOffsetTable( vectors );
+  return [image, interior, offsets] ()
+    {
+      long long sum = 0;
+      const Image & img = *image;
+      const int * values = img.data();
+      for ( auto it = img.linearBegin(), itE = img.linearEnd(); it != itE; ++it )
+        {
+          if ( ! interior.isInside( it.point() ) ) continue;
+          const Image::Difference * o = &offsets[ it.localIndex() * 27 ];
+          for ( unsigned int k = 0; k < 27; ++k )
+            sum += values[ it.index() + o[ k ] ];
+        }
+      benchmarkDoNotOptimize( sum );
+      return (std::size_t) interior.size();
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Digital sets
+///////////////////////////////////////////////////////////////////////////////
+template <typename Set>
+Kernel setupSetInsert( std::int64_t n )
+{
+  const Z3i::Domain domain( Z3i::Point::diagonal( -n ), Z3i::Point::diagonal( n ) );
+  auto points = std::make_shared< std::vector<Z3i::Point> >();
+  for ( auto p : domain )
+    if ( p.norm() <= n ) points->push_back( p );
+  return [domain, points] ()
+    {
+      Set set( domain );
+      for ( const auto & p : *points )
+        set.insert( p );
+      benchmarkDoNotOptimize( set.size() );
+      return points->size();
+    };
+}
+
+template <typename Set>
+Kernel setupSetFind( std::int64_t n )
+{
+  const Z3i::Domain domain( Z3i::Point::diagonal( -n ), Z3i::Point::diagonal( n ) );
+  auto set = std::make_shared<Set>( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( *set, Z3i::Point::diagonal( 0 ), n );
+  return [set] ()
+    {
+      std::size_t nb = 0;
+      for ( auto p : set->domain() )
+        if ( (*set)( p ) ) ++nb;
+      benchmarkDoNotOptimize( nb );
+      return (std::size_t) set->domain().size();
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Digital surfaces
+///////////////////////////////////////////////////////////////////////////////
+Kernel setupSurfaceBoundary( std::int64_t n )
+{
+  const Z3i::Domain domain( Z3i::Point::diagonal( -n - 1 ), Z3i::Point::diagonal( n + 1 ) );
+  auto set = std::make_shared<Z3i::DigitalSet>( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( *set, Z3i::Point::diagonal( 0 ), n );
+  auto K = std::make_shared<Z3i::KSpace>();
+  K->init( domain.lowerBound(), domain.upperBound(), true );
+  return [set, K] ()
+    {
+      std::set<Z3i::SCell> boundary;
+      Surfaces<Z3i::KSpace>::sMakeBoundary( boundary, *K, *set,
+                                            K->lowerBound(), K->upperBound() );
+      return boundary.size();
+    };
+}
+
+Kernel setupPlaneSegmentation( std::int64_t n, int nbThreads, std::size_t batchSize )
+{
+  typedef DigitalSetBoundary<Z3i::KSpace, Z3i::DigitalSet> Container;
+  typedef DigitalSurface<Container> Surface;
+  typedef DigitalPlaneSegmentation<Surface, COBANaivePlaneComputer<Z3i::Z3, DGtal::int64_t> > Segmentation;
+  const Z3i::Domain domain( Z3i::Point::diagonal( -n - 1 ), Z3i::Point::diagonal( n + 1 ) );
+  Z3i::DigitalSet set( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point::diagonal( 0 ), n );
+  auto K = std::make_shared<Z3i::KSpace>();
+  K->init( domain.lowerBound(), domain.upperBound(), true );
+  auto surface = std::make_shared<Surface>( new Container( *K, set, SurfelAdjacency<3>( true ) ) );
+  auto segmentation = std::make_shared<Segmentation>( *surface );
+  return [K, surface, segmentation, nbThreads, batchSize] ()
+    {
+      benchmarkDoNotOptimize( segmentation->segment( 500, 1, 1, nbThreads, batchSize ) );
+      return segmentation->size();
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Simple points
+///////////////////////////////////////////////////////////////////////////////
+/// Simple point test with breadth-first geodesic neighborhoods (Object::isSimple up to DGtal 1.0).
+bool isSimpleByGeodesicNeighborhoods( const Z3i::Object26_6 & object, const Z3i::Point & p )
+{
+  typedef DigitalTopologyTraits<Z3i::Adj26, Z3i::Adj6, 3> Traits26_6;
+  typedef DigitalTopologyTraits<Z3i::Adj6, Z3i::Adj26, 3> Traits6_26;
+  const Z3i::Object26_6::SmallObject G
+    = object.geodesicNeighborhood( object.topology().kappa(), p,
+                                   Traits26_6::GEODESIC_NEIGHBORHOOD_SIZE );
+  if ( G.pointSet().empty() || G.computeConnectedness() != CONNECTED ) return false;
+  const Z3i::Object26_6::SmallComplementObject Gc
+    = object.geodesicNeighborhoodInComplement( object.topology().lambda(), p,
+                                               Traits6_26::GEODESIC_NEIGHBORHOOD_SIZE );
+  return ( ! Gc.pointSet().empty() ) && ( Gc.computeConnectedness() == CONNECTED );
+}
+
+/// Hollow ball of outer radius n.
+std::shared_ptr<Z3i::Object26_6> makeHollowBall( std::int64_t n, bool useTable )
+{
+  const Z3i::Domain domain( Z3i::Point::diagonal( -n - 1 ), Z3i::Point::diagonal( n + 1 ) );
+  Z3i::DigitalSet set( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point::diagonal( 0 ), n );
+  Shapes<Z3i::Domain>::removeNorm2Ball( set, Z3i::Point::diagonal( 0 ), n / 2 );
+  auto object = std::make_shared<Z3i::Object26_6>( Z3i::dt26_6, set );
+  if ( useTable ) object->loadSimplicityTable();
+  return object;
+}
+
+/// mode 0: geodesic neighborhoods, 1: Object::isSimple, 2: simplicity table.
+Kernel setupSimplePoints( std::int64_t n, int mode )
+{
+  auto object = makeHollowBall( n, mode == 2 );
+  return [object, mode] ()
+    {
+      std::size_t nb = 0;
+      for ( auto && p : object->pointSet() )
+        nb += ( mode == 0 ? isSimpleByGeodesicNeighborhoods( *object, p )
+                : object->isSimple( p ) ) ? 1 : 0;
+      benchmarkDoNotOptimize( nb );
+      return object->size();
+    };
+}
+
+Kernel setupThinning( std::int64_t n, bool useTable )
+{
+  auto object = makeHollowBall( n, useTable );
+  return [object] ()
+    {
+      Z3i::Object26_6 thin( *object );
+      benchmarkDoNotOptimize( functions::homotopicThinning( thin ) );
+      return object->size();
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Cubical complexes
+///////////////////////////////////////////////////////////////////////////////
+typedef CubicalComplex<Z3i::KSpace> Complex3;
+
+/// Surface thinning of the closure of a ball of radius n, either
+/// sequential on the map-based complex or parallel on its dense copy.
+Kernel setupDirCollapse( std::int64_t n, bool parallel )
+{
+  auto K = std::make_shared<Z3i::KSpace>();
+  K->init( Z3i::Point::diagonal( -n - 1 ), Z3i::Point::diagonal( n + 1 ), true );
+  const Z3i::Domain domain( K->lowerBound(), K->upperBound() );
+  Z3i::DigitalSet set( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point::diagonal( 0 ), n );
+  auto complex = std::make_shared<Complex3>( *K );
+  complex->construct( set );
+  return [K, complex, parallel] ()
+    {
+      Complex3 thin( *complex );
+      ParDirCollapse<Complex3> thinning( *K );
+      thinning.attach( &thin );
+      if ( parallel ) thinning.collapseSurfaceParallel();
+      else thinning.collapseSurface();
+      benchmarkDoNotOptimize( thin.nbCells( 2 ) );
+      return complex->nbCells( 0 ) + complex->nbCells( 1 )
+        + complex->nbCells( 2 ) + complex->nbCells( 3 );
+    };
+}
+
+/// @return the bytes currently held by all the CountingAllocator.
+std::size_t & countedBytes()
+{
+  static std::size_t bytes = 0;
+  return bytes;
+}
+
+/// Standard allocator counting the bytes it currently holds.
+template <typename T>
+struct CountingAllocator : public std::allocator<T>
+{
+  template <typename U> struct rebind { typedef CountingAllocator<U> other; };
+  CountingAllocator() {}
+  template <typename U> CountingAllocator( const CountingAllocator<U> & ) {}
+  T * allocate( std::size_t n )
+  {
+    countedBytes() += n * sizeof( T );
+    return std::allocator<T>::allocate( n );
+  }
+  void deallocate( T * p, std::size_t n )
+  {
+    countedBytes() -= n * sizeof( T );
+    std::allocator<T>::deallocate( p, n );
+  }
+};
+
+typedef std::map< Z3i::Cell, CubicalCellData, std::less<Z3i::Cell>,
+                  CountingAllocator< std::pair<const Z3i::Cell, CubicalCellData> > > CountedCellMap;
+typedef CubicalComplex< Z3i::KSpace, CountedCellMap >            MapComplex3;
+typedef CubicalComplex< Z3i::KSpace, DenseCellMap<Z3i::KSpace> > DenseComplex3;
+
+/// @return the bytes used by the cells of a complex.
+std::size_t cellMemory( const MapComplex3 & )
+{
+  return countedBytes();
+}
+std::size_t cellMemory( const DenseComplex3 & complex )
+{
+  std::size_t bytes = 0;
+  for ( Dimension d = 0; d <= 3; ++d )
+    bytes += complex.getCells( d ).memoryUsage();
+  return bytes;
+}
+
+/// Builds the closure of a ball of radius n in a complex with the
+/// given cell container, and reports the memory held by its cells.
+template <typename TComplex>
+Kernel setupCellMapConstruct( std::int64_t n )
+{
+  auto K = std::make_shared<Z3i::KSpace>();
+  K->init( Z3i::Point::diagonal( -n - 1 ), Z3i::Point::diagonal( n + 1 ), true );
+  auto set = std::make_shared<Z3i::DigitalSet>( Z3i::Domain( K->lowerBound(), K->upperBound() ) );
+  Shapes<Z3i::Domain>::addNorm2Ball( *set, Z3i::Point::diagonal( 0 ), n );
+  {
+    TComplex complex( *K );
+    complex.construct( *set );
+    std::cout << "  cells memory (n=" << n << "): " << cellMemory( complex ) << " bytes for "
+              << complex.size() << " cells" << std::endl;
+  }
+  return [K, set] ()
+    {
+      TComplex complex( *K );
+      complex.construct( *set );
+      return complex.size();
+    };
+}
+
+/// Collapses the closure of a ball of radius n in a complex with the
+/// given cell container, with collapse or indexedCollapse. The items
+/// are the removed cells.
+template <typename TComplex>
+Kernel setupCellMapCollapse( std::int64_t n, bool indexed )
+{
+  auto K = std::make_shared<Z3i::KSpace>();
+  K->init( Z3i::Point::diagonal( -n - 1 ), Z3i::Point::diagonal( n + 1 ), true );
+  Z3i::DigitalSet set( Z3i::Domain( K->lowerBound(), K->upperBound() ) );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point::diagonal( 0 ), n );
+  auto complex = std::make_shared<TComplex>( *K );
+  complex->construct( set );
+  auto S = std::make_shared< std::vector<Z3i::Cell> >();
+  for ( auto it = complex->begin( 3 ), itE = complex->end( 3 ); it != itE; ++it )
+    S->push_back( it->first );
+  return [K, complex, S, indexed] ()
+    {
+      TComplex thin( *complex );
+      typename TComplex::DefaultCellMapIteratorPriority P;
+      return (std::size_t) ( indexed
+        ? functions::indexedCollapse( thin, S->begin(), S->end(), P, false, true )
+        : functions::collapse( thin, S->begin(), S->end(), P, false, true ) );
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Meshes
+///////////////////////////////////////////////////////////////////////////////
+/// Builds a closed n x n x 2 triangulated slab as a Mesh or a
+/// FlatMesh, then converts it to a triangulated surface.
+template <typename TMesh>
+void addSlabVertices( TMesh & mesh, std::int64_t n )
+{
+  for ( std::int64_t z = 0; z < 2; ++z )
+    for ( std::int64_t y = 0; y < n; ++y )
+      for ( std::int64_t x = 0; x < n; ++x )
+        mesh.addVertex( Z3i::RealPoint( x, y, z ) );
+}
+
+template <typename TAddTriangle>
+void forEachSlabTriangle( std::int64_t n, TAddTriangle addTriangle )
+{
+  // Two opposite grids, closed by the n-1 x 1 quads of the border.
+  const unsigned int m = (unsigned int) n;
+  for ( unsigned int z = 0; z < 2; ++z )
+    for ( unsigned int y = 0; y + 1 < m; ++y )
+      for ( unsigned int x = 0; x + 1 < m; ++x )
+        {
+          const unsigned int v = z * m * m + y * m + x;
+          if ( z == 0 )
+            { addTriangle( v, v + m, v + 1 ); addTriangle( v + 1, v + m, v + m + 1 ); }
+          else
+            { addTriangle( v, v + 1, v + m ); addTriangle( v + 1, v + m + 1, v + m ); }
+        }
+  std::vector<unsigned int> border;
+  for ( unsigned int x = 0; x + 1 < m; ++x )         border.push_back( x );
+  for ( unsigned int y = 0; y + 1 < m; ++y )         border.push_back( y * m + m - 1 );
+  for ( unsigned int x = m - 1; x > 0; --x )         border.push_back( ( m - 1 ) * m + x );
+  for ( unsigned int y = m - 1; y > 0; --y )         border.push_back( y * m );
+  for ( std::size_t i = 0; i < border.size(); ++i )
+    {
+      const unsigned int a = border[ i ];
+      const unsigned int b = border[ ( i + 1 ) % border.size() ];
+      addTriangle( a, b, b + m * m );
+      addTriangle( a, b + m * m, a + m * m );
+    }
+}
+
+Kernel setupMeshToTriangulatedSurface( std::int64_t n, bool convert )
+{
+  return [n, convert] ()
+    {
+      Mesh<Z3i::RealPoint> mesh;
+      addSlabVertices( mesh, n );
+      forEachSlabTriangle( n, [&mesh] ( unsigned int a, unsigned int b, unsigned int c )
+                           { mesh.addTriangularFace( a, b, c ); } );
+      if ( ! convert ) return mesh.nbFaces();
+      TriangulatedSurface<Z3i::RealPoint> trisurf;
+      if ( ! MeshHelpers::mesh2TriangulatedSurface( mesh, trisurf ) ) return std::size_t( 0 );
+      return trisurf.nbFaces();
+    };
+}
+
+Kernel setupFlatMeshToTriangulatedSurface( std::int64_t n, bool convert )
+{
+  return [n, convert] ()
+    {
+      FlatMesh<Z3i::RealPoint> mesh;
+      mesh.reserve( 2 * n * n, 4 * n * n );
+      addSlabVertices( mesh, n );
+      forEachSlabTriangle( n, [&mesh] ( unsigned int a, unsigned int b, unsigned int c )
+                           { mesh.addTriangle( a, b, c ); } );
+      if ( ! convert ) return mesh.nbFaces();
+      TriangulatedSurface<Z3i::RealPoint> trisurf;
+      if ( ! MeshHelpers::flatMesh2TriangulatedSurface( std::move( mesh ), trisurf ) )
+        return std::size_t( 0 );
+      return trisurf.nbFaces();
+    };
+}
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> ByteVolume;
+
+/// A gray-scale ball of radius n-2 (255 at the center, 128 on the sphere).
+std::shared_ptr<ByteVolume> makeGrayBall( std::int64_t n )
+{
+  const Z3i::Domain domain( Z3i::Point::diagonal( -n ), Z3i::Point::diagonal( n ) );
+  auto image = std::make_shared<ByteVolume>( domain );
+  const double r = double( n - 2 );
+  for ( auto it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    {
+      const double v = 128.0 + 127.0 * ( r - ( *it ).norm() ) / r;
+      image->setValue( *it, (unsigned char) std::max( 0.0, std::min( 255.0, v ) ) );
+    }
+  return image;
+}
+
+Kernel setupMarchingCubes( std::int64_t n )
+{
+  auto image = makeGrayBall( n );
+  return [image] ()
+    {
+      MarchingCubes<ByteVolume> mc( *image );
+      TriangulatedSurface<Z3i::RealPoint> trisurf;
+      mc.makeTriangulatedSurface( 127.5, trisurf );
+      return trisurf.nbFaces();
+    };
+}
+
+/// The same iso-surface built as the dual of the tracked digital surface.
+Kernel setupDualSurface( std::int64_t n )
+{
+  auto image = makeGrayBall( n );
+  return [image] ()
+    {
+      typedef SetOfSurfels< Z3i::KSpace, Z3i::KSpace::SurfelSet > MySetOfSurfels;
+      typedef DigitalSurface< MySetOfSurfels > MyDigitalSurface;
+      typedef CanonicEmbedder< Z3i::Space > TrivialEmbedder;
+      typedef ImageLinearCellEmbedder< Z3i::KSpace, ByteVolume, TrivialEmbedder > CellEmbedder;
+      const Z3i::Domain& domain = image->domain();
+      Z3i::DigitalSet set( domain );
+      for ( auto it = domain.begin(), itE = domain.end(); it != itE; ++it )
+        if ( (*image)( *it ) > 127 ) set.insertNew( *it );
+      Z3i::KSpace K;
+      K.init( domain.lowerBound(), domain.upperBound(), true );
+      MySetOfSurfels surfels( K, SurfelAdjacency<3>( true ) );
+      Surfaces<Z3i::KSpace>::sMakeBoundary( surfels.surfelSet(), K, set,
+                                            domain.lowerBound(), domain.upperBound() );
+      MyDigitalSurface surface( surfels );
+      TrivialEmbedder trivialEmbedder;
+      CellEmbedder embedder;
+      embedder.init( K, *image, trivialEmbedder, 127.5 );
+      std::map< MyDigitalSurface::Vertex, std::size_t > vmap;
+      TriangulatedSurface<Z3i::RealPoint> trisurf;
+      MeshHelpers::digitalSurface2DualTriangulatedSurface( surface, embedder, trisurf, vmap );
+      return trisurf.nbFaces();
+    };
+}
+
+/// Marching cubes streamed to a counting writer (no surface built).
+struct CountingTriangleWriter
+{
+  std::size_t nbVertices = 0;
+  std::size_t nbTriangles = 0;
+  void addVertex( const Z3i::RealPoint& ) { ++nbVertices; }
+  void addTriangle( std::size_t, std::size_t, std::size_t ) { ++nbTriangles; }
+};
+
+Kernel setupMarchingCubesStream( std::int64_t n )
+{
+  auto image = makeGrayBall( n );
+  return [image] ()
+    {
+      MarchingCubes<ByteVolume> mc( *image );
+      CountingTriangleWriter writer;
+      mc.extract( 127.5, writer );
+      benchmarkDoNotOptimize( writer.nbVertices );
+      return writer.nbTriangles;
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Offscreen rendering
+///////////////////////////////////////////////////////////////////////////////
+/// Renders a digital ball of radius n drawn as cubes or as balls.
+Kernel setupRaster( std::int64_t n, bool asBalls )
+{
+  typedef Board3DRaster<> Raster;
+  const Z3i::Domain domain( Z3i::Point::diagonal( -n ), Z3i::Point::diagonal( n ) );
+  Z3i::DigitalSet set( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point::diagonal( 0 ), n );
+  auto board = std::make_shared<Raster>();
+  if ( asBalls )
+    {
+      for ( auto it = set.begin(), itE = set.end(); it != itE; ++it )
+        board->addBall( Z3i::RealPoint( ( *it )[ 0 ], ( *it )[ 1 ], ( *it )[ 2 ] ), 0.5, 10 );
+      board->setShadingMode( Raster::PhongShading );
+    }
+  else
+    *board << SetMode3D( domain.className(), "Paving" ) << set;
+  board->setCameraDirection( -1.0, -1.0, -1.0 );
+  board->setCameraUpVector( 0.0, 0.0, 1.0 );
+  board->centerCamera();
+  const std::size_t size = set.size();
+  return [board, size] ()
+    {
+      board->render( 512, 512 );
+      benchmarkDoNotOptimize( board->nbRasterizedTriangles() );
+      return size;
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Display3D primitive storage
+///////////////////////////////////////////////////////////////////////////////
+/// A Display3D giving access to the memory used by its cube and ball
+/// lists, and by their packed copies.
+struct MemoryDisplay3D : public Display3D<>
+{
+  std::size_t vectorMemory() const
+  {
+    std::size_t bytes = 0;
+    for ( const auto & list : myCubesMap ) bytes += list.second.capacity() * sizeof( CubeD3D );
+    for ( const auto & list : myBallSetList ) bytes += list.capacity() * sizeof( BallD3D );
+    return bytes;
+  }
+  std::size_t packedMemory() const
+  {
+    std::size_t bytes = 0;
+    for ( const auto & list : myCubesMap )
+      bytes += PackedCubeList( list.second.begin(), list.second.end() ).memoryUsage();
+    for ( const auto & list : myBallSetList )
+      bytes += PackedBallList( list.begin(), list.end() ).memoryUsage();
+    return bytes;
+  }
+  std::size_t nbPrimitives() const
+  {
+    std::size_t nb = 0;
+    for ( const auto & list : myCubesMap ) nb += list.second.size();
+    for ( const auto & list : myBallSetList ) nb += list.size();
+    return nb;
+  }
+};
+
+/// Draws a digital ball of radius n as cubes or as balls, and
+/// reports the memory per primitive of the std::vector lists of the
+/// display and of their PackedPrimitiveList copies. The timed kernel
+/// fills the display and packs its lists.
+Kernel setupDisplayStorage( std::int64_t n, bool asBalls )
+{
+  const Z3i::Domain domain( Z3i::Point::diagonal( -n ), Z3i::Point::diagonal( n ) );
+  auto set = std::make_shared<Z3i::DigitalSet>( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( *set, Z3i::Point::diagonal( 0 ), n );
+  auto fill = [ set, asBalls ] ( MemoryDisplay3D & display )
+    {
+      if ( asBalls )
+        for ( auto it = set->begin(), itE = set->end(); it != itE; ++it )
+          display.addBall( Z3i::RealPoint( ( *it )[ 0 ], ( *it )[ 1 ], ( *it )[ 2 ] ), 0.5, 10 );
+      else
+        display << *set;
+    };
+  {
+    MemoryDisplay3D display;
+    fill( display );
+    const double nb = double( display.nbPrimitives() );
+    std::cout << ( asBalls ? "io/display3d/balls" : "io/display3d/cubes" )
+              << " size=" << n << " primitives=" << display.nbPrimitives()
+              << " bytes/primitive vector=" << double( display.vectorMemory() ) / nb
+              << " packed=" << double( display.packedMemory() ) / nb
+              << std::endl;
+  }
+  return [ set, fill ] ()
+    {
+      MemoryDisplay3D display;
+      fill( display );
+      benchmarkDoNotOptimize( display.packedMemory() );
+      return set->size();
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Distance transformations
+///////////////////////////////////////////////////////////////////////////////
+template <typename Metric>
+Kernel setupDistanceTransformation( std::int64_t n )
+{
+  typedef DistanceTransformation<Z3i::Space, Z3i::DigitalSet, Metric> DT;
+  const Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( n - 1 ) );
+  auto set = std::make_shared<Z3i::DigitalSet>( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( *set, Z3i::Point::diagonal( n / 2 ), n / 3 );
+  auto metric = std::make_shared<Metric>();
+  return [set, metric] ()
+    {
+      DT dt( set->domain(), *set, *metric );
+      benchmarkDoNotOptimize( dt( set->domain().lowerBound() ) );
+      return (std::size_t) set->domain().size();
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Curve estimators
+///////////////////////////////////////////////////////////////////////////////
+Kernel setupTangentEstimator( std::int64_t n )
+{
+  typedef Ball2D<Z2i::Space> Shape;
+  typedef GaussDigitizer<Z2i::Space, Shape> Digitizer;
+  typedef GridCurve<Z2i::KSpace>::PointsRange Range;
+  typedef Range::ConstCirculator ConstCirculator;
+  typedef ArithmeticalDSSComputer<ConstCirculator, int, 4> SegmentComputer;
+  typedef TangentFromDSSEstimator<SegmentComputer> SCEstimator;
+  typedef MostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Estimator;
+
+  Shape ball( 0.0, 0.0, (double) n );
+  Digitizer dig;
+  dig.attach( ball );
+  dig.init( ball.getLowerBound() + Z2i::RealPoint( -1.0, -1.0 ),
+            ball.getUpperBound() + Z2i::RealPoint(  1.0,  1.0 ), 1.0 );
+  Z2i::KSpace K;
+  K.init( dig.getLowerBound(), dig.getUpperBound(), true );
+  SurfelAdjacency<2> SAdj( true );
+  const Z2i::SCell bel = Surfaces<Z2i::KSpace>::findABel( K, dig, 10000 );
+  std::vector<Z2i::Point> points;
+  Surfaces<Z2i::KSpace>::track2DBoundaryPoints( points, K, SAdj, dig, bel );
+  auto curve = std::make_shared< GridCurve<Z2i::KSpace> >();
+  curve->initFromPointsVector( points );
+  return [curve] ()
+    {
+      const Range r = curve->getPointsRange();
+      SegmentComputer sc;
+      SCEstimator f;
+      Estimator e( sc, f );
+      e.init( 1.0, r.c(), r.c() );
+      std::vector<SCEstimator::Quantity> tangents;
+      e.eval( r.c(), r.c(), std::back_inserter( tangents ) );
+      return tangents.size();
+    };
+}
+
+/// Most centered maximal segment tangents along n ball boundaries of
+/// radii 10 to 40, one after the other or with
+/// BatchMostCenteredMaximalSegmentEstimator (all threads).
+Kernel setupBatchTangentEstimator( std::int64_t n, bool batch )
+{
+  typedef Ball2D<Z2i::Space> Shape;
+  typedef GaussDigitizer<Z2i::Space, Shape> Digitizer;
+  typedef GridCurve<Z2i::KSpace> Curve;
+  typedef Curve::PointsRange Range;
+  typedef Range::ConstCirculator ConstCirculator;
+  typedef ArithmeticalDSSComputer<ConstCirculator, int, 4> SegmentComputer;
+  typedef TangentFromDSSEstimator<SegmentComputer> SCEstimator;
+  typedef MostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Estimator;
+  typedef BatchMostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Batch;
+
+  auto curves = std::make_shared< std::vector<Curve> >( n );
+  for ( std::int64_t i = 0; i < n; ++i )
+    {
+      Shape ball( 0.01 * ( i % 97 ), 0.01 * ( i % 89 ), 10.0 + (double) ( i % 31 ) );
+      Digitizer dig;
+      dig.attach( ball );
+      dig.init( ball.getLowerBound() + Z2i::RealPoint( -1.0, -1.0 ),
+                ball.getUpperBound() + Z2i::RealPoint(  1.0,  1.0 ), 1.0 );
+      Z2i::KSpace K;
+      K.init( dig.getLowerBound(), dig.getUpperBound(), true );
+      SurfelAdjacency<2> SAdj( true );
+      const Z2i::SCell bel = Surfaces<Z2i::KSpace>::findABel( K, dig, 10000 );
+      std::vector<Z2i::Point> points;
+      Surfaces<Z2i::KSpace>::track2DBoundaryPoints( points, K, SAdj, dig, bel );
+      ( *curves )[ i ].initFromPointsVector( points );
+    }
+  if ( batch )
+    return [curves] ()
+      {
+        const SegmentComputer sc;
+        const SCEstimator f;
+        Batch b( sc, f );
+        return b.eval( 1.0, curves->begin(), curves->end(),
+                       [] ( const Curve & c ) { return c.getPointsRange(); } );
+      };
+  return [curves] ()
+    {
+      std::size_t nb = 0;
+      for ( const Curve & c : *curves )
+        {
+          const Range r = c.getPointsRange();
+          SegmentComputer sc;
+          SCEstimator f;
+          Estimator e( sc, f );
+          e.init( 1.0, r.c(), r.c() );
+          std::vector<SCEstimator::Quantity> tangents;
+          e.eval( r.c(), r.c(), std::back_inserter( tangents ) );
+          nb += tangents.size();
+        }
+      return nb;
+    };
+}
+
+/// Greedy DSS segmentation of the boundary of a ball of radius n,
+/// point by point or on the Freeman codes.
+Kernel setupGreedyDSS( std::int64_t n, bool onCodes )
+{
+  typedef Ball2D<Z2i::Space> Shape;
+  typedef GaussDigitizer<Z2i::Space, Shape> Digitizer;
+  typedef std::vector<Z2i::Point>::const_iterator ConstIterator;
+  typedef ArithmeticalDSSComputer<ConstIterator, int, 4> SegmentComputer;
+  typedef FreemanDSSRecognizer<int> Recognizer;
+
+  Shape ball( 0.0, 0.0, (double) n );
+  Digitizer dig;
+  dig.attach( ball );
+  dig.init( ball.getLowerBound() + Z2i::RealPoint( -1.0, -1.0 ),
+            ball.getUpperBound() + Z2i::RealPoint(  1.0,  1.0 ), 1.0 );
+  Z2i::KSpace K;
+  K.init( dig.getLowerBound(), dig.getUpperBound(), true );
+  SurfelAdjacency<2> SAdj( true );
+  const Z2i::SCell bel = Surfaces<Z2i::KSpace>::findABel( K, dig, 10000 );
+  auto points = std::make_shared< std::vector<Z2i::Point> >();
+  Surfaces<Z2i::KSpace>::track2DBoundaryPoints( *points, K, SAdj, dig, bel );
+  // The contour is closed by its first point.
+  points->push_back( points->front() );
+  auto chain = std::make_shared< FreemanChain<int> >( *points );
+  if ( onCodes )
+    return [chain] ()
+      {
+        std::vector<Recognizer::DSS> segments;
+        Recognizer::greedySegmentation( *chain, std::back_inserter( segments ) );
+        return chain->chain.size();
+      };
+  return [points] ()
+    {
+      std::size_t nb = 0;
+      for ( ConstIterator it = points->begin(); ; ++nb )
+        {
+          SegmentComputer sc;
+          sc.init( it );
+          while ( ( sc.end() != points->end() ) && sc.extendFront() ) {}
+          if ( sc.end() == points->end() )
+            break;
+          it = sc.end();
+          --it;
+        }
+      benchmarkDoNotOptimize( nb );
+      return points->size() - 1;
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main( int argc, char** argv )
+{
+  BenchmarkRunner runner( argc, argv );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> VectorImage;
+  typedef ImageContainerBySTLMap<Z3i::Domain, int> MapImage;
+  runner.run( "images/STLVector/write", { 32, 64, 128 }, setupImageWrite<VectorImage> );
+  runner.run( "images/STLVector/read",  { 32, 64, 128 }, setupImageRead<VectorImage> );
+  runner.run( "images/STLMap/write",    { 16, 32, 64 },  setupImageWrite<MapImage> );
+  runner.run( "images/STLMap/read",     { 16, 32, 64 },  setupImageRead<MapImage> );
+  runner.run( "images/neighborhood/STLVector", { 32, 64, 128 }, setupNeighborhoodSumSTLVector );
+  runner.run( "images/neighborhood/Bricks",    { 32, 64, 128 }, setupNeighborhoodSumBricks );
+  runner.run( "images/HashTree/setValue", { 16, 32, 64 }, setupHashTreeSetValue );
+  runner.run( "images/HashTree/build",    { 16, 32, 64 }, setupHashTreeBuild );
+  runner.run( "images/HashTree/read",     { 16, 32, 64 }, setupHashTreeRead );
+  runner.run( "images/HashTree/leafScan", { 16, 32, 64 }, setupHashTreeLeafScan );
+
+  typedef DigitalSetBySTLVector<Z3i::Domain> VectorSet;
+  typedef DigitalSetBySTLSet<Z3i::Domain> STLSet;
+  typedef DigitalSetByAssociativeContainer<Z3i::Domain, std::unordered_set<Z3i::Point> > HashSet;
+  runner.run( "sets/STLSet/insert",      { 8, 16, 32 }, setupSetInsert<STLSet> );
+  runner.run( "sets/Unordered/insert",   { 8, 16, 32 }, setupSetInsert<HashSet> );
+  runner.run( "sets/STLVector/insert",   { 4, 8, 12 },  setupSetInsert<VectorSet> );
+  runner.run( "sets/STLSet/find",        { 8, 16, 32 }, setupSetFind<STLSet> );
+  runner.run( "sets/Unordered/find",     { 8, 16, 32 }, setupSetFind<HashSet> );
+
+  runner.run( "surfaces/sMakeBoundary",  { 8, 16, 32 }, setupSurfaceBoundary );
+  runner.run( "surfaces/planeSegmentation/sequential", { 16, 32, 64 },
+              [] ( std::int64_t n ) { return setupPlaneSegmentation( n, 1, 1 ); } );
+  runner.run( "surfaces/planeSegmentation/batch64", { 16, 32, 64 },
+              [] ( std::int64_t n ) { return setupPlaneSegmentation( n, 0, 64 ); } );
+
+  runner.run( "topology/simplePoints/geodesic", { 4, 8 }, [] ( std::int64_t n ) { return setupSimplePoints( n, 0 ); } );
+  runner.run( "topology/simplePoints/cube",     { 8, 16, 32 }, [] ( std::int64_t n ) { return setupSimplePoints( n, 1 ); } );
+  runner.run( "topology/simplePoints/table",    { 8, 16, 32 }, [] ( std::int64_t n ) { return setupSimplePoints( n, 2 ); } );
+  runner.run( "topology/thinning/cube",  { 8, 16 }, [] ( std::int64_t n ) { return setupThinning( n, false ); } );
+  runner.run( "topology/thinning/table", { 8, 16 }, [] ( std::int64_t n ) { return setupThinning( n, true ); } );
+  runner.run( "topology/dirCollapse/sequential", { 4, 8 },
+              [] ( std::int64_t n ) { return setupDirCollapse( n, false ); } );
+  runner.run( "topology/dirCollapse/parallel",   { 4, 8, 16, 32 },
+              [] ( std::int64_t n ) { return setupDirCollapse( n, true ); } );
+  // Balls in 256^3 and 512^3 volumes: several GB for the map-based
+  // complex, and the sequential collapse does not finish there.
+  if ( runner.large() )
+    runner.run( "topology/dirCollapse/parallel/large", { 127, 255 },
+                [] ( std::int64_t n ) { return setupDirCollapse( n, true ); } );
+  runner.run( "topology/cellMap/map/construct",   { 8, 16, 32 }, setupCellMapConstruct<MapComplex3> );
+  runner.run( "topology/cellMap/dense/construct", { 8, 16, 32 }, setupCellMapConstruct<DenseComplex3> );
+  runner.run( "topology/cellMap/map/collapse",    { 4, 8, 16 },
+              [] ( std::int64_t n ) { return setupCellMapCollapse<MapComplex3>( n, false ); } );
+  runner.run( "topology/cellMap/dense/collapse",  { 4, 8, 16 },
+              [] ( std::int64_t n ) { return setupCellMapCollapse<DenseComplex3>( n, false ); } );
+  runner.run( "topology/collapse/indexed/map",    { 4, 8, 16, 32 },
+              [] ( std::int64_t n ) { return setupCellMapCollapse<MapComplex3>( n, true ); } );
+  runner.run( "topology/collapse/indexed/dense",  { 4, 8, 16, 32 },
+              [] ( std::int64_t n ) { return setupCellMapCollapse<DenseComplex3>( n, true ); } );
+
+  runner.run( "meshes/build/Mesh",     { 64, 128, 256 },
+              [] ( std::int64_t n ) { return setupMeshToTriangulatedSurface( n, false ); } );
+  runner.run( "meshes/build/FlatMesh", { 64, 128, 256 },
+              [] ( std::int64_t n ) { return setupFlatMeshToTriangulatedSurface( n, false ); } );
+  runner.run( "meshes/toTriangulatedSurface/Mesh",     { 64, 128 },
+              [] ( std::int64_t n ) { return setupMeshToTriangulatedSurface( n, true ); } );
+  runner.run( "meshes/toTriangulatedSurface/FlatMesh", { 64, 128 },
+              [] ( std::int64_t n ) { return setupFlatMeshToTriangulatedSurface( n, true ); } );
+  runner.run( "meshes/isoSurface/dualDigitalSurface", { 16, 32, 64 }, setupDualSurface );
+  runner.run( "meshes/isoSurface/marchingCubes",      { 16, 32, 64 }, setupMarchingCubes );
+  runner.run( "meshes/isoSurface/marchingCubesStream", { 16, 32, 64, 128 }, setupMarchingCubesStream );
+
+  runner.run( "io/raster/cubes", { 8, 16, 32, 64 }, [] ( std::int64_t n ) { return setupRaster( n, false ); } );
+  runner.run( "io/raster/balls", { 8, 16, 32 },     [] ( std::int64_t n ) { return setupRaster( n, true ); } );
+  runner.run( "io/display3d/cubes", { 16, 32, 64 }, [] ( std::int64_t n ) { return setupDisplayStorage( n, false ); } );
+  runner.run( "io/display3d/balls", { 16, 32, 64 }, [] ( std::int64_t n ) { return setupDisplayStorage( n, true ); } );
+
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 1> L1;
+  runner.run( "distance/DT/L2", { 32, 64, 128 }, setupDistanceTransformation<L2> );
+  runner.run( "distance/DT/L1", { 32, 64, 128 }, setupDistanceTransformation<L1> );
+
+  runner.run( "estimators/MostCenteredMS/tangent", { 100, 1000, 10000 }, setupTangentEstimator );
+  runner.run( "estimators/MostCenteredMS/curves", { 100, 1000, 10000 },
+              [] ( std::int64_t n ) { return setupBatchTangentEstimator( n, false ); } );
+  runner.run( "estimators/MostCenteredMS/batch", { 100, 1000, 10000 },
+              [] ( std::int64_t n ) { return setupBatchTangentEstimator( n, true ); } );
+  runner.run( "geometry/greedyDSS/points", { 1000, 10000, 100000 },
+              [] ( std::int64_t n ) { return setupGreedyDSS( n, false ); } );
+  runner.run( "geometry/greedyDSS/freemanCodes", { 1000, 10000, 100000 },
+              [] ( std::int64_t n ) { return setupGreedyDSS( n, true ); } );
+
+  return runner.finish();
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,140 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file compareBenchmarks.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Compares two JSON files produced by benchmark programs using
+ * DGtalBenchmark.h, and flags the regressions.
+ *
+ * @code
+ * ./compareBenchmarks baseline.json current.json [threshold]
+ * @endcode
+ *
+ * A benchmark is a regression if its median time increased by more
+ * than the relative threshold (default 0.1, i.e. 10%) and by more than
+ * three standard deviations of the baseline. The program returns 1 if
+ * at least one regression is detected, 2 on input error, and 0
+ * otherwise.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+///////////////////////////////////////////////////////////////////////////////
+
+/// Median time and standard deviation of a benchmark.
+struct Timing
+{
+  double median;
+  double stddev;
+};
+
+/// Benchmarks are identified by their name and size.
+typedef std::map< std::pair<std::string, long long>, Timing > Timings;
+
+bool load( const std::string & filename, Timings & timings )
+{
+  boost::property_tree::ptree root;
+  try
+    {
+      boost::property_tree::read_json( filename, root );
+      for ( const auto & child : root.get_child( "benchmarks" ) )
+        {
+          const boost::property_tree::ptree & b = child.second;
+          Timing t;
+          t.median = b.get<double>( "median_ms" );
+          t.stddev = b.get<double>( "stddev_ms", 0.0 );
+          timings[ std::make_pair( b.get<std::string>( "name" ),
+                                   b.get<long long>( "size" ) ) ] = t;
+        }
+    }
+  catch ( const boost::property_tree::ptree_error & e )
+    {
+      std::cerr << "[compareBenchmarks] cannot read " << filename
+                << ": " << e.what() << std::endl;
+      return false;
+    }
+  return true;
+}
+
+int main( int argc, char** argv )
+{
+  if ( argc < 3 )
+    {
+      std::cerr << "Usage: " << argv[ 0 ]
+                << " baseline.json current.json [threshold=0.1]" << std::endl;
+      return 2;
+    }
+  const double threshold = ( argc > 3 ) ? std::atof( argv[ 3 ] ) : 0.1;
+  Timings baseline, current;
+  if ( ! load( argv[ 1 ], baseline ) || ! load( argv[ 2 ], current ) )
+    return 2;
+
+  unsigned int nbRegressions = 0, nbImprovements = 0;
+  for ( const auto & c : current )
+    {
+      const auto b = baseline.find( c.first );
+      std::cout << std::left << std::setw( 48 ) << c.first.first << std::right
+                << " size=" << std::setw( 8 ) << c.first.second;
+      if ( b == baseline.end() )
+        {
+          std::cout << "  (new)" << std::endl;
+          continue;
+        }
+      const double before = b->second.median;
+      const double after  = c.second.median;
+      const double ratio  = before > 0.0 ? after / before : 1.0;
+      std::cout << std::fixed << std::setprecision( 3 )
+                << "  " << std::setw( 10 ) << before << "ms -> "
+                << std::setw( 10 ) << after << "ms  x" << ratio;
+      if ( ratio > 1.0 + threshold && after - before > 3.0 * b->second.stddev )
+        {
+          std::cout << "  REGRESSION";
+          ++nbRegressions;
+        }
+      else if ( ratio < 1.0 - threshold && before - after > 3.0 * c.second.stddev )
+        {
+          std::cout << "  improvement";
+          ++nbImprovements;
+        }
+      std::cout << std::endl;
+    }
+  for ( const auto & b : baseline )
+    if ( current.find( b.first ) == current.end() )
+      std::cout << std::left << std::setw( 48 ) << b.first.first << std::right
+                << " size=" << std::setw( 8 ) << b.first.second << "  (missing)" << std::endl;
+
+  std::cout << nbRegressions << " regression(s), "
+            << nbImprovements << " improvement(s) (threshold "
+            << threshold * 100.0 << "%)" << std::endl;
+  return nbRegressions == 0 ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
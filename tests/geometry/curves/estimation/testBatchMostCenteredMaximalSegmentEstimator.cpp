@@ -0,0 +1,222 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBatchMostCenteredMaximalSegmentEstimator.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class BatchMostCenteredMaximalSegmentEstimator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include "DGtalCatch.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/parametric/Ball2D.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/estimation/MostCenteredMaximalSegmentEstimator.h"
+#include "DGtal/geometry/curves/estimation/SegmentComputerEstimators.h"
+#include "DGtal/geometry/curves/estimation/BatchMostCenteredMaximalSegmentEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef GridCurve<Z2i::KSpace> Curve;
+typedef Curve::PointsRange Range;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BatchMostCenteredMaximalSegmentEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return the boundary of the digitization of a ball.
+Curve ballCurve( double x, double y, double radius )
+{
+  typedef Ball2D<Z2i::Space> Shape;
+  typedef GaussDigitizer<Z2i::Space, Shape> Digitizer;
+  Shape ball( x, y, radius );
+  Digitizer dig;
+  dig.attach( ball );
+  dig.init( ball.getLowerBound() + Z2i::RealPoint( -1.0, -1.0 ),
+            ball.getUpperBound() + Z2i::RealPoint(  1.0,  1.0 ), 1.0 );
+  Z2i::KSpace K;
+  K.init( dig.getLowerBound(), dig.getUpperBound(), true );
+  SurfelAdjacency<2> SAdj( true );
+  const Z2i::SCell bel = Surfaces<Z2i::KSpace>::findABel( K, dig, 10000 );
+  std::vector<Z2i::Point> points;
+  Surfaces<Z2i::KSpace>::track2DBoundaryPoints( points, K, SAdj, dig, bel );
+  Curve curve;
+  curve.initFromPointsVector( points );
+  return curve;
+}
+
+/// The range of points of a curve.
+struct PointsOf
+{
+  Range operator()( const Curve & c ) const { return c.getPointsRange(); }
+};
+
+SCENARIO( "BatchMostCenteredMaximalSegmentEstimator on closed curves", "[batchestimator]" )
+{
+  typedef Range::ConstCirculator ConstCirculator;
+  typedef ArithmeticalDSSComputer<ConstCirculator, int, 4> SegmentComputer;
+  typedef TangentFromDSSEstimator<SegmentComputer> SCEstimator;
+  typedef MostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Estimator;
+  typedef BatchMostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Batch;
+
+  std::vector<Curve> curves;
+  for ( int i = 0; i < 12; ++i )
+    curves.push_back( ballCurve( 0.3 * i, -0.2 * i, 3.0 + 2.5 * i ) );
+  curves.push_back( Curve() );
+
+  const SegmentComputer sc;
+  const SCEstimator sce;
+  Batch batch( sc, sce );
+  REQUIRE( batch.isValid() );
+  REQUIRE( batch.nbCurves() == 0 );
+
+  GIVEN( "The estimations of each curve" ) {
+    const std::size_t nb = batch.eval( 1.0, curves.begin(), curves.end(), PointsOf(), 4 );
+    REQUIRE( batch.isValid() );
+    REQUIRE( batch.nbCurves() == curves.size() );
+    REQUIRE( batch.offsets().size() == curves.size() + 1 );
+    REQUIRE( nb == batch.quantities().size() );
+    THEN( "They are the ones of MostCenteredMaximalSegmentEstimator" ) {
+      bool same = true;
+      for ( std::size_t i = 0; i + 1 < curves.size(); ++i )
+        {
+          const Range r = curves[ i ].getPointsRange();
+          Estimator e( sc, sce );
+          e.init( 1.0, r.c(), r.c() );
+          std::vector<SCEstimator::Quantity> expected;
+          e.eval( r.c(), r.c(), std::back_inserter( expected ) );
+          same = same && ( batch.offsets()[ i + 1 ] - batch.offsets()[ i ] == expected.size() )
+            && std::equal( expected.begin(), expected.end(),
+                           batch.quantities().begin() + batch.offsets()[ i ] );
+        }
+      REQUIRE( same );
+      REQUIRE( batch.offsets()[ curves.size() ] == batch.offsets()[ curves.size() - 1 ] );
+    }
+    THEN( "The covers computed along are the tangential covers" ) {
+      Batch covers( sc, sce );
+      covers.computeTangentialCovers( curves.begin(), curves.end(), PointsOf(), 2 );
+      REQUIRE( covers.segmentOffsets() == batch.segmentOffsets() );
+      REQUIRE( covers.segments() == batch.segments() );
+    }
+    THEN( "They do not depend on the number of threads" ) {
+      Batch sequential( sc, sce );
+      sequential.eval( 1.0, curves.begin(), curves.end(), PointsOf(), 1 );
+      REQUIRE( sequential.offsets() == batch.offsets() );
+      REQUIRE( sequential.quantities() == batch.quantities() );
+    }
+  }
+
+  GIVEN( "The tangential covers of each curve" ) {
+    batch.computeTangentialCovers( curves.begin(), curves.end(), PointsOf(), 3 );
+    REQUIRE( batch.isValid() );
+    REQUIRE( batch.segmentOffsets().size() == curves.size() + 1 );
+    THEN( "They are the maximal segments of SaturatedSegmentation" ) {
+      bool same = true;
+      for ( std::size_t i = 0; i + 1 < curves.size(); ++i )
+        {
+          const Range r = curves[ i ].getPointsRange();
+          SaturatedSegmentation<SegmentComputer> segmentation( r.c(), r.c(), sc );
+          std::size_t k = batch.segmentOffsets()[ i ];
+          for ( SaturatedSegmentation<SegmentComputer>::SegmentComputerIterator
+                  it = segmentation.begin(), itE = segmentation.end(); it != itE; ++it, ++k )
+            {
+              const std::size_t first = std::distance( r.begin(), it->begin().base() );
+              const std::size_t last = std::distance( r.begin(), it->end().base() );
+              same = same && ( k < batch.segmentOffsets()[ i + 1 ] )
+                && ( batch.segments()[ k ].first == first )
+                && ( batch.segments()[ k ].second == last );
+            }
+          same = same && ( k == batch.segmentOffsets()[ i + 1 ] );
+        }
+      REQUIRE( same );
+    }
+    THEN( "Each element of a curve is covered" ) {
+      const std::size_t i = 5;
+      const std::size_t n = curves[ i ].size();
+      std::vector<int> covered( n, 0 );
+      for ( std::size_t k = batch.segmentOffsets()[ i ]; k < batch.segmentOffsets()[ i + 1 ]; ++k )
+        for ( std::size_t j = batch.segments()[ k ].first; j != batch.segments()[ k ].second;
+              j = ( j + 1 ) % n )
+          covered[ j ] = 1;
+      REQUIRE( std::count( covered.begin(), covered.end(), 1 ) == (std::ptrdiff_t) n );
+    }
+  }
+
+  THEN( "A non positive grid step is rejected" ) {
+    REQUIRE_THROWS_AS( batch.eval( 0.0, curves.begin(), curves.end(), PointsOf() ), InputException );
+  }
+}
+
+SCENARIO( "BatchMostCenteredMaximalSegmentEstimator on open ranges", "[batchestimator]" )
+{
+  typedef Range::ConstIterator ConstIterator;
+  typedef ArithmeticalDSSComputer<ConstIterator, int, 4> SegmentComputer;
+  typedef CurvatureFromDSSLengthEstimator<SegmentComputer> SCEstimator;
+  typedef MostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Estimator;
+  typedef BatchMostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Batch;
+
+  std::vector<Curve> curves;
+  for ( int i = 0; i < 5; ++i )
+    curves.push_back( ballCurve( 0.0, 0.0, 4.0 + 3.0 * i ) );
+  const SegmentComputer sc;
+  const SCEstimator sce;
+  Batch batch( sc, sce );
+  batch.eval( 0.5, curves.begin(), curves.end(), PointsOf(), 2 );
+  batch.computeTangentialCovers( curves.begin(), curves.end(), PointsOf(), 2 );
+
+  THEN( "The estimations and covers are the ones of each range" ) {
+    bool same = true;
+    for ( std::size_t i = 0; i < curves.size(); ++i )
+      {
+        const Range r = curves[ i ].getPointsRange();
+        Estimator e( sc, sce );
+        e.init( 0.5, r.begin(), r.end() );
+        std::vector<SCEstimator::Quantity> expected;
+        e.eval( r.begin(), r.end(), std::back_inserter( expected ) );
+        same = same && ( batch.offsets()[ i + 1 ] - batch.offsets()[ i ] == expected.size() )
+          && std::equal( expected.begin(), expected.end(),
+                         batch.quantities().begin() + batch.offsets()[ i ] );
+        // Segments of an open range are ordered and end at most at its end.
+        for ( std::size_t k = batch.segmentOffsets()[ i ]; k < batch.segmentOffsets()[ i + 1 ]; ++k )
+          same = same && ( batch.segments()[ k ].first < batch.segments()[ k ].second )
+            && ( batch.segments()[ k ].second <= expected.size() );
+      }
+    REQUIRE( same );
+    REQUIRE( batch.segments()[ batch.segmentOffsets()[ 1 ] - 1 ].second == curves[ 0 ].size() );
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,206 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFreemanDSSRecognizer.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class FreemanDSSRecognizer against
+ * ArithmeticalDSSComputer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtalCatch.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/FreemanDSSRecognizer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class FreemanDSSRecognizer.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Appends to @a codes the Freeman codes of @a n steps of the standard
+ * DSL of slope @a a / @a b and intercept @a mu, rotated by @a q
+ * quarter turns.
+ */
+void appendDSLCodes( std::string & codes, int a, int b, int mu, int q, int n )
+{
+  // 0 <= r < a + b; a step (1,0) adds a, a step (0,1) subtracts b.
+  DGtal::int64_t r = mu;
+  for ( int i = 0; i < n; ++i )
+    {
+      const bool xStep = ( r < b );
+      r += xStep ? a : -b;
+      codes += char( '0' + ( ( xStep ? 0 : 1 ) + q ) % 4 );
+    }
+}
+
+/**
+ * Greedy segmentation of the points of @a chain with
+ * ArithmeticalDSSComputer.
+ */
+template <typename TInteger>
+std::vector< ArithmeticalDSS<int, TInteger, 4> >
+referenceSegmentation( const FreemanChain<int> & chain )
+{
+  typedef std::vector<Z2i::Point>::const_iterator ConstIterator;
+  std::vector<Z2i::Point> points;
+  FreemanChain<int>::getContourPoints( chain, points );
+  std::vector< ArithmeticalDSS<int, TInteger, 4> > segments;
+  ConstIterator it = points.begin();
+  while ( true )
+    {
+      ArithmeticalDSSComputer<ConstIterator, TInteger, 4> computer;
+      computer.init( it );
+      while ( ( computer.end() != points.end() ) && computer.extendFront() ) {}
+      segments.push_back( computer.primitive() );
+      if ( computer.end() == points.end() )
+        return segments;
+      // The next segment starts at the last point of this one.
+      it = computer.end();
+      --it;
+    }
+}
+
+SCENARIO( "FreemanDSSRecognizer on pieces of digital lines", "[freemandss]" )
+{
+  typedef FreemanDSSRecognizer<int> Recognizer;
+  typedef Recognizer::DSS DSS;
+
+  GIVEN( "Short chains" ) {
+    DSS dss( Z2i::Point( 0, 0 ) );
+    const std::string empty;
+    THEN( "An empty chain is a DSS of one point" ) {
+      std::vector<DSS> segments;
+      REQUIRE( Recognizer::greedySegmentation( Z2i::Point( 3, 4 ), empty.begin(), empty.end(),
+                                               std::back_inserter( segments ) ) == 1 );
+      REQUIRE( segments[ 0 ] == DSS( Z2i::Point( 3, 4 ) ) );
+    }
+    THEN( "One step is a DSS of two points" ) {
+      const std::string codes( "1" );
+      REQUIRE( Recognizer::longestDSS( Z2i::Point( 1, 1 ), codes.begin(), codes.end(), dss ) == codes.end() );
+      REQUIRE( dss.front() == Z2i::Point( 1, 2 ) );
+      REQUIRE( dss.isValid() );
+    }
+    THEN( "Opposite or three steps are not DSSs" ) {
+      const std::string opposite( "0002" );
+      const std::string three( "00100103" );
+      REQUIRE( ! Recognizer::isDSS( opposite.begin(), opposite.end() ) );
+      REQUIRE( ! Recognizer::isDSS( three.begin(), three.end() ) );
+      REQUIRE( Recognizer::longestDSS( Z2i::Point( 0, 0 ), three.begin(), three.end(), dss )
+               == three.begin() + 7 );
+      REQUIRE( dss.a() == 1 );
+      REQUIRE( dss.b() == 2 );
+    }
+    THEN( "Codes other than 0 to 3 are rejected" ) {
+      const std::string bad( "0104" );
+      const std::string negative( "01/" );
+      REQUIRE_THROWS_AS( Recognizer::isDSS( bad.begin(), bad.end() ), InputException );
+      REQUIRE_THROWS_AS( Recognizer::longestDSS( Z2i::Point( 0, 0 ), negative.begin(), negative.end(), dss ),
+                         InputException );
+    }
+  }
+
+  GIVEN( "Pieces of digital lines in the four quadrants" ) {
+    srand( 0 );
+    for ( int i = 0; i < 200; ++i )
+      {
+        const int a = rand() % 50 + 1;
+        const int b = rand() % 50 + 1;
+        std::string codes;
+        appendDSLCodes( codes, a, b, rand() % ( a + b ), rand() % 4, 10 + rand() % 300 );
+        DSS dss( Z2i::Point( 0, 0 ) );
+        INFO( "codes " << codes );
+        REQUIRE( Recognizer::isDSS( codes.begin(), codes.end() ) );
+        Recognizer::longestDSS( Z2i::Point( -7, 12 ), codes.begin(), codes.end(), dss );
+        REQUIRE( dss.isValid() );
+        REQUIRE( dss.front() - dss.back() == FreemanChain<int>( codes, 0, 0 ).totalDisplacement() );
+      }
+  }
+}
+
+SCENARIO( "FreemanDSSRecognizer greedy segmentation equals ArithmeticalDSSComputer", "[freemandss]" )
+{
+  typedef FreemanDSSRecognizer<int> Recognizer;
+
+  GIVEN( "Random polygonal chains" ) {
+    srand( 1 );
+    for ( int i = 0; i < 50; ++i )
+      {
+        std::string codes;
+        for ( int j = 0; j < 20; ++j )
+          {
+            const int a = rand() % 30 + 1;
+            const int b = rand() % 30 + 1;
+            appendDSLCodes( codes, a, b, rand() % ( a + b ), rand() % 4, 1 + rand() % 60 );
+          }
+        // Remove the backtracks, which split any DSS.
+        std::string chain;
+        for ( char c : codes )
+          if ( chain.empty() || ( ( c - chain.back() + 4 ) % 4 != 2 ) )
+            chain += c;
+        FreemanChain<int> fc( chain, 5, -3 );
+        std::vector<Recognizer::DSS> segments;
+        Recognizer::greedySegmentation( fc, std::back_inserter( segments ) );
+        const std::vector< ArithmeticalDSS<int, int, 4> > expected = referenceSegmentation<int>( fc );
+        REQUIRE( segments.size() == expected.size() );
+        bool same = true;
+        for ( std::size_t k = 0; k < segments.size(); ++k )
+          same = same && ( segments[ k ] == expected[ k ] )
+            && ( segments[ k ].Uf() == expected[ k ].Uf() )
+            && ( segments[ k ].Ll() == expected[ k ].Ll() )
+            && ( segments[ k ].steps() == expected[ k ].steps() );
+        REQUIRE( same );
+      }
+  }
+
+  GIVEN( "Segments longer than the 32-bit bound" ) {
+    typedef FreemanDSSRecognizer<int, DGtal::int64_t> Recognizer64;
+    std::string codes;
+    appendDSLCodes( codes, 1234, 54321, 17, 1, 3 * Recognizer64::maxCodes32 );
+    appendDSLCodes( codes, 1, 1, 0, 0, 100 );
+    FreemanChain<int> fc( codes, 0, 0 );
+    std::vector<Recognizer64::DSS> segments;
+    Recognizer64::greedySegmentation( fc, std::back_inserter( segments ) );
+    const std::vector< ArithmeticalDSS<int, DGtal::int64_t, 4> > expected
+      = referenceSegmentation<DGtal::int64_t>( fc );
+    REQUIRE( segments.size() == expected.size() );
+    REQUIRE( segments[ 0 ] == expected[ 0 ] );
+    const Z2i::Vector d = segments[ 0 ].front() - segments[ 0 ].back();
+    REQUIRE( std::abs( d[ 0 ] ) + std::abs( d[ 1 ] ) == 3 * Recognizer64::maxCodes32 );
+    REQUIRE( segments.back() == expected.back() );
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <string>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/Statistic.h"
 #include "DGtal/helpers/StdDefs.h"
@@ -142,13 +143,38 @@ checkGenericPlanes( unsigned int nbplanes, int diameter, unsigned int nbpoints,
 }
 
 
+/**
+ * Recognizes the same random planes (same seed) with the given
+ * internal integer type and outputs the timings.
+ */
+template <typename NaivePlaneComputer>
+bool
+benchmarkPlanes( const std::string & name,
+                 unsigned int nbtries, unsigned int nbpoints, unsigned int diameter )
+{
+  Statistic<double> stats;
+  srand( 0 );
+  trace.beginBlock ( "Testing class COBAGenericNaivePlaneComputer with " + name );
+  bool res = checkGenericPlanes<NaivePlaneComputer>( nbtries, diameter, nbpoints, stats );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  long t = trace.endBlock();
+  stats.terminate();
+  std::cout << name << " " << stats.samples()
+            << " " << nbpoints
+            << " " << diameter 
+            << " " << ( (double) t / (double) stats.samples() )
+            << " " << stats.mean()
+            << " " << stats.variance()
+            << std::endl;
+  return res;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
 int main( int argc, char** argv )
 {
   using namespace Z3i;
-  Statistic<double> stats;
   unsigned int nbtries = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 100;
   unsigned int nbpoints = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 100;
   unsigned int diameter = ( argc > 3 ) ? atoi( argv[ 3 ] ) : 100;
@@ -156,20 +182,18 @@ int main( int argc, char** argv )
   std::cout << "# Test class COBAGenericNaivePlaneComputer. Points are randomly chosen in [-diameter,diameter]^3." << std::endl;
   std::cout << "# Integer nbtries nbpoints diameter time/plane(ms) E(comp) V(comp)" << std::endl;
   
- // Max diameter is ~20 for int32_t, ~500 for int64_t, any with BigInteger.
-  trace.beginBlock ( "Testing class COBAGenericNaivePlaneComputer" );
-  bool res = true 
-    && checkGenericPlanes<COBAGenericNaivePlaneComputer<Z3, DGtal::BigInteger> >( nbtries, diameter, nbpoints, stats );
-  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
-  long t = trace.endBlock();
-  stats.terminate();
-  std::cout << "BigInteger" << " " << stats.samples()
-            << " " << nbpoints
-            << " " << diameter 
-            << " " << ( (double) t / (double) stats.samples() )
-            << " " << stats.mean()
-            << " " << stats.variance()
-            << std::endl;
+  // Max diameter is ~20 for int32_t, ~500 for int64_t, ~500000 for
+  // int128_t, any with BigInteger.
+  bool res = true;
+  if ( diameter <= 500 )
+    res = res && benchmarkPlanes<COBAGenericNaivePlaneComputer<Z3, DGtal::int64_t> >( "int64_t", nbtries, nbpoints, diameter );
+#ifdef WITH_INT128
+  if ( diameter <= 500000 )
+    res = res && benchmarkPlanes<COBAGenericNaivePlaneComputer<Z3, DGtal::int128_t> >( "int128_t", nbtries, nbpoints, diameter );
+#endif
+#ifdef WITH_BIGINTEGER
+  res = res && benchmarkPlanes<COBAGenericNaivePlaneComputer<Z3, DGtal::BigInteger> >( "BigInteger", nbtries, nbpoints, diameter );
+#endif
   return res ? 0 : 1;
 }
 //                                                                           //
@@ -30,6 +30,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Clock.h"
 #include "DGtal/base/Common.h"
 #include "DGtal/math/Statistic.h"
 #include "DGtal/helpers/StdDefs.h"
@@ -52,13 +55,16 @@ Integer getRandomInteger( const Integer & first, const Integer & after_last )
 }
 
 /**
- * Checks the naive plane d <= ax+by+cz <= d + max(|a|,|b|,|c|)-1
+ * Checks the naive plane d <= ax+by+cz <= d + max(|a|,|b|,|c|)-1.
+ * Then queries again every recognized point with isExtendable, as
+ * done when a segmentation revisits the neighbors of a plane, and
+ * stores the time of these queries in \a queryStats.
  */
 template <typename Integer, typename NaivePlaneComputer>
 bool
 checkPlane( Integer a, Integer b, Integer c, Integer d, 
             int diameter, unsigned int nbpoints,
-            Statistic<double> & stats )
+            Statistic<double> & stats, Statistic<double> & queryStats )
 {
   typedef typename NaivePlaneComputer::Point Point;
   typedef typename Point::Component PointInteger;
@@ -82,6 +88,8 @@ checkPlane( Integer a, Integer b, Integer c, Integer d,
   unsigned int nbok = 0;
   unsigned int nbchanges = 0;
   unsigned int complexity = plane.complexity();
+  std::vector<Point> points;
+  points.reserve( nbpoints );
   while ( nb != nbpoints )
     {
       p[ 0 ] = getRandomInteger<PointInteger>( -diameter+1, diameter ); 
@@ -96,6 +104,7 @@ checkPlane( Integer a, Integer b, Integer c, Integer d,
       case 2: p[ 2 ] = NumberTraits<Integer>::castToInt64_t( ic.ceilDiv( d - a * x - b * y, c ) ); break;
       } 
       bool ok = plane.extend( p ); // should be ok
+      points.push_back( p );
       ++nb; nbok += ok ? 1 : 0;
       if ( ! ok )
         {
@@ -109,13 +118,20 @@ checkPlane( Integer a, Integer b, Integer c, Integer d,
         }
     }
   stats.addValue( (double) nbchanges );
-  return nb == nbok;
+  Clock clock;
+  clock.startClock();
+  unsigned int nbin = 0;
+  for ( typename std::vector<Point>::const_iterator it = points.begin(), itE = points.end();
+        it != itE; ++it )
+    nbin += plane.isExtendable( *it ) ? 1 : 0;
+  queryStats.addValue( clock.stopClock() );
+  return ( nb == nbok ) && ( nbin == points.size() );
 }
 
 template <typename NaivePlaneComputer>
 bool
 checkPlanes( unsigned int nbplanes, int diameter, unsigned int nbpoints,
-             Statistic<double> & stats )
+             Statistic<double> & stats, Statistic<double> & queryStats )
 {
   //using namespace Z3i;
   typedef typename NaivePlaneComputer::InternalInteger Integer;
@@ -129,7 +145,7 @@ checkPlanes( unsigned int nbplanes, int diameter, unsigned int nbpoints,
       Integer d = getRandomInteger<Integer>( (Integer) 0, (Integer) diameter / 2 ); 
       if ( ( a != 0 ) || ( b != 0 ) || ( c != 0 ) )
         {
-          ++nb; nbok += checkPlane<Integer, NaivePlaneComputer>( a, b, c, d, diameter, nbpoints, stats ) ? 1 : 0;
+          ++nb; nbok += checkPlane<Integer, NaivePlaneComputer>( a, b, c, d, diameter, nbpoints, stats, queryStats ) ? 1 : 0;
           if ( nb != nbok )
             {
               std::cerr << "[ERROR] for plane " << a << " * x + " 
@@ -142,34 +158,64 @@ checkPlanes( unsigned int nbplanes, int diameter, unsigned int nbpoints,
 }
 
 
+/**
+ * Recognizes the same random planes (same seed) with the given
+ * internal integer type and outputs the timings.
+ */
+template <typename NaivePlaneComputer>
+bool
+benchmarkPlanes( const std::string & name,
+                 unsigned int nbtries, unsigned int nbpoints, unsigned int diameter )
+{
+  Statistic<double> stats;
+  Statistic<double> queryStats;
+  srand( 0 );
+  trace.beginBlock ( "Testing class COBANaivePlaneComputer with " + name );
+  bool res = checkPlanes<NaivePlaneComputer>( nbtries, diameter, nbpoints, stats, queryStats );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  long t = trace.endBlock();
+  stats.terminate();
+  queryStats.terminate();
+  std::cout << name << " " << stats.samples()
+            << " " << nbpoints
+            << " " << diameter 
+            << " " << ( ( (double) t - queryStats.mean() * queryStats.samples() )
+                        / (double) stats.samples() )
+            << " " << stats.mean()
+            << " " << stats.variance()
+            << " " << queryStats.mean()
+            << std::endl;
+  return res;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
 int main( int argc, char** argv )
 {
   using namespace Z3i;
-  Statistic<double> stats;
   unsigned int nbtries = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 100;
   unsigned int nbpoints = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 100;
   unsigned int diameter = ( argc > 3 ) ? atoi( argv[ 3 ] ) : 100;
   std::cout << "# Usage: " << argv[0] << " <nbtries> <nbpoints> <diameter>." << std::endl;
   std::cout << "# Test class COBANaivePlaneComputer. Points are randomly chosen in [-diameter,diameter]^3." << std::endl;
-  std::cout << "# Integer nbtries nbpoints diameter time/plane(ms) E(comp) V(comp)" << std::endl;
+  std::cout << "# Integer nbtries nbpoints diameter time/plane(ms) E(comp) V(comp) queries/plane(ms)" << std::endl;
   
- // Max diameter is ~20 for int32_t, ~500 for int64_t, any with BigInteger.
-  trace.beginBlock ( "Testing class COBANaivePlaneComputer" );
-  bool res = true 
-    && checkPlanes<COBANaivePlaneComputer<Z3, DGtal::BigInteger> >( nbtries, diameter, nbpoints, stats );
-  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
-  long t = trace.endBlock();
-  stats.terminate();
-  std::cout << "BigInteger" << " " << stats.samples()
-            << " " << nbpoints
-            << " " << diameter 
-            << " " << ( (double) t / (double) stats.samples() )
-            << " " << stats.mean()
-            << " " << stats.variance()
-            << std::endl;
+  // Max diameter is ~20 for int32_t, ~500 for int64_t, ~500000 for
+  // int128_t, any with BigInteger.
+  bool res = true;
+  if ( diameter <= 500 )
+  {
+    res = res && benchmarkPlanes<COBANaivePlaneComputer<Z3, DGtal::int64_t> >( "int64_t", nbtries, nbpoints, diameter );
+    res = res && benchmarkPlanes<COBANaivePlaneComputer<Z3, DGtal::int64_t, std::vector<Z3::Point> > >( "int64_t/vector", nbtries, nbpoints, diameter );
+  }
+#ifdef WITH_INT128
+  if ( diameter <= 500000 )
+    res = res && benchmarkPlanes<COBANaivePlaneComputer<Z3, DGtal::int128_t> >( "int128_t", nbtries, nbpoints, diameter );
+#endif
+#ifdef WITH_BIGINTEGER
+  res = res && benchmarkPlanes<COBANaivePlaneComputer<Z3, DGtal::BigInteger> >( "BigInteger", nbtries, nbpoints, diameter );
+#endif
   return res ? 0 : 1;
 }
 //                                                                           //
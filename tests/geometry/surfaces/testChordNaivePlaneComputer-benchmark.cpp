@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <string>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/Statistic.h"
 #include "DGtal/helpers/StdDefs.h"
@@ -133,6 +134,28 @@ checkPlanes( unsigned int nbplanes, unsigned int diameter, unsigned int nbpoints
 }
 
 
+/**
+ * Recognizes the same random planes (same seed) with the given
+ * internal scalar type and outputs the timings.
+ */
+template <typename NaivePlaneComputer>
+bool
+benchmarkPlanes( const std::string & name,
+                 unsigned int nbtries, unsigned int nbpoints, unsigned int diameter )
+{
+  srand( 0 );
+  trace.beginBlock ( "Testing class ChordNaivePlaneComputer with " + name );
+  bool res = checkPlanes<NaivePlaneComputer>( nbtries, diameter, nbpoints );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  long t = trace.endBlock();
+  std::cout << name << " " << nbtries
+            << " " << nbpoints
+            << " " << diameter 
+            << " " << ( (double) t / (double) nbtries )
+            << std::endl;
+  return res;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -146,16 +169,12 @@ int main( int argc, char** argv )
   std::cout << "# Test class ChordNaivePlaneComputer. Points are randomly chosen in [-diameter,diameter]^3." << std::endl;
   std::cout << "# Integer nbtries nbpoints diameter time/plane(ms)" << std::endl;
   
-  trace.beginBlock ( "Testing class ChordNaivePlaneComputer" );
   bool res = true 
-    && checkPlanes<ChordNaivePlaneComputer<Space, Point, DGtal::int64_t> >( nbtries, diameter, nbpoints );
-  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
-  long t = trace.endBlock();
-  std::cout << "int64_t" << " " << nbtries
-            << " " << nbpoints
-            << " " << diameter 
-            << " " << ( (double) t / (double) nbtries )
-            << std::endl;
+    && benchmarkPlanes<ChordNaivePlaneComputer<Space, Point, DGtal::int64_t> >( "int64_t", nbtries, nbpoints, diameter )
+#ifdef WITH_INT128
+    && benchmarkPlanes<ChordNaivePlaneComputer<Space, Point, DGtal::int128_t> >( "int128_t", nbtries, nbpoints, diameter )
+#endif
+    ;
   return res ? 0 : 1;
 }
 //                                                                           //
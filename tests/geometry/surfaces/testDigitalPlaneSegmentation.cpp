@@ -0,0 +1,207 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalPlaneSegmentation.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class DigitalPlaneSegmentation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/geometry/surfaces/DigitalPlaneSegmentation.h"
+
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef DigitalSetBoundary< KSpace, DigitalSet > Container;
+typedef DigitalSurface< Container > MySurface;
+typedef COBANaivePlaneComputer< Z3, DGtal::int64_t > NaivePlaneComputer;
+typedef DigitalPlaneSegmentation< MySurface, NaivePlaneComputer > Segmentation;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalPlaneSegmentation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Greedy segmentation written with a BreadthFirstVisitor, as in
+ * greedy-plane-segmentation.cpp.
+ */
+std::map<SCell, std::size_t>
+referenceSegmentation( const KSpace & K, const MySurface & surface )
+{
+  typedef BreadthFirstVisitor< MySurface > Visitor;
+  std::map<SCell, std::size_t> v2plane;
+  std::size_t nb = 0;
+  for ( MySurface::ConstIterator it = surface.begin(), itE = surface.end(); it != itE; ++it )
+    {
+      if ( v2plane.count( *it ) ) continue;
+      NaivePlaneComputer plane;
+      plane.init( K.sOrthDir( *it ), 500, 1, 1 );
+      Visitor visitor( surface, *it );
+      while ( ! visitor.finished() )
+        {
+          const SCell v = visitor.current().first;
+          const Dimension axis = K.sOrthDir( v );
+          if ( ( v2plane.count( v ) == 0 )
+               && plane.extend( K.sCoords( K.sDirectIncident( v, axis ) ) ) )
+            {
+              v2plane[ v ] = nb;
+              visitor.expand();
+            }
+          else
+            visitor.ignore();
+        }
+      ++nb;
+    }
+  return v2plane;
+}
+
+/**
+ * @return 'true' iff every vertex is in a patch, every patch is a
+ * connected piece of naive plane, and the patch sizes are consistent.
+ */
+template <typename TSegmentation>
+bool isPlaneSegmentation( const TSegmentation & segmentation )
+{
+  typedef typename TSegmentation::PatchId PatchId;
+  typedef typename TSegmentation::Vertex Vertex;
+  typedef typename TSegmentation::Point Point;
+  const std::vector<PatchId> & patches = segmentation.patches();
+  std::vector< std::vector<Point> > points( segmentation.nbPatches() );
+  std::vector<std::size_t> firsts( segmentation.nbPatches(), segmentation.size() );
+  for ( std::size_t i = 0; i < patches.size(); ++i )
+    {
+      if ( patches[ i ] >= segmentation.nbPatches() ) return false;
+      points[ patches[ i ] ].push_back( segmentation.point( i ) );
+      firsts[ patches[ i ] ] = std::min( firsts[ patches[ i ] ], i );
+    }
+  for ( PatchId id = 0; id < segmentation.nbPatches(); ++id )
+    {
+      if ( points[ id ].size() != segmentation.patchSize( id ) ) return false;
+      COBAGenericNaivePlaneComputer< Z3, DGtal::int64_t > plane;
+      plane.init( 500, 1, 1 );
+      if ( ! plane.extend( points[ id ].begin(), points[ id ].end() ) ) return false;
+      // Connectedness: visits the patch from one of its vertices.
+      std::set<Vertex> visited;
+      std::vector<Vertex> queue( 1, segmentation.vertices()[ firsts[ id ] ] );
+      visited.insert( queue.front() );
+      for ( std::size_t head = 0; head < queue.size(); ++head )
+        {
+          std::vector<Vertex> neighbors;
+          std::back_insert_iterator< std::vector<Vertex> > out( neighbors );
+          segmentation.surface().writeNeighbors( out, queue[ head ] );
+          for ( std::size_t k = 0; k < neighbors.size(); ++k )
+            if ( ( segmentation.patch( neighbors[ k ] ) == id )
+                 && visited.insert( neighbors[ k ] ).second )
+              queue.push_back( neighbors[ k ] );
+        }
+      if ( visited.size() != points[ id ].size() ) return false;
+    }
+  return true;
+}
+
+TEST_CASE( "Testing DigitalPlaneSegmentation" )
+{
+  KSpace K;
+  K.init( Point::diagonal( -12 ), Point::diagonal( 12 ), true );
+  DigitalSet aSet( Domain( Point::diagonal( -12 ), Point::diagonal( 12 ) ) );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 9 );
+  Shapes<Domain>::removeNorm2Ball( aSet, Point( 4, 2, 1 ), 4 );
+  SurfelAdjacency<KSpace::dimension> surfAdj( true );
+  MySurface surface( new Container( K, aSet, surfAdj ) );
+
+  Segmentation segmentation( surface );
+  REQUIRE( segmentation.size() == surface.size() );
+  REQUIRE( segmentation.isValid() );
+
+  SECTION( "A batch of size 1 is the sequential greedy segmentation" )
+    {
+      const std::size_t nb = segmentation.segment( 500, 1, 1, 1, 1 );
+      const std::map<SCell, std::size_t> reference = referenceSegmentation( K, surface );
+      bool same = ( reference.size() == surface.size() );
+      std::size_t nbRef = 0;
+      for ( std::map<SCell, std::size_t>::const_iterator it = reference.begin(); it != reference.end(); ++it )
+        {
+          same = same && ( segmentation.patch( it->first ) == it->second );
+          nbRef = std::max( nbRef, it->second + 1 );
+        }
+      REQUIRE( nb == nbRef );
+      REQUIRE( same );
+      REQUIRE( segmentation.nbConflicts() == 0 );
+      REQUIRE( segmentation.nbRounds() == nb );
+      REQUIRE( isPlaneSegmentation( segmentation ) );
+    }
+
+  SECTION( "Batches of seeds give valid segmentations, independent of the number of threads" )
+    {
+      const std::size_t nb = segmentation.segment( 500, 1, 1, 1, 16 );
+      REQUIRE( nb == segmentation.nbPatches() );
+      REQUIRE( segmentation.nbRounds() < nb );
+      REQUIRE( isPlaneSegmentation( segmentation ) );
+      const std::vector<Segmentation::PatchId> patches = segmentation.patches();
+      const std::size_t nbConflicts = segmentation.nbConflicts();
+      segmentation.segment( 500, 1, 1, 4, 16 );
+      REQUIRE( segmentation.patches() == patches );
+      REQUIRE( segmentation.nbConflicts() == nbConflicts );
+      segmentation.segment( 500, 1, 1, 0 );
+      REQUIRE( isPlaneSegmentation( segmentation ) );
+    }
+
+  SECTION( "Segmentation of an indexed digital surface with other plane computers" )
+    {
+      typedef IndexedDigitalSurface< Container > MyIndexedSurface;
+      MyIndexedSurface indexedSurface;
+      REQUIRE( indexedSurface.build( new Container( K, aSet, surfAdj ) ) );
+      DigitalPlaneSegmentation< MyIndexedSurface, NaivePlaneComputer > iseg( indexedSurface );
+      REQUIRE( iseg.size() == surface.size() );
+      REQUIRE( iseg.segment( 500, 1, 1, 2, 8 ) > 0 );
+      REQUIRE( isPlaneSegmentation( iseg ) );
+
+      typedef ChordNaivePlaneComputer< Z3, Point, DGtal::int64_t > ChordComputer;
+      DigitalPlaneSegmentation< MySurface, ChordComputer > cseg( surface );
+      REQUIRE( cseg.segment( 500, 1, 1, 2, 8 ) > 0 );
+      REQUIRE( isPlaneSegmentation( cseg ) );
+
+      typedef COBAGenericStandardPlaneComputer< Z3, DGtal::int64_t > StandardComputer;
+      DigitalPlaneSegmentation< MySurface, StandardComputer > sseg( surface );
+      REQUIRE( sseg.segment( 500, 1, 1, 1, 4 ) > 0 );
+      REQUIRE( sseg.nbPatches() <= segmentation.segment( 500, 1, 1, 1, 4 ) );
+    }
+}
+
+/** @ingroup Tests **/
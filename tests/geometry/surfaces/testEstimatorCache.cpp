@@ -29,7 +29,10 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <sstream>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/OpenAddressingHashMap.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
 #include "ConfigTest.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/surfaces/estimation/EstimatorCache.h"
@@ -184,6 +187,51 @@ bool testEstimatorCache(double h)
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") "
 	       << "cache == eval" << std::endl;
+
+  trace.beginBlock( "Hash map container and parallel init ...");
+  typedef OpenAddressingHashMap< Z3i::KSpace::SCell, MyIICurvatureEstimator::Quantity > FlatMap;
+  typedef EstimatorCache<MyIICurvatureEstimator, FlatMap> FlatCache;
+  BOOST_CONCEPT_ASSERT(( concepts::CSurfelLocalEstimator<FlatCache> ));
+  FlatCache flatCache( curvatureEstimator );
+  std::vector<Z3i::KSpace::SCell> surfels( surf.begin(), surf.end() );
+  flatCache.init( h, surfels.begin(), surfels.end(), 4 );
+  bool flatOk = ( flatCache.size() == cache.size() );
+  for(MyDigitalSurface::ConstIterator it = surf.begin(), itend=surf.end(); it != itend; ++it)
+    flatOk = flatOk && ( flatCache.eval(it) == cache.eval(it) );
+  trace.info() << flatCache << std::endl;
+  trace.endBlock();
+  nbok += flatOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "parallel flat cache == cache" << std::endl;
+
+  trace.beginBlock( "Parallel init with 1 and 4 threads ...");
+  FlatCache flatCache1( curvatureEstimator );
+  flatCache1.init( h, surfels.begin(), surfels.end(), 1 );
+  bool threadsOk = ( flatCache1.size() == flatCache.size() );
+  for(MyDigitalSurface::ConstIterator it = surf.begin(), itend=surf.end(); it != itend; ++it)
+    threadsOk = threadsOk && ( flatCache1.eval(it) == flatCache.eval(it) );
+  trace.endBlock();
+  nbok += threadsOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "1 thread == 4 threads" << std::endl;
+
+  trace.beginBlock( "Serialization ...");
+  std::stringstream stream;
+  bool saveOk = flatCache.save( stream );
+  FlatCache loaded;
+  saveOk = saveOk && loaded.load( stream ) && loaded.isValid();
+  saveOk = saveOk && ( loaded.size() == flatCache.size() ) && ( loaded.h() == h );
+  for(MyDigitalSurface::ConstIterator it = surf.begin(), itend=surf.end(); it != itend; ++it)
+    saveOk = saveOk && ( loaded.eval(it) == cache.eval(it) );
+  std::stringstream garbage( "not a cache" );
+  saveOk = saveOk && ! loaded.load( garbage );
+  trace.endBlock();
+  nbok += saveOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "loaded cache == cache" << std::endl;
   
   return nbok == nb;
 }
@@ -31,6 +31,8 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/volumes/KanungoNoise.h"
+#include "DGtal/geometry/volumes/LightKanungoNoise.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/io/boards/Board2D.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/Shapes.h"
@@ -93,9 +95,72 @@ bool testKanungo2D()
   return nbok == nb;
 }
 
+bool testLightKanungo2D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing LightKanungoNoise ..." );
+
+  Z2i::Domain domain(Z2i::Point(0,0), Z2i::Point(128,128));
+  Z2i::DigitalSet set(domain);
+  Shapes<Z2i::Domain>::addNorm2Ball( set , Z2i::Point(64,64), 30);
+
+  typedef LightKanungoNoise<Z2i::DigitalSet, Z2i::Domain> Noise;
+  Noise noisy( set, domain, 0.5, 42 );
+  Noise noisy2( set, domain, 0.5, 42 );
+  Noise noisy3( set, domain, 0.5, 43 );
+  trace.info() << noisy << std::endl;
+
+  ImageContainerBySTLVector<Z2i::Domain, bool> image( domain );
+  noisy.fill( image );
+
+  bool sameFill = true, sameSeed = true, farPointsOk = true;
+  unsigned int nbDiffSeed = 0, nbIn = 0;
+  for ( auto p : domain )
+    {
+      const bool v = noisy( p );
+      sameFill = sameFill && ( image( p ) == v );
+      sameSeed = sameSeed && ( noisy2( p ) == v );
+      if ( noisy3( p ) != v ) ++nbDiffSeed;
+      if ( v ) ++nbIn;
+      // alpha^(1+d) is negligible far from the border
+      if ( ( p - Z2i::Point(64,64) ).norm() < 15 )
+        farPointsOk = farPointsOk && v;
+      if ( ( p - Z2i::Point(64,64) ).norm() > 45 )
+        farPointsOk = farPointsOk && !v;
+    }
+  nbok += sameFill ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "fill() == operator()" << std::endl;
+  nbok += sameSeed ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same seed, same noise" << std::endl;
+  nbok += ( nbDiffSeed > 0 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "different seeds, different noise (" << nbDiffSeed << ")" << std::endl;
+  nbok += ( noisy.count() == nbIn ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "count() == " << nbIn << std::endl;
+  nbok += farPointsOk ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "points far from the border are unchanged" << std::endl;
+
+  Board2D board;
+  board << domain ;
+  for ( auto p : domain )
+    if ( image( p ) )
+      board << p;
+  board.saveSVG("output-set-lightkanungo-0.5.svg");
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
 bool CheckingConcept()
 {
   BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate < KanungoNoise<Z2i::DigitalSet, Z2i::Domain> > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate < LightKanungoNoise<Z2i::DigitalSet, Z2i::Domain> > ));
   return true;
 }
 
@@ -111,7 +176,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = CheckingConcept() && testKanungo2D(); // && ... other tests
+  bool res = CheckingConcept() && testKanungo2D() && testLightKanungo2D(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
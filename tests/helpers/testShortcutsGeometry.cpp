@@ -0,0 +1,117 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testShortcutsGeometry.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ShortcutsGeometry.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/helpers/ShortcutsGeometry.h"
+
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts< Z3i::KSpace >         SH3;
+typedef ShortcutsGeometry< Z3i::KSpace > SHG3;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ShortcutsGeometry
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "ShortcutsGeometry parallel estimations are identical to sequential ones", "[shortcuts][parallel]" )
+{
+  auto params = SH3::defaultParameters() | SHG3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 0.5 )( "verbose", 0 );
+  auto implicit_shape  = SH3::makeImplicitShape3D( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto bimage          = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeLightDigitalSurface( bimage, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  REQUIRE( surfels.size() > 100 );
+
+  Parameters seq_params = params;
+  Parameters par_params = params;
+  seq_params( "threads", 1 );
+  par_params( "threads", 4 );
+
+  GIVEN( "The true geometry estimators" ) {
+    THEN( "Positions, normals and curvatures are identical" ) {
+      REQUIRE( SHG3::getPositions( implicit_shape, K, surfels, seq_params )
+               == SHG3::getPositions( implicit_shape, K, surfels, par_params ) );
+      REQUIRE( SHG3::getNormalVectors( implicit_shape, K, surfels, seq_params )
+               == SHG3::getNormalVectors( implicit_shape, K, surfels, par_params ) );
+      REQUIRE( SHG3::getMeanCurvatures( implicit_shape, K, surfels, seq_params )
+               == SHG3::getMeanCurvatures( implicit_shape, K, surfels, par_params ) );
+      REQUIRE( SHG3::getGaussianCurvatures( implicit_shape, K, surfels, seq_params )
+               == SHG3::getGaussianCurvatures( implicit_shape, K, surfels, par_params ) );
+    }
+  }
+  GIVEN( "The convolved trivial and VCM normal estimators" ) {
+    THEN( "Normals are identical" ) {
+      auto ct_seq = SHG3::getCTrivialNormalVectors( surface, surfels, seq_params );
+      auto ct_par = SHG3::getCTrivialNormalVectors( surface, surfels, par_params );
+      REQUIRE( ct_seq.size() == surfels.size() );
+      REQUIRE( ct_seq == ct_par );
+      auto vcm_seq = SHG3::getVCMNormalVectors( surface, surfels, seq_params );
+      auto vcm_par = SHG3::getVCMNormalVectors( surface, surfels, par_params );
+      REQUIRE( vcm_seq.size() == surfels.size() );
+      REQUIRE( vcm_seq == vcm_par );
+    }
+  }
+  GIVEN( "The integral invariant estimators" ) {
+    THEN( "Normals and curvatures are identical" ) {
+      auto n_seq = SHG3::getIINormalVectors( bimage, surfels, seq_params );
+      auto n_par = SHG3::getIINormalVectors( bimage, surfels, par_params );
+      REQUIRE( n_seq.size() == surfels.size() );
+      REQUIRE( n_seq == n_par );
+      auto h_seq = SHG3::getIIMeanCurvatures( bimage, surfels, seq_params );
+      auto h_par = SHG3::getIIMeanCurvatures( bimage, surfels, par_params );
+      REQUIRE( h_seq.size() == surfels.size() );
+      REQUIRE( h_seq == h_par );
+      auto g_seq = SHG3::getIIGaussianCurvatures( digitized_shape, surfels, seq_params );
+      auto g_par = SHG3::getIIGaussianCurvatures( digitized_shape, surfels, par_params );
+      REQUIRE( g_seq.size() == surfels.size() );
+      REQUIRE( g_seq == g_par );
+    }
+  }
+  GIVEN( "All available threads" ) {
+    Parameters all_params = params;
+    all_params( "threads", 0 );
+    THEN( "II mean curvatures are identical to sequential ones" ) {
+      REQUIRE( SHG3::getIIMeanCurvatures( bimage, surfels, seq_params )
+               == SHG3::getIIMeanCurvatures( bimage, surfels, all_params ) );
+    }
+  }
+}
+
+/** @ingroup Tests **/
@@ -238,6 +238,95 @@ bool testGetSetVal()
 }
 
 
+/**
+ * Bulk construction, readers, key decoding and leaf scans.
+ *
+ */
+bool testBuildFromImage()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef Z2i::Domain TDomain;
+  typedef TDomain::Point Point;
+  typedef experimental::ImageContainerByHashTree<TDomain, int > Image;
+  typedef ImageContainerBySTLVector<TDomain, int> ImageVector;
+
+  // Not a power of two: the tree covers padding points.
+  TDomain domain( Point( 0, 0 ), Point( 44, 44 ) );
+  ImageVector dense( domain );
+  for ( auto p : domain )
+    dense.setValue( p, ( ( p - Point( 20, 22 ) ).norm() < 12.0 ) ? 3
+                       : ( p[ 0 ] < 8 ? 1 : 0 ) );
+
+  trace.beginBlock ( "Bulk build vs point insertions" );
+  Image bulk( domain, 5, 0 );
+  bulk.buildFromImage( dense );
+  Image incremental( domain, 5, 0 );
+  for ( auto p : domain )
+    incremental.setValue( p, dense( p ) );
+  bool same = true;
+  for ( auto p : domain )
+    same = same && ( bulk( p ) == dense( p ) ) && ( incremental( p ) == dense( p ) );
+  trace.info() << "nodes: bulk=" << bulk.getNbNodes()
+               << " incremental=" << incremental.getNbNodes() << std::endl;
+  nbok += same ? 1 : 0;
+  nb++;
+  nbok += ( bulk.getNbNodes() <= incremental.getNbNodes() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same values, fewer nodes" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Locality cache of readers" );
+  // Splits and merges a leaf, with a new reader after each modification.
+  bool cacheOk = ( Image::Reader( bulk )( Point( 20, 22 ) ) == 3 );
+  bulk.setValue( Point( 20, 22 ), 7 );
+  Image::Reader split( bulk );
+  cacheOk = cacheOk && ( split( Point( 20, 22 ) ) == 7 ) && ( split( Point( 21, 22 ) ) == 3 )
+    && ( bulk( Point( 20, 22 ) ) == 7 );
+  bulk.setValue( Point( 20, 22 ), 3 );
+  Image::Reader merged( bulk );
+  cacheOk = cacheOk && ( merged( Point( 20, 22 ) ) == 3 ) && ( merged( Point( 21, 22 ) ) == 3 );
+  for ( auto p : domain )
+    cacheOk = cacheOk && ( merged( p ) == dense( p ) ) && ( bulk( p ) == dense( p ) );
+  nbok += cacheOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "readers and const accessors agree" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Key decoding and leaf scan" );
+  bool keysOk = true;
+  unsigned int nbLeaves = 0;
+  Image::Size nbPoints = 0;
+  for ( Image::Iterator it = bulk.begin(), itE = bulk.end(); it != itE; ++it )
+    {
+      Point coords;
+      bulk.getCoordinatesFromKey( it.getKey(), coords );
+      int * old = bulk.getCoordinatesFromKey( it.getKey() );
+      keysOk = keysOk && ( old[ 0 ] == coords[ 0 ] ) && ( old[ 1 ] == coords[ 1 ] );
+      delete[] old;
+      const TDomain leaf = bulk.getKeyDomain( it.getKey() );
+      keysOk = keysOk && ( bulk.getKey( leaf.lowerBound() ) >> ( 2 * ( bulk.getDepth()
+               - bulk.getKeyDepth( it.getKey() ) ) ) ) == it.getKey();
+      for ( auto p : leaf )
+        if ( domain.isInside( p ) )
+          keysOk = keysOk && ( dense( p ) == *it );
+      nbPoints += leaf.size();
+      ++nbLeaves;
+    }
+  keysOk = keysOk && ( nbLeaves == bulk.getNbNodes() )
+    && ( nbPoints == (Image::Size) bulk.getSpanSize() * bulk.getSpanSize() );
+  nbok += keysOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "leaves tile the tree" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 bool testBadKeySizes()
 {
   typedef SpaceND<2> SpaceType;
@@ -284,7 +373,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << std::endl;
 
-  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes();  // && ... other tests
+  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBuildFromImage() && testBadKeySizes();  // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
   trace.endBlock();
   return res ? 0 : 1;
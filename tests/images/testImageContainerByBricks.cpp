@@ -0,0 +1,170 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByBricks.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ImageContainerByBricks.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include <numeric>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByBricks.h"
+
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByBricks.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename Image>
+void checkImage( const typename Image::Domain & domain )
+{
+  typedef typename Image::Domain Domain;
+  typedef typename Image::Point Point;
+  typedef typename Image::Vector Vector;
+  typedef ImageContainerBySTLVector<Domain, int> Reference;
+
+  Image image( domain );
+  Reference reference( domain );
+  int v = 0;
+  for ( auto p : domain )
+    {
+      image.setValue( p, v );
+      reference.setValue( p, v );
+      ++v;
+    }
+
+  SECTION( "Values are stored and the storage covers the domain" )
+    {
+      REQUIRE( image.isValid() );
+      REQUIRE( image.storageSize() >= domain.size() );
+      REQUIRE( image.storageSize() % Image::brickVolume == 0 );
+      unsigned int nbErrors = 0;
+      for ( auto p : domain )
+        if ( image( p ) != reference( p ) ) ++nbErrors;
+      REQUIRE( nbErrors == 0 );
+    }
+
+  SECTION( "Ranges follow the domain order" )
+    {
+      REQUIRE( std::equal( image.constRange().begin(), image.constRange().end(),
+                           reference.constRange().begin() ) );
+      std::vector<int> values( domain.size() );
+      std::iota( values.begin(), values.end(), 100 );
+      std::copy( values.begin(), values.end(), image.range().outputIterator() );
+      REQUIRE( image( domain.lowerBound() ) == 100 );
+      REQUIRE( image( domain.upperBound() ) == 100 + (int) domain.size() - 1 );
+    }
+
+  SECTION( "The linear iterator visits every point once, in memory order" )
+    {
+      std::set<Point> visited;
+      typename Image::Size previous = 0;
+      bool increasing = true;
+      bool consistent = true;
+      for ( auto it = image.linearBegin(), itE = image.linearEnd(); it != itE; ++it )
+        {
+          visited.insert( it.point() );
+          increasing = increasing && ( visited.size() == 1 || it.index() > previous );
+          consistent = consistent && ( image.linearized( it.point() ) == it.index() )
+            && ( *it == reference( it.point() ) );
+          previous   = it.index();
+        }
+      REQUIRE( visited.size() == domain.size() );
+      REQUIRE( increasing );
+      REQUIRE( consistent );
+    }
+
+  SECTION( "Neighbor values, inside and across bricks" )
+    {
+      const Domain neighborhood( Point::diagonal( -1 ), Point::diagonal( 1 ) );
+      unsigned int nbErrors = 0;
+      unsigned int nbChecks = 0;
+      for ( auto it = image.linearBegin(), itE = image.linearEnd(); it != itE; ++it )
+        for ( auto n : neighborhood )
+          {
+            const Vector dv = n;
+            if ( ! domain.isInside( it.point() + dv ) ) continue;
+            ++nbChecks;
+            if ( it.neighbor( dv ) != reference( it.point() + dv ) ) ++nbErrors;
+          }
+      REQUIRE( nbChecks > domain.size() );
+      REQUIRE( nbErrors == 0 );
+
+      // Same values with the precomputed offset table.
+      const std::vector<Vector> vectors( neighborhood.begin(), neighborhood.end() );
+      const std::vector<typename Image::Difference> table = image.neighborOffsetTable( vectors );
+      REQUIRE( table.size() == Image::brickVolume * vectors.size() );
+      for ( auto it = image.linearBegin(), itE = image.linearEnd(); it != itE; ++it )
+        for ( unsigned int k = 0; k < vectors.size(); ++k )
+          if ( domain.isInside( it.point() + vectors[ k ] )
+               && image.data()[ it.index() + table[ it.localIndex() * vectors.size() + k ] ]
+                  != reference( it.point() + vectors[ k ] ) )
+            ++nbErrors;
+      REQUIRE( nbErrors == 0 );
+    }
+
+  SECTION( "Linear iterators write values" )
+    {
+      for ( auto it = image.linearBegin(), itE = image.linearEnd(); it != itE; ++it )
+        *it = -reference( it.point() );
+      REQUIRE( image( domain.upperBound() ) == -reference( domain.upperBound() ) );
+    }
+}
+
+TEST_CASE( "Testing ImageContainerByBricks" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< ImageContainerByBricks<Z3i::Domain, int> > ));
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< ImageContainerByBricks<Z2i::Domain, int, 3> > ));
+
+  SECTION( "3D domain not aligned on bricks" )
+    {
+      checkImage< ImageContainerByBricks<Z3i::Domain, int> >
+        ( Z3i::Domain( Z3i::Point( -3, 0, 2 ), Z3i::Point( 6, 5, 12 ) ) );
+    }
+  SECTION( "2D domain with bricks of 8x8 points" )
+    {
+      checkImage< ImageContainerByBricks<Z2i::Domain, int, 3> >
+        ( Z2i::Domain( Z2i::Point( 1, -7 ), Z2i::Point( 20, 9 ) ) );
+    }
+  SECTION( "Domain smaller than a brick" )
+    {
+      checkImage< ImageContainerByBricks<Z3i::Domain, int> >
+        ( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 1, 2, 0 ) ) );
+    }
+}
+
+/** @ingroup Tests **/
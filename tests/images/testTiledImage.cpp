@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <thread>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 
@@ -327,6 +329,283 @@ bool test_range_constRange()
     return nbok == nb;
 }
 
+bool testConcurrentAndPrefetch()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing concurrent reads and prefetching on TiledImage");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    VImage image(Z2i::Domain(Z2i::Point(0,0), Z2i::Point(63,63)));
+
+    int i = 0;
+    long int sum = 0;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+    {
+        *it = i++;
+        sum += *it;
+    }
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    // 8x8 tiles of 8x8 values, at most 6 tiles in memory.
+    const std::size_t tileBytes = 64 * sizeof(int);
+    typedef ImageCacheReadPolicyCLOCK<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyCLOCK;
+    typedef ImageCacheWritePolicyWT<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWT;
+    MyImageCacheReadPolicyCLOCK imageCacheReadPolicyCLOCK(imageFactoryFromImage, 6 * tileBytes);
+    MyImageCacheWritePolicyWT imageCacheWritePolicyWT(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyCLOCK, MyImageCacheWritePolicyWT> MyTiledImage;
+    MyTiledImage tiledImage(imageFactoryFromImage, imageCacheReadPolicyCLOCK, imageCacheWritePolicyWT, 8);
+
+    // Each thread reads the whole image, starting from a different row.
+    const int nbThreads = 4;
+    std::vector<unsigned int> errors(nbThreads, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nbThreads; t++)
+        threads.push_back(std::thread([&tiledImage, &errors, t] ()
+        {
+            for (int k = 0; k < 64; k++)
+                for (int x = 0; x < 64; x++)
+                {
+                    const int y = (k + 16 * t) % 64;
+                    if (tiledImage(Z2i::Point(x, y)) != x + 64 * y)
+                        errors[t]++;
+                }
+        }));
+    for (unsigned int t = 0; t < threads.size(); t++)
+        threads[t].join();
+
+    for (int t = 0; t < nbThreads; t++)
+    {
+        nbok += (errors[t] == 0) ? 1 : 0;
+        nb++;
+    }
+    trace.info() << "Concurrent reads, read cache misses: " << tiledImage.getCacheMissRead()
+                 << ", cache size: " << imageCacheReadPolicyCLOCK.size() << " tiles" << endl;
+    nbok += (imageCacheReadPolicyCLOCK.bytes() <= imageCacheReadPolicyCLOCK.byteBudget()) ? 1 : 0;
+    nb++;
+
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    // Concurrent writes in distinct rows.
+    threads.clear();
+    for (int t = 0; t < nbThreads; t++)
+        threads.push_back(std::thread([&tiledImage, t] ()
+        {
+            for (int x = 0; x < 64; x++)
+                tiledImage.setValue(Z2i::Point(x, 16 * t + 1), -1);
+        }));
+    for (unsigned int t = 0; t < threads.size(); t++)
+        threads[t].join();
+
+    unsigned int nbWritten = 0;
+    for (int t = 0; t < nbThreads; t++)
+        for (int x = 0; x < 64; x++)
+        {
+            nbWritten += (image(Z2i::Point(x, 16 * t + 1)) == -1) ? 1 : 0;
+            image.setValue(Z2i::Point(x, 16 * t + 1), x + 64 * (16 * t + 1));
+        }
+    trace.info() << "Concurrent writes: " << nbWritten << endl;
+    nbok += (nbWritten == 64 * nbThreads) ? 1 : 0;
+    nb++;
+
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    // Traversal with the next 2 tiles prefetched.
+    tiledImage.clearCacheAndResetCacheMisses();
+    tiledImage.setPrefetchDepth(2);
+
+    long int tiledSum = 0;
+    for (MyTiledImage::ConstIterator it = tiledImage.begin(), itend = tiledImage.end(); it != itend; ++it)
+        tiledSum += *it;
+    tiledImage.waitPrefetches();
+
+    trace.info() << "Prefetched traversal, read cache misses: " << tiledImage.getCacheMissRead()
+                 << ", prefetched tiles: " << tiledImage.getPrefetchLoads() << endl;
+    nbok += (tiledSum == sum) ? 1 : 0;
+    nb++;
+    nbok += (tiledImage.getCacheMissRead() + tiledImage.getPrefetchLoads() >= 64) ? 1 : 0;
+    nb++;
+
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+bool testTiles()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing tiles of TiledImage and dirty tiles");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    VImage image(Z2i::Domain(Z2i::Point(0,0), Z2i::Point(31,31)));
+
+    int i = 0;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    typedef ImageCacheReadPolicyFIFO<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyFIFO;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWB;
+    MyImageCacheReadPolicyFIFO imageCacheReadPolicyFIFO(imageFactoryFromImage, 2);
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyFIFO, MyImageCacheWritePolicyWB> MyTiledImage;
+    MyTiledImage tiledImage(imageFactoryFromImage, imageCacheReadPolicyFIFO, imageCacheWritePolicyWB, 4);
+
+    // Tile indices follow the block coords order.
+    trace.info() << "Number of tiles: " << tiledImage.tileCount() << endl;
+    nbok += (tiledImage.tileCount() == 16) ? 1 : 0;
+    nb++;
+    std::size_t index = 0;
+    bool sameOrder = true;
+    for (Z2i::Domain::ConstIterator it = tiledImage.domainBlockCoords().begin(),
+         itend = tiledImage.domainBlockCoords().end(); it != itend; ++it, ++index)
+        sameOrder = sameOrder && (tiledImage.tileCoords(index) == *it)
+          && (tiledImage.tileDomain(index).lowerBound() == tiledImage.findSubDomainFromBlockCoords(*it).lowerBound());
+    nbok += sameOrder ? 1 : 0;
+    nb++;
+
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    // Reading does not write back any tile.
+    MyTiledImage::ConstRange r = tiledImage.constRange();
+    long int sum = 0;
+    for (MyTiledImage::ConstRange::ConstIterator it = r.begin(), itend = r.end(); it != itend; ++it)
+        sum += *it;
+    trace.info() << "Read traversal, flushed tiles: " << imageCacheWritePolicyWB.getFlushCount() << endl;
+    nbok += (sum == 1023 * 1024 / 2 && imageCacheWritePolicyWB.getFlushCount() == 0) ? 1 : 0;
+    nb++;
+
+    // Only the modified tile is written back.
+    tiledImage.setValue(Z2i::Point(1,1), -1);
+    for (MyTiledImage::ConstRange::ConstIterator it = r.begin(), itend = r.end(); it != itend; ++it)
+        sum += *it;
+    trace.info() << "Read traversal after a write, flushed tiles: " << imageCacheWritePolicyWB.getFlushCount() << endl;
+    nbok += (imageCacheWritePolicyWB.getFlushCount() == 1 && image(Z2i::Point(1,1)) == -1) ? 1 : 0;
+    nb++;
+    tiledImage.setValue(Z2i::Point(1,1), 33);
+
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    // Per-tile kernel: doubles the values of each tile.
+    tiledImage.forEachTile( [] ( MyTiledImage::TileView & view )
+      {
+        for (VImage::Range::Iterator it = view.modifiableImage().range().begin(),
+             itend = view.modifiableImage().range().end(); it != itend; ++it)
+          *it *= 2;
+      }, 4 );
+
+    unsigned int nbErrors = 0;
+    for (Z2i::Domain::ConstIterator it = tiledImage.domain().begin(), itend = tiledImage.domain().end(); it != itend; ++it)
+        nbErrors += (tiledImage(*it) == 2 * ((*it)[0] + 32 * (*it)[1])) ? 0 : 1;
+    trace.info() << "Per-tile kernel, errors: " << nbErrors << ", flushed tiles: " << imageCacheWritePolicyWB.getFlushCount() << endl;
+    nbok += (nbErrors == 0) ? 1 : 0;
+    nb++;
+
+    // A view pins its tile while the cache loads other tiles.
+    {
+      MyTiledImage::TileView view = tiledImage.tile(0);
+      for (std::size_t t = 1; t < tiledImage.tileCount(); t++)
+        tiledImage.tile(t);
+      nbok += (view.image()(Z2i::Point(2,0)) == 4) ? 1 : 0;
+      nb++;
+    }
+
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+bool testPinnedIterators()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing iterators pinning their tile and written tiles");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    VImage image(Z2i::Domain(Z2i::Point(0,0), Z2i::Point(31,31)));
+
+    int i = 0;
+    long int sum = 0;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+    {
+        *it = i++;
+        sum += *it;
+    }
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    // A single tile in the cache, while two tiles are prefetched.
+    typedef ImageCacheReadPolicyLAST<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyLAST;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWB;
+    MyImageCacheReadPolicyLAST imageCacheReadPolicyLAST(imageFactoryFromImage);
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyLAST, MyImageCacheWritePolicyWB> MyTiledImage;
+    MyTiledImage tiledImage(imageFactoryFromImage, imageCacheReadPolicyLAST, imageCacheWritePolicyWB, 4);
+    tiledImage.setPrefetchDepth(2);
+
+    // Read-only traversal with the iterators of a non-const image.
+    long int tiledSum = 0;
+    for (MyTiledImage::OutputIterator it = tiledImage.begin(), itend = tiledImage.end(); it != itend; ++it)
+        tiledSum += *it;
+    tiledImage.waitPrefetches();
+    trace.info() << "Read traversal, flushed tiles: " << imageCacheWritePolicyWB.getFlushCount() << endl;
+    nbok += (tiledSum == sum && imageCacheWritePolicyWB.getFlushCount() == 0) ? 1 : 0;
+    nb++;
+
+    // Only the tile written through an iterator is flushed.
+    *tiledImage.begin(Z2i::Point(9,9)) = -5;
+    for (MyTiledImage::OutputIterator it = tiledImage.begin(), itend = tiledImage.end(); it != itend; ++it)
+        tiledSum += *it;
+    tiledImage.waitPrefetches();
+    trace.info() << "Read traversal after a write, flushed tiles: " << imageCacheWritePolicyWB.getFlushCount() << endl;
+    nbok += (imageCacheWritePolicyWB.getFlushCount() == 1 && image(Z2i::Point(9,9)) == -5) ? 1 : 0;
+    nb++;
+    *tiledImage.begin(Z2i::Point(9,9)) = 9 + 32 * 9;
+
+    // Writing traversal, the tiles being evicted by the prefetches.
+    for (MyTiledImage::OutputIterator it = tiledImage.begin(), itend = tiledImage.end(); it != itend; ++it)
+        *it = 2 * (*it);
+    tiledImage.waitPrefetches();
+    unsigned int nbErrors = 0;
+    for (Z2i::Domain::ConstIterator it = tiledImage.domain().begin(), itend = tiledImage.domain().end(); it != itend; ++it)
+        nbErrors += (tiledImage(*it) == 2 * ((*it)[0] + 32 * (*it)[1])) ? 0 : 1;
+    trace.info() << "Write traversal, errors: " << nbErrors << endl;
+    nbok += (nbErrors == 0) ? 1 : 0;
+    nb++;
+
+    // Reverse traversal.
+    long int reverseSum = 0;
+    for (MyTiledImage::ConstReverseIterator it = tiledImage.rbegin(), itend = tiledImage.rend(); it != itend; ++it)
+        reverseSum += *it;
+    nbok += (reverseSum == 2 * sum) ? 1 : 0;
+    nb++;
+
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -338,7 +617,7 @@ int main( int argc, char** argv )
         trace.info() << " " << argv[ i ];
     trace.info() << endl;
 
-    bool res = testSimple() && test3d() && testIterators() && test_range_constRange(); // && ... other tests
+    bool res = testSimple() && test3d() && testIterators() && test_range_constRange() && testConcurrentAndPrefetch() && testTiles() && testPinnedIterators(); // && ... other tests
 
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
@@ -0,0 +1,218 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBoard3DRaster.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class Board3DRaster.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/io/boards/Board3DRaster.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef Board3DRaster<> Raster;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class Board3DRaster.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return the number of pixels of the last rendering that differ from the background.
+unsigned int nbCovered( const Raster & board )
+{
+  unsigned int nb = 0;
+  for ( unsigned int y = 0; y < board.height(); ++y )
+    for ( unsigned int x = 0; x < board.width(); ++x )
+      nb += board.depth( x, y ) < std::numeric_limits<double>::infinity() ? 1 : 0;
+  return nb;
+}
+
+/// @return 'true' iff both boards have the same last rendering.
+bool sameImage( const Raster & b1, const Raster & b2 )
+{
+  if ( b1.width() != b2.width() || b1.height() != b2.height() ) return false;
+  for ( unsigned int y = 0; y < b1.height(); ++y )
+    for ( unsigned int x = 0; x < b1.width(); ++x )
+      if ( b1.pixel( x, y ) != b2.pixel( x, y ) || b1.depth( x, y ) != b2.depth( x, y ) )
+        return false;
+  return true;
+}
+
+/// @return the first covered pixel of the row @a y, from the left.
+unsigned int firstCovered( const Raster & board, unsigned int y )
+{
+  unsigned int x = 0;
+  while ( x + 1 < board.width() && board.depth( x, y ) == std::numeric_limits<double>::infinity() ) ++x;
+  return x;
+}
+
+/// @return the first bytes of a file.
+std::string fileHeader( const std::string & filename, unsigned int size )
+{
+  std::ifstream in( filename.c_str(), std::ios::in | std::ios::binary );
+  std::string header( size, '\0' );
+  in.read( &header[ 0 ], size );
+  return in.good() ? header : std::string();
+}
+
+SCENARIO( "Board3DRaster rendering of a cube", "[board3draster]" )
+{
+  Raster board;
+  board.setCameraPosition( 0.0, 0.0, 10.0 );
+  board.setCameraDirection( 0.0, 0.0, -1.0 );
+  board.setCameraUpVector( 0.0, 1.0, 0.0 );
+  board.setNearFar( 0.1, 100.0 );
+  board << CustomColors3D( Color( 200, 0, 0 ), Color( 200, 0, 0 ) );
+  board << Point( 0, 0, 0 );
+
+  GIVEN( "A red voxel seen from the front" ) {
+    board.render( 64, 48 );
+    THEN( "It covers the center of the image only" ) {
+      REQUIRE( board.isValid() );
+      REQUIRE( board.nbRasterizedTriangles() == 2 );
+      REQUIRE( board.pixel( 0, 0 ) == Color( 255, 255, 255 ) );
+      REQUIRE( board.depth( 0, 0 ) == std::numeric_limits<double>::infinity() );
+      REQUIRE( board.pixel( 32, 24 ).red() > 100 );
+      REQUIRE( board.pixel( 32, 24 ).green() == 0 );
+      REQUIRE( std::fabs( board.depth( 32, 24 ) - 9.5 ) < 1e-4 );
+      // The front face of side 1 at distance 9.5 with a 45 degrees
+      // field of view covers about 6x6 pixels.
+      const unsigned int nb = nbCovered( board );
+      REQUIRE( nb >= 25 );
+      REQUIRE( nb <= 49 );
+    }
+    THEN( "A red voxel hides a green voxel behind it" ) {
+      board << CustomColors3D( Color( 0, 200, 0 ), Color( 0, 200, 0 ) );
+      board << Point( 0, 0, -3 );
+      board.render( 64, 48 );
+      REQUIRE( board.pixel( 32, 24 ).green() == 0 );
+      board.setCameraPosition( 0.0, 0.0, -10.0 );
+      board.setCameraDirection( 0.0, 0.0, 1.0 );
+      board.render( 64, 48 );
+      REQUIRE( board.pixel( 32, 24 ).red() == 0 );
+      REQUIRE( board.pixel( 32, 24 ).green() > 100 );
+      REQUIRE( std::fabs( board.depth( 32, 24 ) - 6.5 ) < 1e-4 );
+    }
+    THEN( "A clipping plane removes it" ) {
+      board << ClippingPlane( 1.0, 0.0, 0.0, -2.0, false );
+      board.render( 64, 48 );
+      REQUIRE( nbCovered( board ) == 0 );
+    }
+  }
+}
+
+SCENARIO( "Board3DRaster rendering of quads, triangles and balls", "[board3draster]" )
+{
+  Raster board;
+  board.setBackgroundColor( Color( 0, 0, 0 ) );
+  board << CustomColors3D( Color( 0, 0, 250 ), Color( 0, 0, 250 ) );
+  board.addQuad( RealPoint( -2, -2, 0 ), RealPoint( 2, -2, 0 ),
+                 RealPoint( 2, 2, 0 ), RealPoint( -2, 2, 0 ) );
+  board.addTriangle( RealPoint( -2, -2, 1 ), RealPoint( 2, -2, 1 ), RealPoint( 0, 2, 1 ) );
+  board.addBall( RealPoint( 10, 0, 0 ), 2.0, 30 );
+  board.setCameraDirection( 0.0, 0.0, -1.0 );
+  board.centerCamera();
+
+  GIVEN( "A scene seen with flat and Phong shading" ) {
+    board.render( 200, 100 );
+    const unsigned int nbFlat = nbCovered( board );
+    const unsigned int xQuad = firstCovered( board, 50 ) + 2;
+    THEN( "Flat shading gives one color per face" ) {
+      REQUIRE( nbFlat > 0 );
+      const Color color = board.pixel( xQuad, 50 );
+      REQUIRE( color.red() == 0 );
+      REQUIRE( color.blue() > 200 );
+      REQUIRE( board.pixel( xQuad + 5, 45 ) == color );
+    }
+    THEN( "Phong shading covers the same pixels and shades the ball" ) {
+      board.setShadingMode( Raster::PhongShading );
+      board.render( 200, 100 );
+      REQUIRE( nbCovered( board ) == nbFlat );
+      // Specular highlight in the middle of the faces.
+      REQUIRE( board.pixel( xQuad, 50 ).red() > 0 );
+      // The ball is darker on its silhouette than on its front.
+      unsigned int x = 199;
+      while ( x > 0 && board.depth( x, 50 ) == std::numeric_limits<double>::infinity() ) --x;
+      REQUIRE( x > 100 );
+      unsigned int xFirst = x;
+      while ( xFirst > 0 && board.depth( xFirst - 1, 50 ) < std::numeric_limits<double>::infinity() ) --xFirst;
+      const unsigned int xBall = ( x + xFirst + 1 ) / 2;
+      REQUIRE( board.pixel( x, 50 ).blue() < board.pixel( xBall, 50 ).blue() );
+    }
+    THEN( "The rendering does not depend on the tile size nor on the number of threads" ) {
+      Raster other;
+      other.setBackgroundColor( Color( 0, 0, 0 ) );
+      other << CustomColors3D( Color( 0, 0, 250 ), Color( 0, 0, 250 ) );
+      other.addQuad( RealPoint( -2, -2, 0 ), RealPoint( 2, -2, 0 ),
+                     RealPoint( 2, 2, 0 ), RealPoint( -2, 2, 0 ) );
+      other.addTriangle( RealPoint( -2, -2, 1 ), RealPoint( 2, -2, 1 ), RealPoint( 0, 2, 1 ) );
+      other.addBall( RealPoint( 10, 0, 0 ), 2.0, 30 );
+      other.setCameraDirection( 0.0, 0.0, -1.0 );
+      other.centerCamera();
+      other.setTileSize( 7 );
+      other.render( 200, 100, 3 );
+      REQUIRE( sameImage( board, other ) );
+    }
+  }
+}
+
+SCENARIO( "Board3DRaster snapshots of a digital set", "[board3draster]" )
+{
+  const Domain domain( Point( -5, -5, -5 ), Point( 5, 5, 5 ) );
+  DigitalSet set( domain );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    if ( ( *it ).norm() <= 4.5 ) set.insertNew( *it );
+  Raster board;
+  board << SetMode3D( domain.className(), "Paving" );
+  board << set;
+  board.setCameraDirection( -1.0, -1.0, -1.0 );
+  board.setCameraUpVector( 0.0, 0.0, 1.0 );
+  board.centerCamera();
+
+  GIVEN( "A digital ball" ) {
+    THEN( "It is saved as PPM and PNG images" ) {
+      REQUIRE( board.saveRaster( "testBoard3DRaster.ppm", Raster::RasterPPM, 160, 120 ) );
+      REQUIRE( fileHeader( "testBoard3DRaster.ppm", 11 ) == "P6\n160 120\n" );
+      REQUIRE( board.saveRaster( "testBoard3DRaster.png", Raster::RasterPNG, 160, 120 ) );
+      REQUIRE( fileHeader( "testBoard3DRaster.png", 4 ) == "\x89PNG" );
+      const unsigned int nb = nbCovered( board );
+      REQUIRE( nb > 160 * 120 / 10 );
+      REQUIRE( nb < 160 * 120 );
+      // Only the visible faces of the voxels are rasterized.
+      REQUIRE( board.nbRasterizedTriangles() <= 6 * set.size() );
+    }
+  }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,212 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedPrimitiveList.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class PackedPrimitiveList and the primitive
+ * lists of Display3D.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/io/Display3D.h"
+#include "DGtal/io/PackedPrimitiveList.h"
+#include "DGtal/shapes/Mesh.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedPrimitiveList.
+///////////////////////////////////////////////////////////////////////////////
+
+/// A Display3D giving access to its primitive lists.
+struct TestDisplay : public Display3D<>
+{
+  CubesMap & cubes() { return myCubesMap; }
+  const QuadsMap & quads() const { return myQuadsMap; }
+  const BallSetList & balls() const { return myBallSetList; }
+
+  /// @return the packed copy of the first cube list.
+  PackedCubeList packedCubes() const
+  {
+    const CubeList & list = myCubesMap.begin()->second;
+    return PackedCubeList( list.begin(), list.end() );
+  }
+
+  /// Distance to the origin, to sort cubes (arguments by value and
+  /// non-const operator, like the comparators of Viewer3D).
+  struct CloserToOrigin
+  {
+    bool operator()( CubeD3D c1, CubeD3D c2 )
+    { return c1.center.norm() < c2.center.norm(); }
+  };
+};
+
+SCENARIO( "PackedPrimitiveList of cubes", "[packedprimitivelist]" )
+{
+  TestDisplay display;
+  display.setFillColor( Color( 10, 20, 30, 40 ) );
+  display.addCube( RealPoint( 3, 0, 0 ), 1.0 );
+  display.addCube( RealPoint( 1, 0.5, -2 ), 1.0 );
+  display.setFillColor( Color( 200, 100, 50 ) );
+  display.addCube( RealPoint( 0, 0, 1 ), 1.0 );
+
+  GIVEN( "Three cubes of the same list" ) {
+    REQUIRE( display.cubes().size() == 1 );
+    TestDisplay::PackedCubeList list = display.packedCubes();
+    THEN( "They are stored with double centers and shared attributes" ) {
+      REQUIRE( list.isValid() );
+      REQUIRE( list.size() == 3 );
+      REQUIRE( list.nbAttributes() == 1 );
+      REQUIRE( list.coordinateArray().size() == 9 );
+      REQUIRE( list.colorArray().size() == 3 );
+      REQUIRE( list.memoryUsage() < sizeof( list ) + 512 );
+    }
+    THEN( "They are read back as CubeD3D" ) {
+      REQUIRE( list[ 1 ].center == RealPoint( 1, 0.5, -2 ) );
+      REQUIRE( list[ 1 ].width == 0.5 );
+      REQUIRE( list[ 1 ].name == display.name3d() );
+      REQUIRE( list[ 1 ].color == Color( 10, 20, 30, 40 ) );
+      REQUIRE( list.back().color == Color( 200, 100, 50 ) );
+      std::size_t nb = 0;
+      for ( const auto & cube : list )
+        nb += ( cube.width == 0.5 ) ? 1 : 0;
+      REQUIRE( nb == 3 );
+      REQUIRE( ( list.begin() + 2 )->center[ 2 ] == 1.0 );
+      REQUIRE( list.end() - list.begin() == 3 );
+      const unsigned char * rgba = reinterpret_cast<const unsigned char*>( &list.colorArray()[ 2 ] );
+      REQUIRE( rgba[ 0 ] == 200 );
+      REQUIRE( rgba[ 2 ] == 50 );
+      REQUIRE( rgba[ 3 ] == 255 );
+    }
+    THEN( "Coordinates keep their double precision" ) {
+      const RealPoint p( 1.0e6 + 0.1, -1.0 / 3.0, 0.1 );
+      display.addCube( p, 1.0 );
+      REQUIRE( display.packedCubes().back().center == p );
+    }
+    THEN( "A cube can be replaced" ) {
+      auto cube = list[ 0 ];
+      cube.color = Color( 1, 2, 3 );
+      cube.width = 3.0;
+      list.set( 0, cube );
+      REQUIRE( list.isValid() );
+      REQUIRE( list.nbAttributes() == 2 );
+      REQUIRE( list[ 0 ].color == Color( 1, 2, 3 ) );
+      REQUIRE( list[ 0 ].width == 3.0 );
+      REQUIRE( list[ 0 ].center == RealPoint( 3, 0, 0 ) );
+      REQUIRE( list[ 1 ].width == 0.5 );
+    }
+    THEN( "Different widths are stored per cube" ) {
+      display.addCube( RealPoint( 5, 5, 5 ), 4.0 );
+      const TestDisplay::PackedCubeList l = display.packedCubes();
+      REQUIRE( l.isValid() );
+      REQUIRE( l.nbAttributes() == 2 );
+      REQUIRE( l[ 0 ].width == 0.5 );
+      REQUIRE( l[ 3 ].width == 2.0 );
+      REQUIRE( l[ 3 ].center == RealPoint( 5, 5, 5 ) );
+    }
+    THEN( "Sorting permutes all the columns" ) {
+      display.addCube( RealPoint( 5, 5, 5 ), 4.0 );
+      TestDisplay::PackedCubeList l = display.packedCubes();
+      l.sort( TestDisplay::CloserToOrigin() );
+      REQUIRE( l.isValid() );
+      REQUIRE( l[ 0 ].center == RealPoint( 0, 0, 1 ) );
+      REQUIRE( l[ 0 ].color == Color( 200, 100, 50 ) );
+      REQUIRE( l[ 3 ].center == RealPoint( 5, 5, 5 ) );
+      REQUIRE( l[ 3 ].width == 2.0 );
+      REQUIRE( l[ 2 ].width == 0.5 );
+    }
+  }
+
+  GIVEN( "The cube lists of the display" ) {
+    TestDisplay::CubeList & cubes = display.cubes().begin()->second;
+    THEN( "They stay mutable vectors" ) {
+      cubes[ 0 ].color = Color( 1, 2, 3 );
+      std::sort( cubes.begin(), cubes.end(), TestDisplay::CloserToOrigin() );
+      REQUIRE( cubes[ 0 ].center == RealPoint( 0, 0, 1 ) );
+      REQUIRE( cubes[ 2 ].color == Color( 1, 2, 3 ) );
+      REQUIRE( display.packedCubes()[ 2 ].color == Color( 1, 2, 3 ) );
+    }
+    THEN( "The mesh export is unchanged" ) {
+      Mesh<RealPoint> mesh;
+      display.exportToMesh( mesh );
+      REQUIRE( mesh.nbVertex() == 3 * 8 );
+      REQUIRE( mesh.nbFaces() == 3 * 6 );
+    }
+  }
+}
+
+SCENARIO( "PackedPrimitiveList of quads and balls", "[packedprimitivelist]" )
+{
+  TestDisplay display;
+  display.setFillColor( Color( 0, 255, 0 ) );
+  display.addQuad( RealPoint( 0, 0, 0 ), RealPoint( 1, 0, 0 ),
+                   RealPoint( 1, 1, 0 ), RealPoint( 0, 1, 0 ) );
+  display.addBall( RealPoint( 1, 2, 3 ), 0.25, 8 );
+  display.addBall( RealPoint( 4, 5, 6 ), 0.25, 8 );
+  display.setName3d( 7 );
+  display.addBall( RealPoint( 7, 8, 9 ), 0.5, 16 );
+
+  THEN( "Quads keep their vertices and normal" ) {
+    REQUIRE( display.quads().size() == 1 );
+    const TestDisplay::QuadList & list = display.quads().begin()->second;
+    const TestDisplay::PackedQuadList quads( list.begin(), list.end() );
+    REQUIRE( quads.size() == 1 );
+    REQUIRE( quads.coordinateArray().size() == 15 );
+    REQUIRE( quads[ 0 ].point3 == RealPoint( 1, 1, 0 ) );
+    REQUIRE( quads[ 0 ].nz != 0.0 );
+    REQUIRE( quads[ 0 ].color == Color( 0, 255, 0 ) );
+  }
+  THEN( "Balls keep their attributes, with per-ball names when needed" ) {
+    REQUIRE( display.balls().size() == 1 );
+    const TestDisplay::BallList & list = display.balls()[ 0 ];
+    const TestDisplay::PackedBallList balls( list.begin(), list.end() );
+    REQUIRE( balls.isValid() );
+    REQUIRE( balls.size() == 3 );
+    REQUIRE( balls.nbAttributes() == 2 );
+    REQUIRE( balls[ 1 ].radius == 0.25 );
+    REQUIRE( balls[ 1 ].resolution == 8 );
+    REQUIRE( balls[ 1 ].center == RealPoint( 4, 5, 6 ) );
+    REQUIRE( balls[ 2 ].name == 7 );
+    REQUIRE( balls[ 2 ].resolution == 16 );
+    REQUIRE( balls.at( 2 )[ 0 ] == 7.0 );
+    REQUIRE( ! balls[ 2 ].isSigned );
+  }
+  THEN( "Clearing the display empties the lists" ) {
+    display.clear();
+    REQUIRE( display.balls().empty() );
+    REQUIRE( display.quads().empty() );
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
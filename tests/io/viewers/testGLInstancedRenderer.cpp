@@ -0,0 +1,402 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testGLInstancedRenderer.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class GLInstancedRenderer. The rendering
+ * tests use an offscreen EGL context (e.g. the Mesa software
+ * rasterizer) and are skipped when none can be created.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/io/viewers/GLInstancedRenderer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef GLInstancedRenderer<> Renderer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class GLInstancedRenderer.
+///////////////////////////////////////////////////////////////////////////////
+
+/// A Display3D giving access to its cube and ball lists.
+struct TestDisplay : public Display3D<>
+{
+  const CubesMap & cubes() const { return myCubesMap; }
+  const std::vector< std::vector<BallD3D> > & balls() const { return myBallSetList; }
+};
+
+/// An offscreen OpenGL context (EGL pbuffer), current while it lives.
+struct OffscreenContext
+{
+  EGLDisplay display = EGL_NO_DISPLAY;
+  EGLSurface surface = EGL_NO_SURFACE;
+  EGLContext context = EGL_NO_CONTEXT;
+
+  OffscreenContext( int width, int height )
+  {
+    display = eglGetDisplay( EGL_DEFAULT_DISPLAY );
+    if ( display == EGL_NO_DISPLAY || ! eglInitialize( display, 0, 0 ) )
+      {
+        // Without a window system, try the Mesa surfaceless platform.
+        PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+          reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>( eglGetProcAddress( "eglGetPlatformDisplayEXT" ) );
+        display = getPlatformDisplay != 0
+          ? getPlatformDisplay( EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, 0 )
+          : EGL_NO_DISPLAY;
+        if ( display == EGL_NO_DISPLAY || ! eglInitialize( display, 0, 0 ) )
+          {
+            display = EGL_NO_DISPLAY;
+            return;
+          }
+      }
+    const EGLint configAttributes[] = { EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                                        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                                        EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8,
+                                        EGL_DEPTH_SIZE, 16, EGL_NONE };
+    EGLConfig config;
+    EGLint nbConfigs = 0;
+    if ( ! eglChooseConfig( display, configAttributes, &config, 1, &nbConfigs ) || nbConfigs == 0 )
+      return;
+    const EGLint surfaceAttributes[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+    surface = eglCreatePbufferSurface( display, config, surfaceAttributes );
+    eglBindAPI( EGL_OPENGL_API );
+    context = eglCreateContext( display, config, EGL_NO_CONTEXT, 0 );
+    if ( surface == EGL_NO_SURFACE || context == EGL_NO_CONTEXT
+         || ! eglMakeCurrent( display, surface, surface, context ) )
+      context = EGL_NO_CONTEXT;
+  }
+
+  ~OffscreenContext()
+  {
+    if ( display == EGL_NO_DISPLAY ) return;
+    eglMakeCurrent( display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT );
+    if ( context != EGL_NO_CONTEXT ) eglDestroyContext( display, context );
+    if ( surface != EGL_NO_SURFACE ) eglDestroySurface( display, surface );
+    eglTerminate( display );
+  }
+
+  bool isValid() const { return context != EGL_NO_CONTEXT; }
+
+  static void * getProcAddress( const char * name )
+  {
+    return reinterpret_cast<void*>( eglGetProcAddress( name ) );
+  }
+};
+
+/// Reads the 64x64 framebuffer (rows from the bottom).
+std::vector<unsigned char> readPixels()
+{
+  std::vector<unsigned char> pixels( 64 * 64 * 4 );
+  glReadPixels( 0, 0, 64, 64, GL_RGBA, GL_UNSIGNED_BYTE, &pixels[ 0 ] );
+  return pixels;
+}
+
+/// @return the color of the pixel covering (x,y) in [-4,4]^2.
+Color pixelAt( const std::vector<unsigned char> & pixels, double x, double y )
+{
+  const unsigned int i = static_cast<unsigned int>( ( x + 4.0 ) * 8.0 );
+  const unsigned int j = static_cast<unsigned int>( ( y + 4.0 ) * 8.0 );
+  const unsigned char * p = &pixels[ 4 * ( j * 64 + i ) ];
+  return Color( p[ 0 ], p[ 1 ], p[ 2 ] );
+}
+
+/// @return the number of non black pixels.
+unsigned int nbCovered( const std::vector<unsigned char> & pixels )
+{
+  unsigned int nb = 0;
+  for ( unsigned int i = 0; i < pixels.size(); i += 4 )
+    nb += ( pixels[ i ] | pixels[ i + 1 ] | pixels[ i + 2 ] ) != 0 ? 1 : 0;
+  return nb;
+}
+
+/// Draws a cube with the fixed pipeline, as the display lists of Viewer3D.
+void drawFixedCube( const RealPoint & center, double side )
+{
+  const double h = side / 2.0;
+  const double x0 = center[ 0 ] - h, x1 = center[ 0 ] + h;
+  const double y0 = center[ 1 ] - h, y1 = center[ 1 ] + h;
+  const double z0 = center[ 2 ] - h, z1 = center[ 2 ] + h;
+  glBegin( GL_QUADS );
+  glNormal3d( 0, 0, 1 );
+  glVertex3d( x0, y0, z1 ); glVertex3d( x1, y0, z1 ); glVertex3d( x1, y1, z1 ); glVertex3d( x0, y1, z1 );
+  glNormal3d( 0, 0, -1 );
+  glVertex3d( x0, y0, z0 ); glVertex3d( x0, y1, z0 ); glVertex3d( x1, y1, z0 ); glVertex3d( x1, y0, z0 );
+  glNormal3d( 1, 0, 0 );
+  glVertex3d( x1, y0, z0 ); glVertex3d( x1, y1, z0 ); glVertex3d( x1, y1, z1 ); glVertex3d( x1, y0, z1 );
+  glNormal3d( -1, 0, 0 );
+  glVertex3d( x0, y0, z0 ); glVertex3d( x0, y0, z1 ); glVertex3d( x0, y1, z1 ); glVertex3d( x0, y1, z0 );
+  glNormal3d( 0, 1, 0 );
+  glVertex3d( x0, y1, z0 ); glVertex3d( x0, y1, z1 ); glVertex3d( x1, y1, z1 ); glVertex3d( x1, y1, z0 );
+  glNormal3d( 0, -1, 0 );
+  glVertex3d( x0, y0, z0 ); glVertex3d( x1, y0, z0 ); glVertex3d( x1, y0, z1 ); glVertex3d( x0, y0, z1 );
+  glEnd();
+}
+
+/// Clears the framebuffer and sets an orthographic view of [-4,4]^2.
+void setupView( bool unlit )
+{
+  glViewport( 0, 0, 64, 64 );
+  glClearColor( 0.0f, 0.0f, 0.0f, 1.0f );
+  glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+  glEnable( GL_DEPTH_TEST );
+  glMatrixMode( GL_PROJECTION );
+  glLoadIdentity();
+  glOrtho( -4.0, 4.0, -4.0, 4.0, -10.0, 10.0 );
+  glMatrixMode( GL_MODELVIEW );
+  glLoadIdentity();
+  const GLfloat zero[ 4 ] = { 0.0f, 0.0f, 0.0f, 1.0f };
+  const GLfloat one[ 4 ] = { 1.0f, 1.0f, 1.0f, 1.0f };
+  const GLfloat diffuse[ 4 ] = { 0.7f, 0.7f, 0.7f, 1.0f };
+  const GLfloat position[ 4 ] = { 0.0f, 0.0f, 1.0f, 0.0f };
+  glLightModelfv( GL_LIGHT_MODEL_AMBIENT, zero );
+  glLightfv( GL_LIGHT0, GL_AMBIENT, unlit ? one : zero );
+  glLightfv( GL_LIGHT0, GL_DIFFUSE, unlit ? zero : diffuse );
+  glLightfv( GL_LIGHT0, GL_SPECULAR, zero );
+  glLightfv( GL_LIGHT0, GL_POSITION, position );
+}
+
+SCENARIO( "GLInstancedRenderer packing of streamed lists", "[glinstancedrenderer]" )
+{
+  TestDisplay display;
+  Renderer renderer;
+  display.setFillColor( Color( 255, 0, 0 ) );
+  display.addCube( RealPoint( 0, 0, 0 ), 2.0 );
+  display.addCube( RealPoint( 1, 0, 0 ), 2.0 );
+
+  GIVEN( "Two cubes" ) {
+    REQUIRE( ! renderer.sync( display.cubes(), display.balls() ) );
+    THEN( "They are packed in one range" ) {
+      REQUIRE( renderer.isValid() );
+      REQUIRE( renderer.nbAppendedInstances() == 2 );
+      const Renderer::InstanceArrays & cubes = renderer.cubeInstances();
+      REQUIRE( cubes.size() == 2 );
+      REQUIRE( cubes.ranges.size() == 1 );
+      REQUIRE( cubes.ranges[ 0 ].count == 2 );
+      REQUIRE( cubes.geometry[ 4 ] == 1.0f );
+      REQUIRE( cubes.geometry[ 7 ] == 1.0f );
+      const unsigned char * rgba = reinterpret_cast<const unsigned char*>( &cubes.colors[ 1 ] );
+      REQUIRE( rgba[ 0 ] == 255 );
+      REQUIRE( rgba[ 1 ] == 0 );
+      REQUIRE( rgba[ 3 ] == 255 );
+    }
+    THEN( "Streamed objects are appended" ) {
+      display.addCube( RealPoint( 2, 0, 0 ), 2.0 );
+      REQUIRE( ! renderer.sync( display.cubes(), display.balls() ) );
+      REQUIRE( renderer.nbAppendedInstances() == 1 );
+      REQUIRE( renderer.cubeInstances().ranges.size() == 1 );
+
+      const DGtal::int32_t name = display.createNewCubeList();
+      display.setFillColor( Color( 0, 255, 0 ) );
+      display.addCube( RealPoint( 0, 3, 0 ), 2.0 );
+      display.addBall( RealPoint( 0, 0, 3 ), 0.5, 10 );
+      display.addBall( RealPoint( 1, 0, 3 ), 0.5, 10 );
+      display.addBall( RealPoint( 2, 0, 3 ), 0.5, 20 );
+      REQUIRE( ! renderer.sync( display.cubes(), display.balls() ) );
+      REQUIRE( renderer.nbAppendedInstances() == 4 );
+      REQUIRE( renderer.cubeInstances().size() == 4 );
+      REQUIRE( renderer.cubeInstances().ranges.size() == 2 );
+      REQUIRE( renderer.cubeInstances().ranges[ 1 ].name == name );
+      REQUIRE( renderer.ballInstances().size() == 3 );
+      REQUIRE( renderer.ballInstances().ranges.size() == 2 );
+      REQUIRE( renderer.ballInstances().ranges[ 1 ].resolution == 20 );
+      REQUIRE( ! renderer.sync( display.cubes(), display.balls() ) );
+      REQUIRE( renderer.nbAppendedInstances() == 0 );
+
+      // Deleting a list rebuilds the arrays.
+      REQUIRE( display.deleteCubeList( name ) );
+      REQUIRE( renderer.sync( display.cubes(), display.balls() ) );
+      REQUIRE( renderer.cubeInstances().size() == 3 );
+      REQUIRE( renderer.cubeInstances().ranges.size() == 1 );
+      REQUIRE( renderer.ballInstances().size() == 3 );
+    }
+    THEN( "Replaced objects are detected" ) {
+      display.clear();
+      display.addCube( RealPoint( 5, 0, 0 ), 2.0 );
+      display.addCube( RealPoint( 6, 0, 0 ), 2.0 );
+      REQUIRE( renderer.sync( display.cubes(), display.balls() ) );
+      REQUIRE( renderer.cubeInstances().geometry[ 0 ] == 5.0f );
+      renderer.invalidate();
+      REQUIRE( renderer.sync( display.cubes(), display.balls() ) );
+      REQUIRE( renderer.cubeInstances().size() == 2 );
+    }
+    THEN( "Interleaved streaming keeps a bounded number of ranges" ) {
+      const DGtal::int32_t first = display.name3d();
+      const DGtal::int32_t second = display.createNewCubeList();
+      for ( int i = 0; i < 200; ++i )
+        {
+          display.setName3d( i % 2 == 0 ? first : second );
+          display.addCube( RealPoint( i, 1, 0 ), 1.0 );
+          renderer.sync( display.cubes(), display.balls() );
+        }
+      REQUIRE( renderer.cubeInstances().size() == 202 );
+      REQUIRE( renderer.cubeInstances().ranges.size() <= 4 * 2 + 64 + 1 );
+      REQUIRE( renderer.isValid() );
+    }
+  }
+}
+
+SCENARIO( "GLInstancedRenderer offscreen rendering", "[glinstancedrenderer]" )
+{
+  OffscreenContext offscreen( 64, 64 );
+  if ( ! offscreen.isValid() )
+    {
+      WARN( "No offscreen OpenGL context, rendering tests skipped." );
+      return;
+    }
+  Renderer renderer;
+  const bool initialized = renderer.initializeGL( &OffscreenContext::getProcAddress );
+  INFO( renderer.glError() );
+  REQUIRE( initialized );
+
+  TestDisplay display;
+  display.setFillColor( Color( 255, 0, 0 ) );
+  display.addCube( RealPoint( 0, 0, 0 ), 2.0 );
+  const DGtal::int32_t red = display.name3d();
+  renderer.sync( display.cubes(), display.balls() );
+
+  GIVEN( "A red cube of side 2 seen without shading" ) {
+    setupView( true );
+    renderer.draw();
+    std::vector<unsigned char> pixels = readPixels();
+    THEN( "It covers 16x16 pixels" ) {
+      REQUIRE( pixelAt( pixels, 0.0, 0.0 ) == Color( 255, 0, 0 ) );
+      REQUIRE( pixelAt( pixels, 1.5, 0.0 ) == Color( 0, 0, 0 ) );
+      REQUIRE( nbCovered( pixels ) == 16 * 16 );
+      REQUIRE( renderer.nbUploadedInstances() == 1 );
+    }
+    THEN( "Streamed cubes and balls are uploaded incrementally" ) {
+      const DGtal::int32_t green = display.createNewCubeList();
+      display.setFillColor( Color( 0, 255, 0 ) );
+      display.addCube( RealPoint( 2.5, 0, 0 ), 1.0 );
+      display.setFillColor( Color( 0, 0, 255 ) );
+      display.addBall( RealPoint( -2.5, 2.5, 0 ), 1.0, 30 );
+      renderer.sync( display.cubes(), display.balls() );
+      setupView( true );
+      renderer.draw( green, 150 );
+      pixels = readPixels();
+      REQUIRE( renderer.nbUploadedInstances() == 3 );
+      REQUIRE( pixelAt( pixels, 0.0, 0.0 ) == Color( 255, 0, 0 ) );
+      // The selected list has shifted colors.
+      REQUIRE( pixelAt( pixels, 2.5, 0.0 ) == Color( 150, 255, 150 ) );
+      REQUIRE( pixelAt( pixels, -2.5, 2.5 ) == Color( 0, 0, 255 ) );
+      const unsigned int nbBall = nbCovered( pixels ) - 16 * 16 - 8 * 8;
+      REQUIRE( std::fabs( nbBall - M_PI * 64.0 ) < 0.1 * M_PI * 64.0 );
+
+      setupView( true );
+      renderer.draw( red, 150 );
+      pixels = readPixels();
+      REQUIRE( pixelAt( pixels, 0.0, 0.0 ) == Color( 255, 150, 150 ) );
+      REQUIRE( pixelAt( pixels, 2.5, 0.0 ) == Color( 0, 255, 0 ) );
+    }
+    THEN( "Clipping planes are applied" ) {
+      display.addCube( RealPoint( 2.5, 0, 0 ), 1.0 );
+      renderer.sync( display.cubes(), display.balls() );
+      setupView( true );
+      const GLdouble plane[ 4 ] = { -1.0, 0.0, 0.0, 1.5 };
+      glClipPlane( GL_CLIP_PLANE0, plane );
+      glEnable( GL_CLIP_PLANE0 );
+      renderer.draw();
+      glDisable( GL_CLIP_PLANE0 );
+      pixels = readPixels();
+      REQUIRE( pixelAt( pixels, 0.0, 0.0 ) == Color( 255, 0, 0 ) );
+      REQUIRE( pixelAt( pixels, 2.5, 0.0 ) == Color( 0, 0, 0 ) );
+    }
+  }
+  GIVEN( "Cubes of several sizes seen from an oblique direction" ) {
+    display.addCube( RealPoint( 2, 1, -1 ), 1.0 );
+    display.addCube( RealPoint( -2, -1.5, 1 ), 1.5 );
+    renderer.sync( display.cubes(), display.balls() );
+    THEN( "They cover the pixels of the fixed pipeline" ) {
+      setupView( true );
+      glRotated( 25.0, 1.0, 0.0, 0.0 );
+      glRotated( 30.0, 0.0, 1.0, 0.0 );
+      renderer.draw();
+      const std::vector<unsigned char> instanced = readPixels();
+
+      setupView( true );
+      glRotated( 25.0, 1.0, 0.0, 0.0 );
+      glRotated( 30.0, 0.0, 1.0, 0.0 );
+      glEnable( GL_LIGHTING );
+      glEnable( GL_LIGHT0 );
+      glEnable( GL_COLOR_MATERIAL );
+      glColorMaterial( GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE );
+      glColor4ub( 255, 0, 0, 255 );
+      drawFixedCube( RealPoint( 0, 0, 0 ), 2.0 );
+      drawFixedCube( RealPoint( 2, 1, -1 ), 1.0 );
+      drawFixedCube( RealPoint( -2, -1.5, 1 ), 1.5 );
+      glDisable( GL_LIGHTING );
+      const std::vector<unsigned char> fixed = readPixels();
+
+      unsigned int nbDifferent = 0;
+      for ( unsigned int i = 0; i < fixed.size(); i += 4 )
+        nbDifferent += ( ( fixed[ i ] | fixed[ i + 1 ] | fixed[ i + 2 ] ) != 0 )
+          != ( ( instanced[ i ] | instanced[ i + 1 ] | instanced[ i + 2 ] ) != 0 ) ? 1 : 0;
+      REQUIRE( nbCovered( fixed ) > 16 * 16 );
+      REQUIRE( nbDifferent <= 4 );
+    }
+  }
+  GIVEN( "A lit cube" ) {
+    THEN( "Its front face has the color of the fixed pipeline" ) {
+      setupView( false );
+      renderer.draw();
+      const Color instanced = pixelAt( readPixels(), 0.0, 0.0 );
+      REQUIRE( instanced.red() > 150 );
+      REQUIRE( instanced.red() < 200 );
+
+      setupView( false );
+      glEnable( GL_LIGHTING );
+      glEnable( GL_LIGHT0 );
+      glEnable( GL_COLOR_MATERIAL );
+      glColorMaterial( GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE );
+      glBegin( GL_QUADS );
+      glColor4ub( 255, 0, 0, 255 );
+      glNormal3f( 0.0f, 0.0f, 1.0f );
+      glVertex3f( -1.0f, -1.0f, 1.0f );
+      glVertex3f( 1.0f, -1.0f, 1.0f );
+      glVertex3f( 1.0f, 1.0f, 1.0f );
+      glVertex3f( -1.0f, 1.0f, 1.0f );
+      glEnd();
+      glDisable( GL_LIGHTING );
+      const Color fixed = pixelAt( readPixels(), 0.0, 0.0 );
+      REQUIRE( std::abs( int( fixed.red() ) - int( instanced.red() ) ) <= 1 );
+      REQUIRE( fixed.green() == instanced.green() );
+    }
+  }
+  renderer.releaseGL();
+  REQUIRE( ! renderer.isInitialized() );
+}
+
+/** @ingroup Tests **/
@@ -24,7 +24,9 @@
  * This file is part of the DGtal library.
  */
 
+#include <cmath>
 #include <limits>
+#include <sstream>
 
 #include "DGtal/base/BasicTypes.h"
 #include "DGtal/kernel/NumberTraits.h"
@@ -201,3 +203,69 @@ TEST_CASE( "BigInteger" )
 }
 
 #endif
+
+#ifdef WITH_INT128
+
+/// Check traits for a 128-bit integer (no std::numeric_limits in strict ISO modes).
+template <typename T, bool Signed>
+void check128BitIntegerType()
+{
+  using NT = typename DGtal::NumberTraits<T>;
+
+  REQUIRE_SAME_VALUE( typename NT::IsBounded,     true );
+  REQUIRE_SAME_VALUE( typename NT::IsSigned,      Signed );
+  REQUIRE_SAME_VALUE( typename NT::IsUnsigned,    ! Signed );
+  REQUIRE_SAME_VALUE( typename NT::IsIntegral,    true );
+  REQUIRE_SAME_VALUE( typename NT::IsSpecialized, true );
+
+  REQUIRE_SAME_TYPE( typename NT::ReturnType, T );
+  REQUIRE_SAME_TYPE( typename NT::SignedVersion, DGtal::int128_t );
+  REQUIRE_SAME_TYPE( typename NT::UnsignedVersion, DGtal::uint128_t );
+
+  REQUIRE( (NT::zero() == T(0)) );
+  REQUIRE( (NT::one() == T(1)) );
+  REQUIRE( NT::digits() == ( Signed ? 127u : 128u ) );
+  REQUIRE( (NT::min() == ( Signed ? T( -NT::max() - 1 ) : T(0) )) );
+  REQUIRE( (NT::min() < T(0)) == Signed );
+  REQUIRE( (NT::max() == T( ~DGtal::uint128_t(0) >> ( Signed ? 1 : 0 ) )) );
+  REQUIRE( (T( DGtal::uint64_t(-1) ) * T( 2 ) > T( DGtal::uint64_t(-1) )) );
+
+  REQUIRE( NT::even(T(42)) == true );
+  REQUIRE( NT::odd(T(43)) == true );
+
+  REQUIRE( NT::isBounded() == DGtal::BOUNDED );
+  REQUIRE( NT::isSigned() == ( Signed ? DGtal::SIGNED : DGtal::UNSIGNED ) );
+
+  REQUIRE( NT::castToInt64_t(T(3)) == 3 );
+  REQUIRE( NT::castToDouble(T(1) << 100) == std::ldexp( 1., 100 ) );
+
+  checkParamRef(NT::ZERO);
+  checkParamRef(NT::ONE);
+}
+
+TEST_CASE( "int128_t" )  { check128BitIntegerType<DGtal::int128_t, true>(); }
+TEST_CASE( "uint128_t" ) { check128BitIntegerType<DGtal::uint128_t, false>(); }
+
+TEST_CASE( "128-bit integer output" )
+{
+  using namespace DGtal; // operator<< for 128-bit integers is in namespace DGtal.
+  std::ostringstream out;
+  DGtal::int128_t a = DGtal::int128_t( 1 ) << 100;
+  out << a << " " << -a << " " << DGtal::int128_t( 0 ) << " "
+      << DGtal::NumberTraits<DGtal::uint128_t>::max();
+  REQUIRE( out.str() == "1267650600228229401496703205376 -1267650600228229401496703205376 0 "
+                        "340282366920938463463374607431768211455" );
+}
+
+TEST_CASE( "128-bit integer conversion to string" )
+{
+  // Found without 'using namespace DGtal'.
+  const DGtal::int128_t a = DGtal::int128_t( 1 ) << 100;
+  REQUIRE( DGtal::toString( a ) == "1267650600228229401496703205376" );
+  REQUIRE( DGtal::toString( -a ) == "-1267650600228229401496703205376" );
+  REQUIRE( DGtal::toString( DGtal::uint128_t( 0 ) ) == "0" );
+  REQUIRE( DGtal::toString( DGtal::NumberTraits<DGtal::int128_t>::min() )
+           == "-170141183460469231731687303715884105728" );
+}
+
+#endif
@@ -0,0 +1,219 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFlatMesh.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class FlatMesh.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/FlatMesh.h"
+#include "DGtal/shapes/MeshHelpers.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class FlatMesh.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef PointVector<3,double>   RealPoint;
+typedef Mesh< RealPoint >       PolyMesh;
+typedef FlatMesh< RealPoint >   Flat;
+
+/// @return the unit cube made of six quadrangles.
+PolyMesh makeCube()
+{
+  PolyMesh mesh;
+  for ( int i = 0; i < 8; ++i )
+    mesh.addVertex( RealPoint( i & 1, ( i >> 1 ) & 1, ( i >> 2 ) & 1 ) );
+  mesh.addQuadFace( 0, 2, 3, 1 );
+  mesh.addQuadFace( 4, 5, 7, 6 );
+  mesh.addQuadFace( 0, 1, 5, 4 );
+  mesh.addQuadFace( 2, 6, 7, 3 );
+  mesh.addQuadFace( 0, 4, 6, 2 );
+  mesh.addQuadFace( 1, 3, 7, 5 );
+  return mesh;
+}
+
+/// @return the unit cube made of twelve triangles.
+PolyMesh makeTriangulatedCube()
+{
+  PolyMesh cube = makeCube();
+  PolyMesh mesh;
+  for ( auto it = cube.vertexBegin(); it != cube.vertexEnd(); ++it )
+    mesh.addVertex( *it );
+  for ( auto it = cube.faceBegin(); it != cube.faceEnd(); ++it )
+    {
+      mesh.addTriangularFace( (*it)[ 0 ], (*it)[ 1 ], (*it)[ 2 ] );
+      mesh.addTriangularFace( (*it)[ 0 ], (*it)[ 2 ], (*it)[ 3 ] );
+    }
+  return mesh;
+}
+
+/// @return 'true' iff the flat mesh has the same vertices and faces as the mesh.
+bool sameMesh( const Flat& flat, const PolyMesh& mesh )
+{
+  if ( flat.nbVertices() != mesh.nbVertex() || flat.nbFaces() != mesh.nbFaces() )
+    return false;
+  for ( Flat::Index v = 0; v < flat.nbVertices(); ++v )
+    if ( flat.vertex( v ) != mesh.getVertex( v ) ) return false;
+  for ( Flat::Index f = 0; f < flat.nbFaces(); ++f )
+    {
+      const Flat::FaceView view = flat.face( f );
+      const PolyMesh::MeshFace& face = mesh.getFace( f );
+      if ( view.size() != face.size() || flat.faceSize( f ) != face.size()
+           || ! std::equal( view.begin(), view.end(), face.begin() ) )
+        return false;
+    }
+  return true;
+}
+
+SCENARIO( "FlatMesh< RealPoint3 > storage tests", "[flatmesh][storage]" )
+{
+  GIVEN( "A cube made of triangles" ) {
+    const PolyMesh mesh = makeTriangulatedCube();
+    Flat flat( mesh );
+    THEN( "The faces are stored on the triangle fast path" ) {
+      REQUIRE( flat.isValid() );
+      REQUIRE( flat.isTriangular() );
+      REQUIRE( flat.nbFaces() == 12 );
+      REQUIRE( flat.nbIndices() == 36 );
+      REQUIRE( flat.triangles().size() == 12 );
+      REQUIRE( flat.indices().empty() );
+      REQUIRE( sameMesh( flat, mesh ) );
+    }
+    WHEN( "A quadrangle is added" ) {
+      const Flat::Index quad[] = { 0, 1, 5, 4 };
+      const Flat::Index f = flat.addFace( quad, quad + 4 );
+      THEN( "The faces are moved to compressed rows" ) {
+        REQUIRE( f == 12 );
+        REQUIRE( ! flat.isTriangular() );
+        REQUIRE( flat.triangles().empty() );
+        REQUIRE( flat.nbFaces() == 13 );
+        REQUIRE( flat.nbIndices() == 40 );
+        REQUIRE( flat.offsets().size() == 14 );
+        REQUIRE( flat.faceSize( 12 ) == 4 );
+        REQUIRE( std::equal( quad, quad + 4, flat.face( 12 ).begin() ) );
+        REQUIRE( flat.addTriangle( 4, 5, 7 ) == 13 );
+        REQUIRE( flat.face( 13 )[ 2 ] == 7 );
+        PolyMesh other = mesh;
+        other.addQuadFace( 0, 1, 5, 4 );
+        other.addTriangularFace( 4, 5, 7 );
+        REQUIRE( sameMesh( flat, other ) );
+        REQUIRE( flat.isValid() );
+      }
+    }
+    WHEN( "The mesh is cleared" ) {
+      flat.clear();
+      THEN( "It is empty and back on the triangle fast path" ) {
+        REQUIRE( flat.nbVertices() == 0 );
+        REQUIRE( flat.nbFaces() == 0 );
+        REQUIRE( flat.isTriangular() );
+      }
+    }
+  }
+  GIVEN( "A cube made of quadrangles" ) {
+    const PolyMesh mesh = makeCube();
+    const Flat flat( mesh );
+    THEN( "The faces are stored in compressed rows" ) {
+      REQUIRE( flat.isValid() );
+      REQUIRE( ! flat.isTriangular() );
+      REQUIRE( flat.nbIndices() == 24 );
+      REQUIRE( flat.offsets().front() == 0 );
+      REQUIRE( flat.offsets().back() == 24 );
+      REQUIRE( sameMesh( flat, mesh ) );
+    }
+  }
+  GIVEN( "A face with an invalid vertex" ) {
+    Flat flat;
+    flat.addVertex( RealPoint( 0, 0, 0 ) );
+    flat.addVertex( RealPoint( 1, 0, 0 ) );
+    flat.addTriangle( 0, 1, 2 );
+    THEN( "The mesh is not valid" ) {
+      REQUIRE( ! flat.isValid() );
+    }
+  }
+}
+
+SCENARIO( "FlatMesh< RealPoint3 > conversion tests", "[flatmesh][helpers]" )
+{
+  GIVEN( "A cube made of triangles" ) {
+    const PolyMesh mesh = makeTriangulatedCube();
+    TriangulatedSurface<RealPoint> reference;
+    REQUIRE( MeshHelpers::mesh2TriangulatedSurface( mesh, reference ) );
+    Flat flat( mesh );
+    const RealPoint* positions = flat.vertices().data();
+    TriangulatedSurface<RealPoint> trisurf;
+    const bool ok = MeshHelpers::flatMesh2TriangulatedSurface( std::move( flat ), trisurf );
+    THEN( "The triangulated surface is the same as from the mesh, and reuses its buffers" ) {
+      REQUIRE( ok );
+      REQUIRE( flat.nbVertices() == 0 );
+      REQUIRE( flat.nbFaces() == 0 );
+      REQUIRE( &trisurf.position( 0 ) == positions );
+      REQUIRE( trisurf.nbVertices() == reference.nbVertices() );
+      REQUIRE( trisurf.nbFaces() == reference.nbFaces() );
+      REQUIRE( trisurf.nbEdges() == reference.nbEdges() );
+      REQUIRE( trisurf.Euler() == 2 );
+      for ( TriangulatedSurface<RealPoint>::Face f = 0; f < trisurf.nbFaces(); ++f )
+        REQUIRE( trisurf.verticesAroundFace( f ) == reference.verticesAroundFace( f ) );
+    }
+  }
+  GIVEN( "A cube made of quadrangles" ) {
+    const PolyMesh mesh = makeCube();
+    TriangulatedSurface<RealPoint> refTrisurf;
+    PolygonalSurface<RealPoint> refPolysurf;
+    REQUIRE( MeshHelpers::mesh2TriangulatedSurface( mesh, refTrisurf ) );
+    REQUIRE( MeshHelpers::mesh2PolygonalSurface( mesh, refPolysurf ) );
+    THEN( "The triangulated surface is the fan triangulation of the quadrangles" ) {
+      TriangulatedSurface<RealPoint> trisurf;
+      REQUIRE( MeshHelpers::flatMesh2TriangulatedSurface( Flat( mesh ), trisurf ) );
+      REQUIRE( trisurf.nbFaces() == 12 );
+      REQUIRE( trisurf.Euler() == 2 );
+      for ( TriangulatedSurface<RealPoint>::Face f = 0; f < trisurf.nbFaces(); ++f )
+        REQUIRE( trisurf.verticesAroundFace( f ) == refTrisurf.verticesAroundFace( f ) );
+    }
+    THEN( "The polygonal surface is the same as from the mesh" ) {
+      Flat flat( mesh );
+      const RealPoint* positions = flat.vertices().data();
+      PolygonalSurface<RealPoint> polysurf;
+      REQUIRE( MeshHelpers::flatMesh2PolygonalSurface( std::move( flat ), polysurf ) );
+      REQUIRE( &polysurf.position( 0 ) == positions );
+      REQUIRE( polysurf.nbFaces() == 6 );
+      REQUIRE( polysurf.nbEdges() == 12 );
+      REQUIRE( polysurf.Euler() == 2 );
+      for ( PolygonalSurface<RealPoint>::Face f = 0; f < polysurf.nbFaces(); ++f )
+        REQUIRE( polysurf.verticesAroundFace( f ) == refPolysurf.verticesAroundFace( f ) );
+    }
+  }
+}
+
+/** @ingroup Tests **/
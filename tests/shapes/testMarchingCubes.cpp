@@ -0,0 +1,195 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMarchingCubes.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class MarchingCubes.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/shapes/MarchingCubes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MarchingCubes.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector< Domain, double >        DoubleImage;
+typedef ImageContainerBySTLVector< Domain, unsigned char > ByteImage;
+typedef TriangulatedSurface< RealPoint >                   TriMesh;
+
+/// @return the signed volume enclosed by the triangles of the mesh.
+double signedVolume( const FlatMesh< RealPoint >& mesh )
+{
+  double volume = 0.0;
+  for ( FlatMesh< RealPoint >::Index f = 0; f < mesh.nbFaces(); ++f )
+    {
+      const FlatMesh< RealPoint >::FaceView t = mesh.face( f );
+      volume += mesh.vertex( t[ 0 ] ).dot( mesh.vertex( t[ 1 ] ).crossProduct( mesh.vertex( t[ 2 ] ) ) );
+    }
+  return volume / 6.0;
+}
+
+/// A writer checking that triangles only reference written vertices.
+struct CheckingWriter
+{
+  CheckingWriter() : nbVertices( 0 ), nbTriangles( 0 ), ok( true ) {}
+  void addVertex( const RealPoint& ) { ++nbVertices; }
+  void addTriangle( std::size_t i, std::size_t j, std::size_t k )
+  {
+    ++nbTriangles;
+    ok = ok && i < nbVertices && j < nbVertices && k < nbVertices
+      && i != j && j != k && k != i;
+  }
+  std::size_t nbVertices;
+  std::size_t nbTriangles;
+  bool ok;
+};
+
+/// @return 'true' iff both meshes have the same vertices and triangles.
+bool sameMesh( const FlatMesh< RealPoint >& m1, const FlatMesh< RealPoint >& m2 )
+{
+  if ( m1.vertices() != m2.vertices() || m1.nbFaces() != m2.nbFaces() ) return false;
+  for ( FlatMesh< RealPoint >::Index f = 0; f < m1.nbFaces(); ++f )
+    if ( ! std::equal( m1.face( f ).begin(), m1.face( f ).end(), m2.face( f ).begin() ) )
+      return false;
+  return true;
+}
+
+SCENARIO( "MarchingCubes of a ball", "[marchingcubes]" )
+{
+  const double R = 7.3;
+  const Domain domain( Point::diagonal( -10 ), Point( 10, 9, 11 ) );
+  DoubleImage image( domain );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    image.setValue( *it, R - ( *it - Point( 1, 0, 0 ) ).norm() );
+  const MarchingCubes< DoubleImage > mc( image );
+  REQUIRE( mc.isValid() );
+
+  GIVEN( "Its iso-surface" ) {
+    FlatMesh< RealPoint > mesh;
+    const std::size_t nb = mc.extract( 0.0, mesh );
+    THEN( "It is a closed surface close to the sphere, oriented outward" ) {
+      REQUIRE( nb == mesh.nbFaces() );
+      REQUIRE( mesh.isValid() );
+      REQUIRE( mesh.isTriangular() );
+      double maxError = 0.0;
+      for ( const RealPoint& p : mesh.vertices() )
+        maxError = std::max( maxError, std::fabs( ( p - RealPoint( 1, 0, 0 ) ).norm() - R ) );
+      REQUIRE( maxError < 0.05 );
+      const double volume = signedVolume( mesh );
+      REQUIRE( std::fabs( volume - 4.0 / 3.0 * M_PI * R * R * R ) < 0.03 * volume );
+      TriMesh trisurf;
+      REQUIRE( MeshHelpers::flatMesh2TriangulatedSurface( std::move( mesh ), trisurf ) );
+      REQUIRE( trisurf.Euler() == 2 );
+      REQUIRE( trisurf.allBoundaryArcs().empty() );
+    }
+    THEN( "It does not depend on the slabs nor on the number of threads" ) {
+      for ( std::size_t thickness = 1; thickness < 6; thickness += 2 )
+        {
+          FlatMesh< RealPoint > other;
+          mc.extract( 0.0, other, 1, thickness );
+          REQUIRE( sameMesh( mesh, other ) );
+          other.clear();
+          mc.extract( 0.0, other, 3, thickness );
+          REQUIRE( sameMesh( mesh, other ) );
+        }
+    }
+    THEN( "Streamed triangles only reference already written vertices" ) {
+      CheckingWriter writer;
+      REQUIRE( mc.extract( 0.0, writer, 2, 2 ) == mesh.nbFaces() );
+      REQUIRE( writer.ok );
+      REQUIRE( writer.nbVertices == mesh.nbVertices() );
+    }
+  }
+  GIVEN( "The iso-surface of a ball cut by the domain" ) {
+    TriMesh closedSurf, openSurf;
+    REQUIRE( MarchingCubes< DoubleImage >( image, true ).makeTriangulatedSurface( -4.0, closedSurf ) );
+    REQUIRE( MarchingCubes< DoubleImage >( image, false ).makeTriangulatedSurface( -4.0, openSurf ) );
+    THEN( "It is closed along the border of the domain only if asked" ) {
+      REQUIRE( closedSurf.Euler() == 2 );
+      REQUIRE( closedSurf.allBoundaryArcs().empty() );
+      REQUIRE( ! openSurf.allBoundaryArcs().empty() );
+      REQUIRE( openSurf.nbFaces() < closedSurf.nbFaces() );
+    }
+  }
+}
+
+SCENARIO( "MarchingCubes of binary images", "[marchingcubes]" )
+{
+  const Domain domain( Point::diagonal( 0 ), Point( 11, 12, 13 ) );
+  ByteImage image( domain );
+  DigitalSet set( domain );
+  srand( 2 );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    {
+      const bool in = ( rand() % 3 == 0 );
+      image.setValue( *it, in ? 255 : 0 );
+      if ( in ) set.insertNew( *it );
+    }
+  KSpace K;
+  K.init( domain.lowerBound() - Point::diagonal( 1 ), domain.upperBound() + Point::diagonal( 1 ), true );
+  const DigitalSetBoundary< KSpace, DigitalSet > boundary( K, set );
+
+  GIVEN( "A random binary image" ) {
+    const MarchingCubes< ByteImage > mc( image );
+    TriMesh trisurf;
+    const bool ok = mc.makeTriangulatedSurface( 127.5, trisurf );
+    THEN( "Its vertices are the bels and it is a closed combinatorial surface" ) {
+      REQUIRE( ok );
+      REQUIRE( trisurf.nbVertices() == boundary.nbSurfels() );
+      REQUIRE( trisurf.allBoundaryArcs().empty() );
+      REQUIRE( trisurf.Euler() % 2 == 0 );
+    }
+  }
+  GIVEN( "A full image" ) {
+    ByteImage full( domain );
+    for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+      full.setValue( *it, 1 );
+    TriMesh trisurf;
+    THEN( "Its closed iso-surface is a box, the open one is empty" ) {
+      REQUIRE( MarchingCubes< ByteImage >( full ).makeTriangulatedSurface( 0.5, trisurf ) );
+      REQUIRE( trisurf.Euler() == 2 );
+      FlatMesh< RealPoint > mesh;
+      REQUIRE( MarchingCubes< ByteImage >( full, false ).extract( 0.5, mesh ) == 0 );
+      REQUIRE( mesh.nbVertices() == 0 );
+    }
+  }
+}
+
+/** @ingroup Tests **/
@@ -28,6 +28,7 @@
  */
 
 ///////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include "DGtal/helpers/StdDefs.h"
@@ -170,6 +171,82 @@ bool testMetricAdjacency()
   return nbok == nb;
 }
 
+/**
+ * Offsets tables against a scan of the cube, in dimension 3 and 4.
+ */
+template <Dimension dim, Dimension norm1>
+bool checkOffsets( unsigned int expected )
+{
+  typedef SpaceND<dim> Space;
+  typedef typename Space::Point Point;
+  typedef MetricAdjacency<Space, norm1> Adjacency;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Adjacency::Offsets Offsets;
+  static_assert( Adjacency::nbNeighbors == std::tuple_size<Offsets>::value,
+                 "Offsets must have nbNeighbors elements." );
+  const Offsets & offsets = Adjacency::offsets();
+  bool ok = ( Adjacency::nbNeighbors == expected )
+    && ( Adjacency::bestCapacity() == expected );
+  // Same order as a scan of the cube.
+  std::vector<Point> scan;
+  const Domain cube( Point::diagonal( -1 ), Point::diagonal( 1 ) );
+  for ( typename Domain::ConstIterator it = cube.begin(); it != cube.end(); ++it )
+    if ( ( (*it).norm1() >= 1 ) && ( (*it).norm1() <= norm1 ) )
+      scan.push_back( *it );
+  ok = ok && ( scan.size() == offsets.size() )
+    && std::equal( scan.begin(), scan.end(), offsets.begin() );
+  // Linear offsets in an image of extent (5,6,7,...).
+  Point extent;
+  for ( Dimension k = 0; k < dim; ++k ) extent[ k ] = 5 + k;
+  const typename Adjacency::LinearOffsets linear = Adjacency::linearOffsets( extent );
+  for ( std::size_t i = 0; i < offsets.size(); ++i )
+    {
+      std::ptrdiff_t index = 0;
+      std::ptrdiff_t stride = 1;
+      for ( Dimension k = 0; k < dim; ++k )
+        {
+          index += offsets[ i ][ k ] * stride;
+          stride *= extent[ k ];
+        }
+      ok = ok && ( linear[ i ] == index );
+    }
+  trace.info() << "Adjacency " << dim << "D norm1<=" << norm1
+               << " #neighbors=" << Adjacency::nbNeighbors
+               << " == " << expected << " ? " << ok << std::endl;
+  return ok;
+}
+
+bool testMetricAdjacencyOffsets()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing precomputed offsets of metric adjacencies" );
+  nbok += checkOffsets<2, 1>( 4 ) ? 1 : 0; nb++;
+  nbok += checkOffsets<2, 2>( 8 ) ? 1 : 0; nb++;
+  nbok += checkOffsets<3, 1>( 6 ) ? 1 : 0; nb++;
+  nbok += checkOffsets<3, 2>( 18 ) ? 1 : 0; nb++;
+  nbok += checkOffsets<3, 3>( 26 ) ? 1 : 0; nb++;
+  nbok += checkOffsets<4, 1>( 8 ) ? 1 : 0; nb++;
+  nbok += checkOffsets<4, 3>( 64 ) ? 1 : 0; nb++;
+  nbok += checkOffsets<4, 4>( 80 ) ? 1 : 0; nb++;
+
+  // The specialized writeNeighbors give the same neighbors as the offsets.
+  typedef Z3i::Adj18 Adj18;
+  const Z3i::Point p( 3, -5, 10 );
+  vector<Z3i::Point> neigh18;
+  back_insert_iterator< vector<Z3i::Point> > bii18( neigh18 );
+  Adj18::writeNeighbors( bii18, p );
+  vector<Z3i::Point> expected18;
+  for ( unsigned int i = 0; i < Adj18::nbNeighbors; ++i )
+    expected18.push_back( p + Adj18::offsets()[ i ] );
+  std::sort( neigh18.begin(), neigh18.end() );
+  std::sort( expected18.begin(), expected18.end() );
+  const bool same = ( neigh18 == expected18 );
+  nbok += same ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
 
 bool testLocalGraphModel()
 {
@@ -204,7 +281,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMetricAdjacency() && testLocalGraphModel(); // && ... other tests
+  bool res = testMetricAdjacency() && testMetricAdjacencyOffsets()
+    && testLocalGraphModel(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -512,6 +512,87 @@ SCENARIO( "CubicalComplex< K3,std::map<> > collapse tests", "[cubical_complex][c
   }
 }
 
+SCENARIO( "CubicalComplex< K3,std::map<> > indexed collapse tests", "[cubical_complex][collapse]" )
+{
+  typedef KhalimskySpaceND<3>               KSpace;
+  typedef KSpace::Point            Point;
+  typedef KSpace::Cell             Cell;
+  typedef KSpace::Integer          Integer;
+  typedef std::map<Cell, CubicalCellData>   Map;
+  typedef CubicalComplex< KSpace, Map >     CC;
+  typedef CC::CellMapIterator      CellMapIterator;
+
+  srand( 0 );
+  KSpace K;
+  K.init( Point( 0,0,0 ), Point( 512,512,512 ), true );
+
+  GIVEN( "A closed cubical complex made of 3x3x3 voxels with their incident cells" ) {
+    CC complex( K );
+    std::vector<Cell> S;
+    for ( Integer x = 0; x < 3; ++x )
+      for ( Integer y = 0; y < 3; ++y )
+        for ( Integer z = 0; z < 3; ++z )
+          {
+            S.push_back( K.uSpel( Point( x, y, z ) ) );
+            complex.insertCell( S.back() );
+          }
+    complex.close();
+
+    WHEN( "Fixing two vertices of this big cube and collapsing it" ) {
+      CellMapIterator it1 = complex.findCell( 0, K.uCell( Point( 0, 0, 0 ) ) );
+      CellMapIterator it2 = complex.findCell( 0, K.uCell( Point( 4, 4, 4 ) ) );
+      it1->second.data |= CC::FIXED;
+      it2->second.data |= CC::FIXED;
+      CC::DefaultCellMapIteratorPriority P;
+      const uint64_t nb = functions::indexedCollapse( complex, S.begin(), S.end(), P, false, true );
+      CAPTURE( complex.nbCells( 0 ) );
+      CAPTURE( complex.nbCells( 1 ) );
+      CAPTURE( complex.nbCells( 2 ) );
+      CAPTURE( complex.nbCells( 3 ) );
+
+      THEN( "It keeps its topology so its euler characteristic is 1" ) {
+        REQUIRE( complex.euler() == 1 );
+        REQUIRE( nb == 64 + 144 + 108 + 27 - complex.size() );
+      } AND_THEN( "It has only 0-cells and 1-cells, including the fixed ones" ) {
+        REQUIRE( complex.nbCells( 2 ) == 0 );
+        REQUIRE( complex.nbCells( 3 ) == 0 );
+        REQUIRE( complex.belongs( K.uCell( Point( 0, 0, 0 ) ) ) );
+        REQUIRE( complex.belongs( K.uCell( Point( 4, 4, 4 ) ) ) );
+      }
+    }
+  }
+
+  GIVEN( "The closure of random voxels" ) {
+    CC complex( K );
+    std::vector<Cell> S;
+    for ( Integer x = 0; x < 8; ++x )
+      for ( Integer y = 0; y < 8; ++y )
+        for ( Integer z = 0; z < 8; ++z )
+          if ( rand() % 3 != 0 )
+            {
+              S.push_back( K.uSpel( Point( x, y, z ) ) );
+              complex.insertCell( S.back() );
+            }
+    complex.close();
+    const int euler = complex.euler();
+    CC::DefaultCellMapIteratorPriority P;
+    CC complex1( complex );
+    functions::indexedCollapse( complex1, S.begin(), S.end(), P, false, true, 1 );
+
+    THEN( "Its collapse keeps the topology, is complete and does not depend on the threads" ) {
+      REQUIRE( complex1.euler() == euler );
+      CC complex3( complex );
+      functions::indexedCollapse( complex3, S.begin(), S.end(), P, false, true, 3 );
+      REQUIRE( complex1 == complex3 );
+      std::vector<Cell> all;
+      for ( Dimension d = 0; d <= 3; ++d )
+        for ( CellMapIterator it = complex1.begin( d ); it != complex1.end( d ); ++it )
+          all.push_back( it->first );
+      REQUIRE( functions::collapse( complex1, all.begin(), all.end(), P, true, true ) == 0 );
+    }
+  }
+}
+
 SCENARIO( "CubicalComplex< K3,std::map<> > link tests", "[cubical_complex][link]" )
 {
   typedef KhalimskySpaceND<3>               KSpace;
@@ -0,0 +1,255 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDenseCellMap.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class DenseCellMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <map>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/CubicalComplexFunctions.h"
+#include "DGtal/topology/VoxelComplex.h"
+#include "DGtal/topology/DenseCellMap.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DenseCellMap.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef DenseCellMap< KSpace >                    DenseMap;
+typedef std::map< Cell, CubicalCellData >         StdMap;
+typedef CubicalComplex< KSpace, DenseMap >        DenseComplex;
+typedef CubicalComplex< KSpace, StdMap >          MapComplex;
+
+/// @return 'true' iff both maps have the same cells and data.
+bool sameMap( const DenseMap& dense, const StdMap& map )
+{
+  if ( dense.size() != map.size() ) return false;
+  std::size_t nb = 0;
+  for ( DenseMap::ConstIterator it = dense.begin(), itE = dense.end(); it != itE; ++it, ++nb )
+    {
+      StdMap::const_iterator itMap = map.find( it->first );
+      if ( itMap == map.end() || itMap->second.data != it->second.data ) return false;
+    }
+  return nb == map.size();
+}
+
+/// @return 'true' iff both complexes have the same cells in each dimension.
+template <typename CC1, typename CC2>
+bool sameComplex( const CC1& cc1, const CC2& cc2 )
+{
+  for ( Dimension d = 0; d <= 3; ++d )
+    {
+      if ( cc1.nbCells( d ) != cc2.nbCells( d ) ) return false;
+      for ( typename CC1::CellMapConstIterator it = cc1.begin( d ), itE = cc1.end( d ); it != itE; ++it )
+        if ( ! cc2.belongs( d, it->first ) ) return false;
+    }
+  return true;
+}
+
+/// @return the closure of a ball of radius \a r as a complex.
+template <typename CC>
+void makeBall( CC& complex, double r )
+{
+  const Domain domain( complex.space().lowerBound(), complex.space().upperBound() );
+  DigitalSet set( domain );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    if ( ( *it - Point( 1, 0, 0 ) ).norm() <= r ) set.insertNew( *it );
+  complex.construct( set );
+}
+
+SCENARIO( "DenseCellMap< Z3 > map services", "[densecellmap]" )
+{
+  KSpace K;
+  K.init( Point::diagonal( -30 ), Point::diagonal( 30 ), true );
+  DenseMap dense;
+  StdMap map;
+  srand( 0 );
+  for ( int i = 0; i < 5000; ++i )
+    {
+      Point k;
+      for ( Dimension j = 0; j < 3; ++j ) k[ j ] = rand() % 40 - 20;
+      // Cells inserted far from the first ones make the box grow.
+      if ( i == 1000 ) k = Point( -41, 40, 3 );
+      const Cell c = K.uCell( k );
+      const bool inserted = ( rand() % 4 != 0 );
+      if ( inserted )
+        {
+          dense.insert( std::make_pair( c, CubicalCellData( i ) ) );
+          map.insert( std::make_pair( c, CubicalCellData( i ) ) );
+        }
+      else
+        {
+          REQUIRE( dense.erase( c ) == map.erase( c ) );
+        }
+    }
+  GIVEN( "Random insertions and erasures" ) {
+    THEN( "The map has the same elements as a std::map" ) {
+      REQUIRE( dense.isValid() );
+      REQUIRE( sameMap( dense, map ) );
+      REQUIRE( dense.memoryUsage() >= dense.boxSize() * sizeof( CubicalCellData ) );
+      for ( StdMap::const_iterator it = map.begin(); it != map.end(); ++it )
+        REQUIRE( dense.count( it->first ) == 1 );
+      REQUIRE( dense.count( K.uCell( Point( 50, 50, 50 ) ) ) == 0 );
+      REQUIRE( dense.find( K.uCell( Point( 50, 50, 50 ) ) ) == dense.end() );
+    }
+    THEN( "Data may be modified through iterators and operator[]" ) {
+      for ( DenseMap::Iterator it = dense.begin(); it != dense.end(); ++it )
+        it->second.data += 1;
+      const Cell c = map.begin()->first;
+      REQUIRE( dense.find( c )->second.data == map.begin()->second.data + 1 );
+      dense[ c ] = CubicalCellData( 7 );
+      REQUIRE( dense.find( c )->second.data == 7 );
+      const std::size_t size = dense.size();
+      const Cell other = K.uCell( Point( -40, -40, -40 ) );
+      REQUIRE( dense[ other ].data == 0 );
+      REQUIRE( dense.size() == size + 1 );
+    }
+    THEN( "Erasing through iterators keeps the others valid" ) {
+      for ( DenseMap::Iterator it = dense.begin(); it != dense.end(); )
+        {
+          DenseMap::Iterator itNext = it; ++itNext;
+          if ( it->second.data % 2 == 0 ) dense.erase( it );
+          it = itNext;
+        }
+      for ( StdMap::iterator it = map.begin(); it != map.end(); )
+        if ( it->second.data % 2 == 0 ) map.erase( it++ ); else ++it;
+      REQUIRE( dense.isValid() );
+      REQUIRE( sameMap( dense, map ) );
+      dense.clear();
+      REQUIRE( dense.empty() );
+      REQUIRE( dense.begin() == dense.end() );
+    }
+  }
+}
+
+SCENARIO( "CubicalComplex< Z3, DenseCellMap > tests", "[densecellmap][cubicalcomplex]" )
+{
+  KSpace K;
+  K.init( Point::diagonal( -6 ), Point::diagonal( 6 ), true );
+  DenseComplex dense( K );
+  MapComplex complex( K );
+  makeBall( dense, 4.5 );
+  makeBall( complex, 4.5 );
+
+  GIVEN( "The closure of a ball" ) {
+    THEN( "It has the same cells as with std::map" ) {
+      REQUIRE( sameComplex( dense, complex ) );
+      REQUIRE( dense.euler() == 1 );
+      REQUIRE( dense.isValid() );
+    }
+    THEN( "Its boundary, interior, closure and star are the same" ) {
+      REQUIRE( sameComplex( dense.boundary(), complex.boundary() ) );
+      REQUIRE( sameComplex( dense.interior(), complex.interior() ) );
+      REQUIRE( dense.boundary().euler() == 2 );
+      DenseComplex S( K );
+      MapComplex T( K );
+      S.insertCell( K.uCell( Point( 2, 2, 2 ) ) );
+      T.insertCell( K.uCell( Point( 2, 2, 2 ) ) );
+      REQUIRE( sameComplex( dense.closure( S ), complex.closure( T ) ) );
+      REQUIRE( sameComplex( dense.star( S ), complex.star( T ) ) );
+      REQUIRE( dense.star( S ).nbCells( 3 ) == 8 );
+    }
+    THEN( "Set operations give the same complexes" ) {
+      DenseComplex bd = dense.boundary();
+      DenseComplex inner = dense - bd;
+      REQUIRE( ( inner | bd ) == dense );
+      REQUIRE( ( inner <= dense ) );
+      REQUIRE( ( dense ^ inner ) == bd );
+    }
+    THEN( "Its collapse is the same as with std::map" ) {
+      std::vector<Cell> S;
+      for ( DenseComplex::CellMapConstIterator it = dense.begin( 3 ); it != dense.end( 3 ); ++it )
+        S.push_back( it->first );
+      dense.findCell( 0, K.uCell( Point( 2, 0, 0 ) ) )->second.data |= DenseComplex::FIXED;
+      complex.findCell( 0, K.uCell( Point( 2, 0, 0 ) ) )->second.data |= MapComplex::FIXED;
+      DenseComplex::DefaultCellMapIteratorPriority P;
+      functions::collapse( dense, S.begin(), S.end(), P, false, true, false );
+      MapComplex::DefaultCellMapIteratorPriority Q;
+      functions::collapse( complex, S.begin(), S.end(), Q, false, true, false );
+      REQUIRE( dense.euler() == 1 );
+      REQUIRE( dense.nbCells( 3 ) == 0 );
+      REQUIRE( dense.nbCells( 0 ) == complex.nbCells( 0 ) );
+      REQUIRE( dense.nbCells( 1 ) == complex.nbCells( 1 ) );
+      REQUIRE( dense.nbCells( 2 ) == complex.nbCells( 2 ) );
+    }
+    THEN( "Its indexed collapse is the same as with std::map" ) {
+      std::vector<Cell> S;
+      for ( DenseComplex::CellMapConstIterator it = dense.begin( 3 ); it != dense.end( 3 ); ++it )
+        S.push_back( it->first );
+      DenseComplex::DefaultCellMapIteratorPriority P;
+      functions::indexedCollapse( dense, S.begin(), S.end(), P, false, true );
+      MapComplex::DefaultCellMapIteratorPriority Q;
+      functions::indexedCollapse( complex, S.begin(), S.end(), Q, false, true );
+      REQUIRE( dense.euler() == 1 );
+      REQUIRE( sameComplex( dense, complex ) );
+    }
+  }
+}
+
+SCENARIO( "VoxelComplex< Z3, DenseCellMap > tests", "[densecellmap][voxelcomplex]" )
+{
+  typedef VoxelComplex< KSpace, DenseMap > DenseVoxelComplex;
+  typedef VoxelComplex< KSpace, StdMap >   MapVoxelComplex;
+  KSpace K;
+  K.init( Point::diagonal( -10 ), Point::diagonal( 10 ), true );
+  const Domain domain( K.lowerBound(), K.upperBound() );
+  DigitalSet set( domain );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    if ( ( *it ).norm1() <= 3 ) set.insertNew( *it );
+  set.erase( Point::diagonal( 0 ) );
+  DenseVoxelComplex dense( K );
+  MapVoxelComplex complex( K );
+  dense.construct( set );
+  complex.construct( set );
+
+  GIVEN( "A hollow diamond" ) {
+    THEN( "Its simple voxels and critical cliques are the same as with std::map" ) {
+      REQUIRE( sameComplex( dense, complex ) );
+      std::size_t nbSimple = 0;
+      for ( auto it = dense.begin( 3 ); it != dense.end( 3 ); ++it )
+        {
+          const bool simple = dense.isSimple( it->first );
+          REQUIRE( simple == complex.isSimple( it->first ) );
+          nbSimple += simple ? 1 : 0;
+        }
+      REQUIRE( nbSimple == 44 );
+      REQUIRE( dense.criticalCliques().size() == complex.criticalCliques().size() );
+    }
+  }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,183 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHomotopicThinning.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing the homotopic thinning functions.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/HomotopicThinning.h"
+
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the homotopic thinning functions.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return the number of connected components of the object.
+template <typename TObject>
+std::size_t nbComponents( const TObject & object )
+{
+  std::vector<TObject> components;
+  std::back_insert_iterator< std::vector<TObject> > it( components );
+  return object.writeComponents( it );
+}
+
+/// @return the number of connected components of the complement of the object in its domain.
+template <typename TObject>
+std::size_t nbComplementComponents( const TObject & object )
+{
+  typedef typename TObject::DigitalSet DigitalSet;
+  typedef typename TObject::Domain Domain;
+  typedef typename TObject::ComplementObject ComplementObject;
+  DigitalSet complement( object.pointSet().domainPointer() );
+  const Domain & domain = object.domain();
+  for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( object.pointSet().find( *it ) == object.pointSet().end() )
+      complement.insertNew( *it );
+  ComplementObject background( object.topology().reverseTopology(), complement );
+  std::vector<ComplementObject> components;
+  std::back_insert_iterator< std::vector<ComplementObject> > it( components );
+  return background.writeComponents( it );
+}
+
+/// @return 'true' iff the two digital sets have the same points.
+template <typename TDigitalSet>
+bool sameSet( const TDigitalSet & a, const TDigitalSet & b )
+{
+  if ( a.size() != b.size() ) return false;
+  for ( auto && p : a )
+    if ( b.find( p ) == b.end() ) return false;
+  return true;
+}
+
+/// @return 'true' iff the object has no simple point.
+template <typename TObject>
+bool isThin( const TObject & object )
+{
+  for ( auto && p : object.pointSet() )
+    if ( object.isSimple( p ) ) return false;
+  return true;
+}
+
+TEST_CASE( "Testing homotopic thinning in 2D" )
+{
+  using namespace Z2i;
+  Domain domain( Point( -20, -20 ), Point( 20, 20 ) );
+  DigitalSet shape( domain );
+  Shapes<Domain>::addNorm2Ball( shape, Point( 0, 0 ), 15 );
+  Shapes<Domain>::removeNorm2Ball( shape, Point( -5, 2 ), 4 );
+  Shapes<Domain>::removeNorm2Ball( shape, Point( 6, -3 ), 3 );
+  Object4_8 object( dt4_8, shape );
+  const std::size_t nbC = nbComponents( object );
+  const std::size_t nbCC = nbComplementComponents( object );
+  REQUIRE( nbC == 1 );
+  REQUIRE( nbCC == 3 );
+
+  Object4_8 thin( dt4_8, shape );
+  const std::size_t nbRemoved = functions::homotopicThinning( thin );
+  REQUIRE( nbRemoved + thin.size() == object.size() );
+  REQUIRE( isThin( thin ) );
+  REQUIRE( nbComponents( thin ) == nbC );
+  REQUIRE( nbComplementComponents( thin ) == nbCC );
+
+  SECTION( "Thinning with a simplicity table gives the same result" )
+    {
+      Object4_8 thinTable( dt4_8, shape );
+      REQUIRE( thinTable.loadSimplicityTable() );
+      REQUIRE( functions::homotopicThinning( thinTable ) == nbRemoved );
+      REQUIRE( sameSet( thinTable.pointSet(), thin.pointSet() ) );
+    }
+
+  SECTION( "Thinning of a dense binary image gives the same result" )
+    {
+      ImageContainerBySTLVector<Domain, bool> image( domain );
+      for ( auto && p : shape ) image.setValue( p, true );
+      auto table = functions::loadSimplicityTable<Adj4, Adj8>();
+      const std::size_t nb = functions::homotopicThinningOfImage
+        ( image, *table, functors::FalsePointPredicate<Point>() );
+      REQUIRE( nb == nbRemoved );
+      bool same = true;
+      for ( auto && p : domain )
+        same = same && ( image( p ) == ( thin.pointSet().find( p ) != thin.pointSet().end() ) );
+      REQUIRE( same );
+    }
+
+  SECTION( "Fixed points are kept" )
+    {
+      Object4_8 thinFixed( dt4_8, shape );
+      const Point anchor( 0, 12 );
+      auto isFixed = [ &anchor ] ( const Point & p ) { return ( p - anchor ).norm1() <= 1; };
+      functions::homotopicThinning( thinFixed, isFixed );
+      for ( auto && p : shape )
+        if ( isFixed( p ) )
+          REQUIRE( thinFixed.pointSet().find( p ) != thinFixed.pointSet().end() );
+      REQUIRE( nbComponents( thinFixed ) == nbC );
+      REQUIRE( nbComplementComponents( thinFixed ) == nbCC );
+    }
+}
+
+TEST_CASE( "Testing homotopic thinning in 3D" )
+{
+  using namespace Z3i;
+  Domain domain( Point::diagonal( -8 ), Point::diagonal( 8 ) );
+  DigitalSet shape( domain );
+  Shapes<Domain>::addNorm2Ball( shape, Point( 0, 0, 0 ), 6 );
+  Shapes<Domain>::removeNorm2Ball( shape, Point( 0, 0, 0 ), 3 );
+  Object26_6 object( dt26_6, shape );
+  REQUIRE( nbComponents( object ) == 1 );
+  REQUIRE( nbComplementComponents( object ) == 2 );
+
+  Object26_6 thin( dt26_6, shape );
+  const std::size_t nbRemoved = functions::homotopicThinning( thin );
+  REQUIRE( nbRemoved + thin.size() == object.size() );
+  REQUIRE( isThin( thin ) );
+  REQUIRE( nbComponents( thin ) == 1 );
+  REQUIRE( nbComplementComponents( thin ) == 2 );
+
+  Object26_6 thinTable( dt26_6, shape );
+  REQUIRE( thinTable.loadSimplicityTable() );
+  REQUIRE( functions::homotopicThinning( thinTable ) == nbRemoved );
+  REQUIRE( sameSet( thinTable.pointSet(), thin.pointSet() ) );
+
+  ImageContainerBySTLVector<Domain, unsigned char> image( domain );
+  for ( auto && p : shape ) image.setValue( p, 255 );
+  const std::size_t nb = functions::homotopicThinningOfImage
+    ( image, *functions::loadSimplicityTable<Adj26, Adj6>(),
+      functors::FalsePointPredicate<Point>() );
+  REQUIRE( nb == nbRemoved );
+}
+
+/** @ingroup Tests **/
@@ -32,6 +32,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstddef>
 #include <algorithm>
+#include <boost/math/special_functions/binomial.hpp>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
@@ -318,3 +318,35 @@ SCENARIO( "Load isthmus tables", "[isthmus]" ){
     boost::ignore_unused_variable_warning(table);
   }
 }
+
+SCENARIO( "Neighborhood configurations without map and simplicity tables of topologies", "[table][simple]" ){
+  using namespace Z3i;
+  auto obj = Object3D<Object26_6>(dt26_6);
+  auto pointToMask = mapZeroPointNeighborhoodToConfigurationMask<Point>();
+  SECTION("getNeighborhoodConfiguration gives the configuration of the map"){
+    const Domain domain( Point::diagonal( -5 ), Point::diagonal( 5 ) );
+    bool same = true;
+    for ( auto && p : domain )
+      same = same && ( getNeighborhoodConfiguration( obj.pointSet(), p )
+                       == obj.getNeighborhoodConfigurationOccupancy( p, *pointToMask ) );
+    CHECK( same );
+  }
+  SECTION("Tables of the standard topologies"){
+    CHECK( SimplicityTableTraits<Adj26, Adj6>::available );
+    CHECK( SimplicityTableTraits<Z2i::Adj4, Z2i::Adj8>::available );
+    CHECK( ! SimplicityTableTraits<Adj18, Adj26>::available );
+    auto table = loadSimplicityTable<Adj26, Adj6>();
+    REQUIRE( table.isValid() );
+    CHECK( table->size() == 67108864 );
+    // Loaded once.
+    CHECK( table.get() == loadSimplicityTable<Adj26, Adj6>().get() );
+    CHECK( ! loadSimplicityTable<Adj18, Adj26>().isValid() );
+    // Same simple points with the table as with the geodesic neighborhoods.
+    Object26_6 withTable( obj );
+    REQUIRE( withTable.loadSimplicityTable() );
+    bool same = true;
+    for ( auto && p : obj.pointSet() )
+      same = same && ( obj.isSimple( p ) == withTable.isSimple( p ) );
+    CHECK( same );
+  }
+}
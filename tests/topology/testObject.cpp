@@ -815,6 +815,86 @@ bool testSetTable()
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
+/**
+ * Counts the configurations of the cube around the origin for which
+ * isSimple differs from the precomputed simplicity table.
+ */
+template <typename TObject>
+unsigned int nbSimpleMismatches( const TObject & object,
+                                 const std::string & tableName,
+                                 unsigned int nbConfigurations )
+{
+  typedef typename TObject::Point Point;
+  typedef typename TObject::Domain Domain;
+  const Point c = Point::diagonal( 0 );
+  const Domain cube( Point::diagonal( -1 ), Point::diagonal( 1 ) );
+  std::vector<Point> neighbors;
+  for ( typename Domain::ConstIterator it = cube.begin(); it != cube.end(); ++it )
+    if ( *it != c ) neighbors.push_back( *it );
+
+  TObject withTable( object.topology(), object.domainPointer() );
+  {
+    auto table_smart_ptr = functions::loadTable<Point::dimension>( tableName );
+    withTable.setTable( table_smart_ptr );
+  }
+  TObject withoutTable( object.topology(), object.domainPointer() );
+  const bool exhaustive = ( nbConfigurations >> neighbors.size() ) != 0;
+  const unsigned int nb = exhaustive ? ( 1u << neighbors.size() ) : nbConfigurations;
+  unsigned int nbMismatches = 0;
+  DGtal::uint64_t seed = 12345;
+  for ( unsigned int cfg = 0; cfg < nb; ++cfg )
+    {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      const DGtal::uint64_t bits = exhaustive ? cfg : ( seed >> 32 );
+      withTable.pointSet().clear();
+      withoutTable.pointSet().clear();
+      withTable.pointSet().insertNew( c );
+      withoutTable.pointSet().insertNew( c );
+      for ( unsigned int i = 0; i < neighbors.size(); ++i )
+        if ( ( bits >> i ) & 1 )
+          {
+            withTable.pointSet().insertNew( neighbors[ i ] );
+            withoutTable.pointSet().insertNew( neighbors[ i ] );
+          }
+      if ( withTable.isSimple( c ) != withoutTable.isSimple( c ) )
+        ++nbMismatches;
+    }
+  return nbMismatches;
+}
+
+/**
+ * The simple point test for metric adjacencies (without table) must
+ * agree with the simplicity tables.
+ */
+bool testSimplePointsAgainstTables()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing isSimple against simplicity tables ..." );
+  {
+    Z2i::Domain domain( Z2i::Point( -2, -2 ), Z2i::Point( 2, 2 ) );
+    Z2i::DigitalSet set( domain );
+    Z2i::Object4_8 o4_8( Z2i::dt4_8, set );
+    Z2i::Object8_4 o8_4( Z2i::dt8_4, set );
+    INBLOCK_TEST( nbSimpleMismatches( o4_8, simplicity::tableSimple4_8, 256 ) == 0 );
+    INBLOCK_TEST( nbSimpleMismatches( o8_4, simplicity::tableSimple8_4, 256 ) == 0 );
+  }
+  {
+    Z3i::Domain domain( Z3i::Point( -2, -2, -2 ), Z3i::Point( 2, 2, 2 ) );
+    Z3i::DigitalSet set( domain );
+    Z3i::Object6_18 o6_18( Z3i::dt6_18, set );
+    Z3i::Object18_6 o18_6( Z3i::dt18_6, set );
+    Z3i::Object6_26 o6_26( Z3i::dt6_26, set );
+    Z3i::Object26_6 o26_6( Z3i::dt26_6, set );
+    INBLOCK_TEST( nbSimpleMismatches( o6_18, simplicity::tableSimple6_18, 20000 ) == 0 );
+    INBLOCK_TEST( nbSimpleMismatches( o18_6, simplicity::tableSimple18_6, 20000 ) == 0 );
+    INBLOCK_TEST( nbSimpleMismatches( o6_26, simplicity::tableSimple6_26, 20000 ) == 0 );
+    INBLOCK_TEST( nbSimpleMismatches( o26_6, simplicity::tableSimple26_6, 20000 ) == 0 );
+  }
+  trace.endBlock();
+  return nbok == nb;
+}
+
 int main( int argc, char** argv )
 {
   trace.beginBlock ( "Testing class Object" );
@@ -828,7 +908,8 @@ int main( int argc, char** argv )
     && testSimplePoints3D()
     && testSimplePoints2D()
     && testObjectGraph()
-    && testSetTable();
+    && testSetTable()
+    && testSimplePointsAgainstTables();
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
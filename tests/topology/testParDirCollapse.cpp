@@ -103,6 +103,105 @@ TEST_CASE( "Testing ParDirCollapse" )
       thinning.collapseIsthmus ();
       REQUIRE( (eulerBefore == complex.euler()) );
     }
+  SECTION("Testing ParDirCollapse::evalParallel")
+    {
+      getComplex< CC, KSpace > ( complex, K );
+      int eulerBefore = complex.euler();
+      CC other ( complex );
+      thinning.attach ( &complex );
+      REQUIRE( ( thinning.evalParallel ( 2, 1 ) != 0 ) );
+      REQUIRE( (eulerBefore == complex.euler()) );
+      ParDirCollapse < CC > otherThinning ( K );
+      otherThinning.attach ( &other );
+      otherThinning.evalParallel ( 2, 3 );
+      REQUIRE( ( other == complex ) );
+      // The flower is simply connected, hence it collapses onto a point.
+      thinning.evalParallel ( 1000 );
+      REQUIRE( ( complex.nbCells ( 0 ) == 1 ) );
+      REQUIRE( ( complex.nbCells ( 1 ) == 0 ) );
+      REQUIRE( ( complex.nbCells ( 2 ) == 0 ) );
+    }
+  SECTION("Testing ParDirCollapse::evalParallel against eval")
+    {
+      getComplex< CC, KSpace > ( complex, K );
+      CC other ( complex );
+      ParDirCollapse < CC > sequential ( K );
+      sequential.attach ( &other );
+      thinning.attach ( &complex );
+      for ( unsigned int i = 1; i <= 4; i++ )
+        {
+          REQUIRE( ( thinning.evalParallel ( i, 2 ) == sequential.eval ( i ) ) );
+          REQUIRE( ( other == complex ) );
+        }
+    }
+  SECTION("Testing ParDirCollapse::collapseSurfaceParallel")
+    {
+      getComplex< CC, KSpace > ( complex, K );
+      int eulerBefore = complex.euler();
+      thinning.attach ( &complex );
+      REQUIRE( ( thinning.collapseSurfaceParallel () != 0 ) );
+      REQUIRE( (eulerBefore == complex.euler()) );
+      REQUIRE( ( complex.nbCells ( 2 ) == 0 ) );
+    }
+  SECTION("Testing ParDirCollapse::collapseIsthmusParallel")
+    {
+      getComplex< CC, KSpace > ( complex, K );
+      int eulerBefore = complex.euler();
+      thinning.attach ( &complex );
+      REQUIRE( ( thinning.collapseIsthmusParallel () != 0 ) );
+      REQUIRE( (eulerBefore == complex.euler()) );
+      REQUIRE( ( complex.nbCells ( 2 ) == 0 ) );
+    }
+}
+
+TEST_CASE( "Testing ParDirCollapse in 3D" )
+{
+  typedef Z3i::KSpace                          KSpace3;
+  typedef CubicalComplex< KSpace3 >            CC3;
+  KSpace3 K;
+  K.init ( Z3i::Point::diagonal ( -6 ), Z3i::Point::diagonal ( 6 ), true );
+  Z3i::Domain domain ( Z3i::Point::diagonal ( -5 ), Z3i::Point::diagonal ( 5 ) );
+  Z3i::DigitalSet ball ( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( ( *it - Z3i::Point::diagonal ( 0 ) ).norm() <= 4.5 )
+      ball.insertNew ( *it );
+  CC3 complex ( K );
+  complex.construct ( ball );
+  int eulerBefore = complex.euler();
+  ParDirCollapse < CC3 > thinning ( K );
+  thinning.attach ( &complex );
+
+  SECTION("Testing ParDirCollapse::collapseSurfaceParallel")
+    {
+      thinning.collapseSurfaceParallel ();
+      REQUIRE( (eulerBefore == complex.euler()) );
+      REQUIRE( ( complex.nbCells ( 3 ) == 0 ) );
+    }
+  SECTION("Testing ParDirCollapse::collapseIsthmusParallel")
+    {
+      thinning.collapseIsthmusParallel ();
+      REQUIRE( (eulerBefore == complex.euler()) );
+      REQUIRE( ( complex.nbCells ( 3 ) == 0 ) );
+    }
+  SECTION("Testing the parallel collapses against the sequential ones")
+    {
+      CC3 other ( complex );
+      ParDirCollapse < CC3 > sequential ( K );
+      sequential.attach ( &other );
+      REQUIRE( ( thinning.evalParallel ( 2, 3 ) == sequential.eval ( 2 ) ) );
+      REQUIRE( ( other == complex ) );
+      thinning.collapseSurfaceParallel ( 3 );
+      sequential.collapseSurface ();
+      REQUIRE( ( other == complex ) );
+      CC3 isthmus ( K ), otherIsthmus ( K );
+      isthmus.construct ( ball );
+      otherIsthmus.construct ( ball );
+      thinning.attach ( &isthmus );
+      sequential.attach ( &otherIsthmus );
+      thinning.collapseIsthmusParallel ( 3 );
+      sequential.collapseIsthmus ();
+      REQUIRE( ( otherIsthmus == isthmus ) );
+    }
 }
 
 /** @ingroup Tests **/